@@ -144,6 +144,51 @@ instantiate_add(int_t,complex_t);
 instantiate_add(int_t,complex8_t);
 #undef instantiate_add
 /*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void add(
+		T_Scalar alpha, const csc::XxMatrix<T_Int,T_Scalar>& A,
+		T_Scalar beta, const csc::XxMatrix<T_Int,T_Scalar>& B,
+		csc::XxMatrix<T_Int,T_Scalar>& C)
+{
+	similarity_check(
+			A.prop(), A.nrows(), A.ncols(),
+			B.prop(), B.nrows(), B.ncols());
+
+	bool inPattern = !C.empty();
+
+	if(inPattern) {
+		similarity_check(
+				A.prop(), A.nrows(), A.ncols(),
+				C.prop(), C.nrows(), C.ncols());
+		inPattern = (
+				blk::csc::pattern_includes(C.ncols(), C.colptr(), C.rowidx(), A.colptr(), A.rowidx()) &&
+				blk::csc::pattern_includes(C.ncols(), C.colptr(), C.rowidx(), B.colptr(), B.rowidx()));
+	} // C
+
+	if(inPattern) {
+		blk::csc::add_numeric(C.ncols(), 
+				alpha, A.colptr(), A.rowidx(), A.values(),
+				beta, B.colptr(), B.rowidx(), B.values(),
+				C.colptr(), C.rowidx(), C.values());
+		return;
+	} // in place
+
+	csc::XxMatrix<T_Int,T_Scalar> tmp = add(alpha, A, beta, B);
+	C.clear();
+	C = tmp.move();
+}
+/*-------------------------------------------------*/
+#define instantiate_add(T_Int,T_Scl) \
+template void add( \
+		T_Scl, const csc::XxMatrix<T_Int,T_Scl>&, \
+		T_Scl, const csc::XxMatrix<T_Int,T_Scl>&, \
+		csc::XxMatrix<T_Int,T_Scl>&)
+instantiate_add(int_t,real_t);
+instantiate_add(int_t,real4_t);
+instantiate_add(int_t,complex_t);
+instantiate_add(int_t,complex8_t);
+#undef instantiate_add
+/*-------------------------------------------------*/
 template <typename T_Matrix>
 lra::XxMatrix<T_Matrix> add(
 		typename T_Matrix::value_type alpha, const lra::XxMatrix<T_Matrix>& A, 
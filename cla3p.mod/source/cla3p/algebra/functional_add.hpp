@@ -78,6 +78,26 @@ csc::XxMatrix<T_Int, T_Scalar> add(
 		T_Scalar alpha, const csc::XxMatrix<T_Int, T_Scalar>& A,
 		T_Scalar beta , const csc::XxMatrix<T_Int, T_Scalar>& B);
 
+/**
+ * @ingroup cla3p_module_index_math_op_add
+ * @brief Adds two compatible sparse matrices on an existing sparse matrix.
+ * @details Performs the operation <b>C = alpha * A + beta * B</b> @n
+ *          If the pattern of C contains the patterns of A and B, the result is computed in place
+ *          and entries of C outside both patterns are set to zero. @n
+ *          Otherwise C is replaced by a matrix with the union pattern. @n
+ *          C can be one of A, B.
+ * @param[in] alpha The scaling coefficient for A.
+ * @param[in] A The first input sparse matrix.
+ * @param[in] beta The scaling coefficient for B.
+ * @param[in] B The second input sparse matrix.
+ * @param[in,out] C The sparse matrix that receives the result.
+ */
+template <typename T_Int, typename T_Scalar>
+void add(
+		T_Scalar alpha, const csc::XxMatrix<T_Int, T_Scalar>& A,
+		T_Scalar beta , const csc::XxMatrix<T_Int, T_Scalar>& B,
+		csc::XxMatrix<T_Int, T_Scalar>& C);
+
 /**
  * @ingroup cla3p_module_index_math_op_add
  * @brief Adds two compatible low-rank matrices.
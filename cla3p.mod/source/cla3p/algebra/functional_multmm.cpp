@@ -24,13 +24,17 @@
 
 // cla3p
 #include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
 #include "cla3p/checks/matrix_math_checks.hpp"
 #include "cla3p/checks/hermitian_coeff_checks.hpp"
 #include "cla3p/proxies/blas_proxy.hpp"
 #include "cla3p/bulk/dns_math.hpp"
+#include "cla3p/bulk/csc.hpp"
 #include "cla3p/bulk/csc_math.hpp"
+#include "cla3p/support/imalloc.hpp"
 #include "cla3p/dense/dns_xxmatrix.hpp"
 #include "cla3p/sparse/csc_xxmatrix.hpp"
+#include "cla3p/sparse/csc_level_schedule.hpp"
 #include "cla3p/algebra/functional_update.hpp"
 
 /*-------------------------------------------------*/
@@ -345,6 +349,28 @@ instantiate_trisol(complex8_t);
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
 template <typename T_Int, typename T_Scalar>
+void trisol(T_Scalar alpha, op_t opA,
+    const csc::XxMatrix<T_Int,T_Scalar>& A,
+    dns::XxMatrix<T_Scalar>& B)
+{
+	Operation _opA(opA);
+	trimat_mult_replace_check(side_t::Left, A.prop(), A.nrows(), A.ncols(), _opA, B.prop(), B.nrows(), B.ncols());
+
+	csc::LevelSchedule<T_Int,T_Scalar> schedule(opA, A);
+	schedule.solve(alpha, A, B);
+}
+/*-------------------------------------------------*/
+#define instantiate_trisol(T_Int, T_Scl) \
+template void trisol(T_Scl, op_t, \
+	const csc::XxMatrix<T_Int,T_Scl>&, \
+	dns::XxMatrix<T_Scl>&)
+instantiate_trisol(int_t, real_t);
+instantiate_trisol(int_t, real4_t);
+instantiate_trisol(int_t, complex_t);
+instantiate_trisol(int_t, complex8_t);
+#undef instantiate_trisol
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
 void mult(T_Scalar alpha, op_t opA,
 	const csc::XxMatrix<T_Int,T_Scalar>& A,
 	const dns::XxMatrix<T_Scalar>& B,
@@ -488,13 +514,12 @@ csc::XxMatrix<T_Int,T_Scalar> mult(T_Scalar alpha,
 		int_t    *rowidxC = nullptr;
 		T_Scalar *valuesC = nullptr;
 
-		blk::csc::gem_x_gem(m, n, k,
+		blk::csc::gem_x_gem(m, n, k, alpha,
 				opA, A.colptr(), A.rowidx(), A.values(),
 				opB, B.colptr(), B.rowidx(), B.values(),
 				&colptrC, &rowidxC, &valuesC);
 
 		ret = csc::XxMatrix<T_Int,T_Scalar>(m, n, colptrC, rowidxC, valuesC, true);
-		ret.iscale(alpha);
 
 	} else {
 
@@ -515,6 +540,299 @@ instantiate_mult(int_t, complex_t);
 instantiate_mult(int_t, complex8_t);
 #undef instantiate_mult
 /*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+csc::XxMatrix<T_Int,T_Scalar> symbolicMult(
+    op_t opA, const csc::XxMatrix<T_Int,T_Scalar>& A,
+    op_t opB, const csc::XxMatrix<T_Int,T_Scalar>& B)
+{
+	Operation _opA(opA);
+	Operation _opB(opB);
+
+	int_t m = (_opA.isTranspose() ? A.ncols() : A.nrows());
+	int_t n = (_opB.isTranspose() ? B.nrows() : B.ncols());
+	int_t k = (_opA.isTranspose() ? A.nrows() : A.ncols());
+
+	mult_dim_check(
+			A.nrows(), A.ncols(), _opA, 
+			B.nrows(), B.ncols(), _opB, 
+			m, n);
+
+	csc::XxMatrix<T_Int,T_Scalar> ret;
+
+	if(A.prop().isGeneral() && B.prop().isGeneral()) {
+
+		int_t *colptrC = nullptr;
+		int_t *rowidxC = nullptr;
+
+		blk::csc::gem_x_gem_symbolic(m, n, k,
+				opA, A.colptr(), A.rowidx(),
+				opB, B.colptr(), B.rowidx(),
+				&colptrC, &rowidxC);
+
+		T_Scalar *valuesC = i_calloc<T_Scalar>(colptrC[n]);
+
+		ret = csc::XxMatrix<T_Int,T_Scalar>(m, n, colptrC, rowidxC, valuesC, true);
+
+	} else {
+
+		throw_prop_compatibility_error(A, B);
+
+	} // property combos
+
+	return ret;
+}
+/*-------------------------------------------------*/
+#define instantiate_symbolic_mult(T_Int, T_Scl) \
+template csc::XxMatrix<T_Int,T_Scl> symbolicMult( \
+    op_t, const csc::XxMatrix<T_Int,T_Scl>&, \
+    op_t, const csc::XxMatrix<T_Int,T_Scl>&)
+instantiate_symbolic_mult(int_t, real_t);
+instantiate_symbolic_mult(int_t, real4_t);
+instantiate_symbolic_mult(int_t, complex_t);
+instantiate_symbolic_mult(int_t, complex8_t);
+#undef instantiate_symbolic_mult
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void mult(T_Scalar alpha,
+	op_t opA, const csc::XxMatrix<T_Int,T_Scalar>& A,
+	op_t opB, const csc::XxMatrix<T_Int,T_Scalar>& B,
+	T_Scalar beta, csc::XxMatrix<T_Int,T_Scalar>& C)
+{
+	opA = (TypeTraits<T_Scalar>::is_real() && opA == op_t::C ? op_t::T : opA);
+	opB = (TypeTraits<T_Scalar>::is_real() && opB == op_t::C ? op_t::T : opB);
+
+	Operation _opA(opA);
+	Operation _opB(opB);
+
+	mult_dim_check(
+			A.nrows(), A.ncols(), _opA, 
+			B.nrows(), B.ncols(), _opB, 
+			C.nrows(), C.ncols());
+
+	if(A.prop().isGeneral() && B.prop().isGeneral() && C.prop().isGeneral()) {
+
+		int_t k = (_opA.isTranspose() ? A.nrows() : A.ncols());
+
+		blk::csc::gem_x_gem_numeric(C.nrows(), C.ncols(), k, alpha,
+				opA, A.colptr(), A.rowidx(), A.values(),
+				opB, B.colptr(), B.rowidx(), B.values(),
+				beta, C.colptr(), C.rowidx(), C.values());
+
+	} else {
+
+		throw_prop_compatibility_error(A, B, C);
+
+	} // property combos
+}
+/*-------------------------------------------------*/
+#define instantiate_mult(T_Int, T_Scl) \
+template void mult(T_Scl, \
+		op_t, const csc::XxMatrix<T_Int,T_Scl>&, \
+		op_t, const csc::XxMatrix<T_Int,T_Scl>&, \
+		T_Scl, csc::XxMatrix<T_Int,T_Scl>&)
+instantiate_mult(int_t, real_t);
+instantiate_mult(int_t, real4_t);
+instantiate_mult(int_t, complex_t);
+instantiate_mult(int_t, complex8_t);
+#undef instantiate_mult
+/*-------------------------------------------------*/
+SparseProductPlan::SparseProductPlan()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+SparseProductPlan::~SparseProductPlan()
+{
+}
+/*-------------------------------------------------*/
+void SparseProductPlan::clear()
+{
+	m_opA = op_t::N;
+	m_opB = op_t::N;
+	m_m = 0;
+	m_n = 0;
+	m_k = 0;
+	m_nnzA = 0;
+	m_nnzB = 0;
+	m_nnzC = 0;
+	m_hashA = 0;
+	m_hashB = 0;
+	m_hashC = 0;
+	m_colptrRefA = nullptr;
+	m_rowidxRefA = nullptr;
+	m_colptrRefB = nullptr;
+	m_rowidxRefB = nullptr;
+	m_colptrRefC = nullptr;
+	m_rowidxRefC = nullptr;
+	m_colptrA.clear();
+	m_rowidxA.clear();
+	m_posA.clear();
+	m_colptrB.clear();
+	m_rowidxB.clear();
+	m_posB.clear();
+	m_bounds.clear();
+}
+/*-------------------------------------------------*/
+bool SparseProductPlan::empty() const
+{
+	return m_bounds.empty();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+static unsigned long long product_pattern_hash(const csc::XxMatrix<T_Int,T_Scalar>& X)
+{
+	return blk::csc::pattern_hash(X.prop().type(), X.prop().uplo(), X.nrows(), X.ncols(), X.colptr(), X.rowidx());
+}
+/*-------------------------------------------------*/
+//
+// The index arrays the plan was created with are trusted, others are fingerprinted
+//
+template <typename T_Int, typename T_Scalar>
+static bool product_pattern_matches(const csc::XxMatrix<T_Int,T_Scalar>& X, 
+		int_t nnz, const int_t *colptr, const int_t *rowidx, unsigned long long hash)
+{
+	if(X.nnz() != nnz) 
+		return false;
+
+	if(X.colptr() == colptr && X.rowidx() == rowidx) 
+		return true;
+
+	return (product_pattern_hash(X) == hash);
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+csc::XxMatrix<T_Int,T_Scalar> symbolicMult(
+    op_t opA, const csc::XxMatrix<T_Int,T_Scalar>& A,
+    op_t opB, const csc::XxMatrix<T_Int,T_Scalar>& B,
+		SparseProductPlan& plan)
+{
+	opA = (TypeTraits<T_Scalar>::is_real() && opA == op_t::C ? op_t::T : opA);
+	opB = (TypeTraits<T_Scalar>::is_real() && opB == op_t::C ? op_t::T : opB);
+
+	Operation _opA(opA);
+	Operation _opB(opB);
+
+	int_t m = (_opA.isTranspose() ? A.ncols() : A.nrows());
+	int_t n = (_opB.isTranspose() ? B.nrows() : B.ncols());
+	int_t k = (_opA.isTranspose() ? A.nrows() : A.ncols());
+
+	mult_dim_check(
+			A.nrows(), A.ncols(), _opA, 
+			B.nrows(), B.ncols(), _opB, 
+			m, n);
+
+	csc::XxMatrix<T_Int,T_Scalar> ret;
+
+	if(A.prop().isGeneral() && B.prop().isGeneral()) {
+
+		plan.clear();
+
+		blk::csc::product_operand_pattern(opA, A.nrows(), A.ncols(), A.colptr(), A.rowidx(), plan.m_colptrA, plan.m_rowidxA, plan.m_posA);
+		blk::csc::product_operand_pattern(opB, B.nrows(), B.ncols(), B.colptr(), B.rowidx(), plan.m_colptrB, plan.m_rowidxB, plan.m_posB);
+
+		blk::csc::ProductOperand opndA = blk::csc::product_operand(opA, A.colptr(), A.rowidx(), plan.m_colptrA, plan.m_rowidxA, plan.m_posA);
+		blk::csc::ProductOperand opndB = blk::csc::product_operand(opB, B.colptr(), B.rowidx(), plan.m_colptrB, plan.m_rowidxB, plan.m_posB);
+
+		int_t nparts = blk::csc::product_partition(n, opndA, opndB, plan.m_bounds);
+
+		int_t *colptrC = nullptr;
+		int_t *rowidxC = nullptr;
+
+		blk::csc::gem_x_gem_symbolic(m, n, opndA, opndB, nparts, plan.m_bounds.data(), &colptrC, &rowidxC);
+
+		T_Scalar *valuesC = i_calloc<T_Scalar>(colptrC[n]);
+
+		ret = csc::XxMatrix<T_Int,T_Scalar>(m, n, colptrC, rowidxC, valuesC, true);
+
+		plan.m_opA = opA;
+		plan.m_opB = opB;
+		plan.m_m = m;
+		plan.m_n = n;
+		plan.m_k = k;
+		plan.m_nnzA = A.nnz();
+		plan.m_nnzB = B.nnz();
+		plan.m_nnzC = ret.nnz();
+		plan.m_hashA = product_pattern_hash(A);
+		plan.m_hashB = product_pattern_hash(B);
+		plan.m_hashC = product_pattern_hash(ret);
+		plan.m_colptrRefA = A.colptr();
+		plan.m_rowidxRefA = A.rowidx();
+		plan.m_colptrRefB = B.colptr();
+		plan.m_rowidxRefB = B.rowidx();
+		plan.m_colptrRefC = ret.colptr();
+		plan.m_rowidxRefC = ret.rowidx();
+
+	} else {
+
+		throw_prop_compatibility_error(A, B);
+
+	} // property combos
+
+	return ret;
+}
+/*-------------------------------------------------*/
+#define instantiate_symbolic_mult(T_Int, T_Scl) \
+template csc::XxMatrix<T_Int,T_Scl> symbolicMult( \
+    op_t, const csc::XxMatrix<T_Int,T_Scl>&, \
+    op_t, const csc::XxMatrix<T_Int,T_Scl>&, \
+    SparseProductPlan&)
+instantiate_symbolic_mult(int_t, real_t);
+instantiate_symbolic_mult(int_t, real4_t);
+instantiate_symbolic_mult(int_t, complex_t);
+instantiate_symbolic_mult(int_t, complex8_t);
+#undef instantiate_symbolic_mult
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void mult(T_Scalar alpha, const SparseProductPlan& plan,
+		const csc::XxMatrix<T_Int,T_Scalar>& A,
+		const csc::XxMatrix<T_Int,T_Scalar>& B,
+		T_Scalar beta, csc::XxMatrix<T_Int,T_Scalar>& C)
+{
+	if(plan.empty())
+		throw err::InvalidOp("Product plan is empty, use symbolicMult() first");
+
+	Operation _opA(plan.m_opA);
+	Operation _opB(plan.m_opB);
+
+	mult_dim_check(
+			A.nrows(), A.ncols(), _opA, 
+			B.nrows(), B.ncols(), _opB, 
+			C.nrows(), C.ncols());
+
+	bool consistent = (
+			A.prop().isGeneral() && B.prop().isGeneral() && C.prop().isGeneral() && 
+			C.nrows() == plan.m_m && C.ncols() == plan.m_n && 
+			(_opA.isTranspose() ? A.nrows() : A.ncols()) == plan.m_k &&
+			product_pattern_matches(A, plan.m_nnzA, plan.m_colptrRefA, plan.m_rowidxRefA, plan.m_hashA) && 
+			product_pattern_matches(B, plan.m_nnzB, plan.m_colptrRefB, plan.m_rowidxRefB, plan.m_hashB) && 
+			product_pattern_matches(C, plan.m_nnzC, plan.m_colptrRefC, plan.m_rowidxRefC, plan.m_hashC));
+
+	if(!consistent)
+		throw err::NoConsistency(msg::PatternMismatch());
+
+	blk::csc::ProductOperand opndA = blk::csc::product_operand(plan.m_opA, A.colptr(), A.rowidx(), plan.m_colptrA, plan.m_rowidxA, plan.m_posA);
+	blk::csc::ProductOperand opndB = blk::csc::product_operand(plan.m_opB, B.colptr(), B.rowidx(), plan.m_colptrB, plan.m_rowidxB, plan.m_posB);
+
+	int_t nparts = static_cast<int_t>(plan.m_bounds.size()) - 1;
+
+	blk::csc::gem_x_gem_numeric(C.nrows(), C.ncols(), alpha,
+			opndA, A.values(),
+			opndB, B.values(),
+			beta, C.colptr(), C.rowidx(), C.values(),
+			nparts, plan.m_bounds.data());
+}
+/*-------------------------------------------------*/
+#define instantiate_mult(T_Int, T_Scl) \
+template void mult(T_Scl, const SparseProductPlan&, \
+		const csc::XxMatrix<T_Int,T_Scl>&, \
+		const csc::XxMatrix<T_Int,T_Scl>&, \
+		T_Scl, csc::XxMatrix<T_Int,T_Scl>&)
+instantiate_mult(int_t, real_t);
+instantiate_mult(int_t, real4_t);
+instantiate_mult(int_t, complex_t);
+instantiate_mult(int_t, complex8_t);
+#undef instantiate_mult
+/*-------------------------------------------------*/
 } // namespace ops
 } // namespace cla3p
 /*-------------------------------------------------*/
@@ -21,6 +21,8 @@
  * @file
  */
 
+#include <vector>
+
 #include "cla3p/types/enums.hpp"
 #include "cla3p/sparse/csc_xxmatrix.hpp"
 
@@ -122,6 +124,21 @@ void trisol(T_Scalar alpha,
 
 /*-------------------------------------------------*/
 
+/**
+ * @ingroup cla3p_module_index_math_op_matmat
+ * @brief Replaces a matrix with the scaled solution of a sparse triangular system.
+ * @details Solves the system <b>opA(A) * X = alpha * B</b> using level set scheduling.@n
+ *          For repeated solves with the same pattern, use csc::LevelSchedule directly to keep the analysis.
+ * @param[in] alpha The scaling coefficient.
+ * @param[in] opA The operation to be performed for matrix A.
+ * @param[in] A The input triangular matrix.
+ * @param[in,out] B On entry, the rhs, on exit the system solution X.
+ */
+template <typename T_Int, typename T_Scalar>
+void trisol(T_Scalar alpha, op_t opA,
+    const csc::XxMatrix<T_Int,T_Scalar>& A,
+    dns::XxMatrix<T_Scalar>& B);
+
 /**
  * @ingroup cla3p_module_index_math_op_matmat
  * @brief Updates a general dense matrix with a sparse-dense matrix-matrix product.
@@ -173,7 +190,7 @@ void mult(T_Scalar alpha,
  * @details Performs the operation <b>alpha * opA(A) * opB(B)</b>@n
  *          Valid combinations are the following:
  *          @verbatim
-            A: General     B: General     opA: N or T             opB: N or T          
+            A: General     B: General     opA: unconstrained      opB: unconstrained   
  *          @endverbatim
  *
  * @param[in] alpha The scaling coefficient.
@@ -188,6 +205,157 @@ csc::XxMatrix<T_Int,T_Scalar> mult(T_Scalar alpha,
 		op_t opA, const csc::XxMatrix<T_Int,T_Scalar>& A,
     op_t opB, const csc::XxMatrix<T_Int,T_Scalar>& B);
 
+/**
+ * @nosubgrouping
+ * @brief The cached analysis of a sparse-sparse matrix-matrix product.
+ *
+ * Filled by symbolicMult() and used by mult() in repeated products of matrices with unchanged patterns. @n
+ * Holds the operations, the patterns of transposed operands and the work partition, 
+ * so that subsequent products only compute values. @n
+ * The patterns of the operands and the output are fingerprinted. @n
+ * Every use checks dimensions and nnz, fingerprints are only recomputed for matrices 
+ * whose index arrays are not the ones the plan was created with.
+ */
+class SparseProductPlan {
+
+	public:
+		SparseProductPlan();
+		~SparseProductPlan();
+
+		/**
+		 * @brief Clears the plan.
+		 */
+		void clear();
+
+		/**
+		 * @brief Test for an empty plan.
+		 * @return Whether the plan has not been created by symbolicMult().
+		 */
+		bool empty() const;
+
+	private:
+		op_t m_opA;
+		op_t m_opB;
+		int_t m_m;
+		int_t m_n;
+		int_t m_k;
+		int_t m_nnzA;
+		int_t m_nnzB;
+		int_t m_nnzC;
+		unsigned long long m_hashA;
+		unsigned long long m_hashB;
+		unsigned long long m_hashC;
+		const int_t *m_colptrRefA;
+		const int_t *m_rowidxRefA;
+		const int_t *m_colptrRefB;
+		const int_t *m_rowidxRefB;
+		const int_t *m_colptrRefC;
+		const int_t *m_rowidxRefC;
+		std::vector<int_t> m_colptrA;
+		std::vector<int_t> m_rowidxA;
+		std::vector<int_t> m_posA;
+		std::vector<int_t> m_colptrB;
+		std::vector<int_t> m_rowidxB;
+		std::vector<int_t> m_posB;
+		std::vector<int_t> m_bounds;
+
+		template <typename T_Int, typename T_Scalar>
+		friend csc::XxMatrix<T_Int,T_Scalar> symbolicMult(
+				op_t, const csc::XxMatrix<T_Int,T_Scalar>&,
+				op_t, const csc::XxMatrix<T_Int,T_Scalar>&,
+				SparseProductPlan&);
+
+		template <typename T_Int, typename T_Scalar>
+		friend void mult(T_Scalar, const SparseProductPlan&,
+				const csc::XxMatrix<T_Int,T_Scalar>&,
+				const csc::XxMatrix<T_Int,T_Scalar>&,
+				T_Scalar, csc::XxMatrix<T_Int,T_Scalar>&);
+};
+
+/**
+ * @ingroup cla3p_module_index_math_op_matmat
+ * @brief Creates the sparsity pattern of a sparse-sparse matrix-matrix product.
+ * @details Computes the pattern of <b>opA(A) * opB(B)</b>, values are set to zero.@n
+ *          The result can be reused in repeated products with unchanged patterns,
+ *          where only the numeric phase needs to be performed (see mult()).@n
+ *          Valid combinations are the following:
+ *          @verbatim
+            A: General     B: General     opA: unconstrained      opB: unconstrained
+ *          @endverbatim
+ *
+ * @param[in] opA The operation to be performed for matrix A.
+ * @param[in] A The input sparse matrix.
+ * @param[in] opB The operation to be performed for matrix B.
+ * @param[in] B The input sparse matrix.
+ * @return A matrix with the pattern of <b>(opA(A) * opB(B))</b>.
+ */
+template <typename T_Int, typename T_Scalar>
+csc::XxMatrix<T_Int,T_Scalar> symbolicMult(
+		op_t opA, const csc::XxMatrix<T_Int,T_Scalar>& A,
+		op_t opB, const csc::XxMatrix<T_Int,T_Scalar>& B);
+
+/**
+ * @ingroup cla3p_module_index_math_op_matmat
+ * @brief Updates a sparse matrix with a sparse-sparse matrix-matrix product.
+ * @details Performs the operation <b>C := beta * C + alpha * opA(A) * opB(B)</b> on the existing pattern of C.@n
+ *          The pattern of C must contain the pattern of the product, as created by symbolicMult(), otherwise NoConsistency is thrown and C is left intact.@n
+ *          Valid combinations are the following:
+ *          @verbatim
+             A: General     B: General     opA: unconstrained      opB: unconstrained      C: General
+ *          @endverbatim
+ * @param[in] alpha The scaling coefficient.
+ * @param[in] opA The operation to be performed for matrix A.
+ * @param[in] A The input sparse matrix.
+ * @param[in] opB The operation to be performed for matrix B.
+ * @param[in] B The input sparse matrix.
+ * @param[in] beta The scaling coefficient for C.
+ * @param[in,out] C The sparse matrix to be updated.
+ */
+template <typename T_Int, typename T_Scalar>
+void mult(T_Scalar alpha, 
+		op_t opA, const csc::XxMatrix<T_Int,T_Scalar>& A,
+		op_t opB, const csc::XxMatrix<T_Int,T_Scalar>& B,
+		T_Scalar beta, csc::XxMatrix<T_Int,T_Scalar>& C);
+
+/**
+ * @ingroup cla3p_module_index_math_op_matmat
+ * @brief Creates the sparsity pattern of a sparse-sparse matrix-matrix product and its cached analysis.
+ * @details Same as symbolicMult(opA, A, opB, B), the analysis is stored in plan for use in mult(alpha, plan, A, B, beta, C).
+ *
+ * @param[in] opA The operation to be performed for matrix A.
+ * @param[in] A The input sparse matrix.
+ * @param[in] opB The operation to be performed for matrix B.
+ * @param[in] B The input sparse matrix.
+ * @param[out] plan The analysis of the product.
+ * @return A matrix with the pattern of <b>(opA(A) * opB(B))</b>.
+ */
+template <typename T_Int, typename T_Scalar>
+csc::XxMatrix<T_Int,T_Scalar> symbolicMult(
+		op_t opA, const csc::XxMatrix<T_Int,T_Scalar>& A,
+		op_t opB, const csc::XxMatrix<T_Int,T_Scalar>& B,
+		SparseProductPlan& plan);
+
+/**
+ * @ingroup cla3p_module_index_math_op_matmat
+ * @brief Updates a sparse matrix with a planned sparse-sparse matrix-matrix product.
+ * @details Performs the operation <b>C := beta * C + alpha * opA(A) * opB(B)</b>, with the operations stored in plan.@n
+ *          A, B and C must have the patterns analyzed in symbolicMult(opA, A, opB, B, plan), 
+ *          otherwise NoConsistency is thrown and C is left intact.@n
+ *          Matrices that still hold the index arrays seen by symbolicMult() are only checked for dimensions and nnz, 
+ *          so their patterns must not be modified in place.
+ * @param[in] alpha The scaling coefficient.
+ * @param[in] plan The analysis of the product.
+ * @param[in] A The input sparse matrix.
+ * @param[in] B The input sparse matrix.
+ * @param[in] beta The scaling coefficient for C.
+ * @param[in,out] C The sparse matrix to be updated.
+ */
+template <typename T_Int, typename T_Scalar>
+void mult(T_Scalar alpha, const SparseProductPlan& plan,
+		const csc::XxMatrix<T_Int,T_Scalar>& A,
+		const csc::XxMatrix<T_Int,T_Scalar>& B,
+		T_Scalar beta, csc::XxMatrix<T_Int,T_Scalar>& C);
+
 /*-------------------------------------------------*/
 } // namespace ops
 } // namespace cla3p
@@ -30,6 +30,7 @@
 #include "cla3p/dense/dns_xxvector.hpp"
 #include "cla3p/dense/dns_xxmatrix.hpp"
 #include "cla3p/sparse/csc_xxmatrix.hpp"
+#include "cla3p/sparse/csc_level_schedule.hpp"
 #include "cla3p/algebra/functional_update.hpp"
 
 /*-------------------------------------------------*/
@@ -137,6 +138,28 @@ instantiate_trisol(complex8_t);
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
 template <typename T_Int, typename T_Scalar>
+void trisol(op_t opA,
+    const csc::XxMatrix<T_Int,T_Scalar>& A,
+    dns::XxVector<T_Scalar>& B)
+{
+	Operation _opA(opA);
+	trivec_mult_replace_check(A.prop(), A.nrows(), A.ncols(), _opA, B.size());
+
+	csc::LevelSchedule<T_Int,T_Scalar> schedule(opA, A);
+	schedule.solve(A, B);
+}
+/*-------------------------------------------------*/
+#define instantiate_trisol(T_Int, T_Scl) \
+template void trisol(op_t, \
+    const csc::XxMatrix<T_Int,T_Scl>&, \
+    dns::XxVector<T_Scl>&)
+instantiate_trisol(int_t, real_t);
+instantiate_trisol(int_t, real4_t);
+instantiate_trisol(int_t, complex_t);
+instantiate_trisol(int_t, complex8_t);
+#undef instantiate_trisol
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
 void mult(T_Scalar alpha, op_t opA,
     const csc::XxMatrix<T_Int,T_Scalar>& A,
     const dns::XxVector<T_Scalar>& X,
@@ -83,6 +83,20 @@ void trisol(op_t opA,
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
 
+/**
+ * @ingroup cla3p_module_index_math_op_matvec
+ * @brief Replaces a vector with the solution of a sparse triangular system.
+ * @details Solves the system <b>opA(A) * X = B</b> using level set scheduling.@n
+ *          For repeated solves with the same pattern, use csc::LevelSchedule directly to keep the analysis.
+ * @param[in] opA The operation to be performed for matrix A.
+ * @param[in] A The input triangular matrix.
+ * @param[in,out] B On entry, the rhs, on exit the system solution X.
+ */
+template <typename T_Int, typename T_Scalar>
+void trisol(op_t opA,
+    const csc::XxMatrix<T_Int,T_Scalar>& A,
+    dns::XxVector<T_Scalar>& B);
+
 /**
  * @ingroup cla3p_module_index_math_op_matvec
  * @brief Updates a vector with a matrix-vector product.
@@ -76,9 +76,7 @@ void update(T_Scalar alpha, const csc::XxMatrix<T_Int,T_Scalar>& A, csc::XxMatri
 			A.prop(), A.nrows(), A.ncols(),
 			B.prop(), B.nrows(), B.ncols());
 
-	csc::XxMatrix<T_Int,T_Scalar> tmp = add(alpha, A, T_Scalar(1), B);
-	B.clear();
-	B = tmp.move();
+	add(alpha, A, T_Scalar(1), B, B);
 }
 /*-------------------------------------------------*/
 #define instantiate_update(T_Int,T_Scl) \
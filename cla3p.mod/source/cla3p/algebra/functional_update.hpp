@@ -63,7 +63,8 @@ void update(T_Scalar alpha,
 /**
  * @ingroup cla3p_module_index_math_op_add
  * @brief Update a sparse matrix with a compatible scaled sparse matrix.
- * @details Performs the operation <b>B = B + alpha * A</b>
+ * @details Performs the operation <b>B = B + alpha * A</b> @n
+ *          The update is performed in place if the pattern of B contains the pattern of A.
  * @param[in] alpha The scaling coefficient.
  * @param[in] A The input sparse matrix.
  * @param[in,out] B The sparse matrix to be updated.
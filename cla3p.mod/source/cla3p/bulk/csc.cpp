@@ -29,7 +29,8 @@
 #include "cla3p/support/utils.hpp"
 #include "cla3p/proxies/blas_proxy.hpp"
 #include "cla3p/checks/basic_checks.hpp"
-#include "cla3p/support/utils.hpp"
+#include "cla3p/support/mt.hpp"
+#include "cla3p/support/rand.hpp"
 
 /*-------------------------------------------------*/
 namespace cla3p {
@@ -38,9 +39,46 @@ namespace csc {
 /*-------------------------------------------------*/
 void roll(int_t n, int_t *colptr)
 {
-	for(int_t j = 0; j < n; j++) {
-		colptr[j+1] += colptr[j];
-	} // j
+	int_t nparts = std::min(n / MT_NNZ_THRESHOLD, static_cast<int_t>(mt::maxThreads()));
+
+	if(nparts < 2) {
+		for(int_t j = 0; j < n; j++) {
+			colptr[j+1] += colptr[j];
+		} // j
+		return;
+	} // serial
+
+	//
+	// Two pass blocked scan: block sums, then local scans with block offsets
+	//
+	std::vector<int_t> offsets(nparts + 1, 0);
+	offsets[0] = colptr[0];
+
+#pragma omp parallel for schedule(static,1)
+	for(int_t p = 0; p < nparts; p++) {
+		int_t jbgn = static_cast<int_t>((static_cast<long long int>(n) * p) / nparts);
+		int_t jend = static_cast<int_t>((static_cast<long long int>(n) * (p + 1)) / nparts);
+		int_t sum = 0;
+		for(int_t j = jbgn; j < jend; j++) {
+			sum += colptr[j+1];
+		} // j
+		offsets[p+1] = sum;
+	} // p
+
+	for(int_t p = 0; p < nparts; p++) {
+		offsets[p+1] += offsets[p];
+	} // p
+
+#pragma omp parallel for schedule(static,1)
+	for(int_t p = 0; p < nparts; p++) {
+		int_t jbgn = static_cast<int_t>((static_cast<long long int>(n) * p) / nparts);
+		int_t jend = static_cast<int_t>((static_cast<long long int>(n) * (p + 1)) / nparts);
+		int_t sum = offsets[p];
+		for(int_t j = jbgn; j < jend; j++) {
+			sum += colptr[j+1];
+			colptr[j+1] = sum;
+		} // j
+	} // p
 }
 /*-------------------------------------------------*/
 void unroll(int_t n, int_t *colptr)
@@ -68,139 +106,324 @@ int_t maxrlen(int_t n, const int_t *colptr)
 	return ret;
 }
 /*-------------------------------------------------*/
-void check(prop_t ptype, uplo_t uplo, int_t m, int_t n, const int_t *colptr, const int_t *rowidx)
+/*
+ * Validates column j, row indexes must be strictly increasing
+ * so duplicates are detected without a row marker
+ */
+static void check_column(const Property& prop, int_t m, int_t j, const int_t *colptr, const int_t *rowidx)
 {
-	Property prop(ptype, uplo);
+	int_t ibgn = colptr[j];
+	int_t iend = colptr[j+1];
 
-	if(colptr[0]) {
-		throw err::NoConsistency("Column pointer array must contain a zero at position 0");
-	}
+	for(int_t irow = ibgn; irow < iend; irow++) {
 
-	std::vector<bool> mark(m, false);
+		int_t i = rowidx[irow];
 
-	for(int_t j = 0; j < n; j++) {
+		if(i < 0) {
+			throw err::OutOfBounds("Negative row index detected: " + std::to_string(i));
+		}
 
-		int_t ibgn = colptr[j];
-		int_t iend = colptr[j+1];
+		if(i >= m) {
+			throw err::OutOfBounds("Row index " + std::to_string(i) + " is greater than number of rows " + std::to_string(m));
+		}
 
-		if(iend < ibgn) {
-			throw err::NoConsistency("Column pointer array must be in ascending order");
+		if(prop.isLower() && i < j) {
+			throw err::NoConsistency("Found coordinate " + coordToString(i,j) + " in upper part");
 		}
 
-		for(int_t irow = ibgn; irow < iend; irow++) {
+		if(prop.isUpper() && i > j) {
+			throw err::NoConsistency("Found coordinate " + coordToString(i,j) + " in lower part");
+		}
 
-			int_t i = rowidx[irow];
+		// TODO: perhaps check skew diagonals for values
 
-			if(i < 0) {
-				throw err::OutOfBounds("Negative row index detected: " + std::to_string(i));
+		if(irow > ibgn) {
+			int_t i_prev = rowidx[irow - 1];
+			if(i < i_prev) {
+				throw err::NoConsistency("Column " + std::to_string(j) + " is not sorted");
 			}
-
-			if(i >= m) {
-				throw err::OutOfBounds("Row index " + std::to_string(i) + " is greater than number of rows " + std::to_string(m));
+			if(i == i_prev) {
+				throw err::NoConsistency("Duplicate entry detected at " + coordToString(i,j));
 			}
+		}
 
-			if(prop.isLower() && i < j) {
-				throw err::NoConsistency("Found coordinate " + coordToString(i,j) + " in upper part");
-			}
+	} // irow
+}
+/*-------------------------------------------------*/
+void check(prop_t ptype, uplo_t uplo, int_t m, int_t n, const int_t *colptr, const int_t *rowidx)
+{
+	Property prop(ptype, uplo);
 
-			if(prop.isUpper() && i > j) {
-				throw err::NoConsistency("Found coordinate " + coordToString(i,j) + " in lower part");
-			}
+	if(colptr[0]) {
+		throw err::NoConsistency("Column pointer array must contain a zero at position 0");
+	}
 
-			// TODO: perhaps check skew diagonals for values
+	for(int_t j = 0; j < n; j++) {
+		if(colptr[j+1] < colptr[j]) {
+			throw err::NoConsistency("Column pointer array must be in ascending order");
+		}
+	} // j
 
-			if(irow > ibgn) {
-				int_t i_prev = rowidx[irow - 1];
-				if(i < i_prev) {
-					throw err::NoConsistency("Column " + std::to_string(j) + " is not sorted");
-				}
-			}
+	int_t nparts = num_column_parts(n, colptr);
 
-			if(mark[i]) {
-				throw err::NoConsistency("Duplicate entry detected at " + coordToString(i,j));
-			}
+	if(nparts < 2) {
+		for(int_t j = 0; j < n; j++) {
+			check_column(prop, m, j, colptr, rowidx);
+		} // j
+		return;
+	} // serial
+
+	//
+	// Locate the first invalid column in parallel, then re-check it serially
+	// so the reported error matches the sequential sweep
+	//
+	std::vector<int_t> bounds(nparts + 1);
+	partition_columns(n, colptr, nparts, bounds.data());
+
+	int_t jfail = n;
+
+#pragma omp parallel for schedule(dynamic,1) reduction(min:jfail)
+	for(int_t p = 0; p < nparts; p++) {
+		int_t j = bounds[p];
+		try {
+			for(; j < bounds[p+1]; j++) {
+				check_column(prop, m, j, colptr, rowidx);
+			} // j
+		} catch(const err::Exception&) {
+			jfail = std::min(jfail, j);
+		}
+	} // p
 
-			mark[i] = true;
+	if(jfail < n) {
+		check_column(prop, m, jfail, colptr, rowidx);
+	}
+}
+/*-------------------------------------------------*/
+void partition_columns(int_t n, const int_t *colptr, int_t nparts, int_t *bounds)
+{
+	int_t nz = colptr[n];
 
-		} // irow
+	bounds[0] = 0;
 
+	for(int_t p = 1; p < nparts; p++) {
+		int_t target = static_cast<int_t>((static_cast<long long int>(nz) * p) / nparts);
+		int_t jp = static_cast<int_t>(std::upper_bound(colptr, colptr + n + 1, target) - colptr) - 1;
+		bounds[p] = std::min(n, std::max(bounds[p-1], jp));
+	} // p
 
-		for(int_t irow = ibgn; irow < iend; irow++) {
-			mark[rowidx[irow]] = false;
-		} // irow
+	bounds[nparts] = n;
+}
+/*-------------------------------------------------*/
+int_t num_column_parts(int_t n, const int_t *colptr)
+{
+	if(n < 2 || colptr[n] < MT_NNZ_THRESHOLD)
+		return 1;
+
+	return std::min(n, static_cast<int_t>(4 * mt::maxThreads()));
+}
+/*-------------------------------------------------*/
+static inline unsigned long long hash_mix(unsigned long long z)
+{
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+	return z ^ (z >> 31);
+}
+/*-------------------------------------------------*/
+unsigned long long pattern_hash(prop_t ptype, uplo_t uplo, int_t m, int_t n, const int_t *colptr, const int_t *rowidx)
+{
+	//
+	// Entries are mixed independently and summed, so the reduction order does not matter
+	//
+	unsigned long long h = 0;
 
+#pragma omp parallel for schedule(static) reduction(+:h) if(colptr[n] >= MT_NNZ_THRESHOLD)
+	for(int_t j = 0; j < n; j++) {
+		unsigned long long hj = hash_mix(static_cast<unsigned long long>(j) + 0x9e3779b97f4a7c15ULL);
+		for(int_t irow = colptr[j]; irow < colptr[j+1]; irow++) {
+			h += hash_mix(hj ^ static_cast<unsigned long long>(rowidx[irow]));
+		} // irow
 	} // j
+
+	h ^= hash_mix(static_cast<unsigned long long>(m) + 0x632be59bd9b4e019ULL);
+	h ^= hash_mix(hash_mix(static_cast<unsigned long long>(n)) ^ static_cast<unsigned long long>(colptr[n]));
+	h ^= hash_mix((static_cast<unsigned long long>(ptype) << 8) | static_cast<unsigned long long>(uplo));
+
+	return hash_mix(h);
 }
 /*-------------------------------------------------*/
 void sort(int_t n, const int_t *colptr, int_t *rowidx)
 {
-	for(int_t j = 0; j < n; j++) {
+	if(!n) return;
 
-		int_t ibgn = colptr[j];
-		int_t iend = colptr[j+1];
-		int_t ilen = iend - ibgn;
+	int_t nparts = num_column_parts(n, colptr);
+	std::vector<int_t> bounds(nparts + 1);
+	partition_columns(n, colptr, nparts, bounds.data());
 
-		if(ilen > 0) {
-			std::sort(rowidx + ibgn, rowidx + iend);
-		} // ilen
+#pragma omp parallel for schedule(dynamic,1) if(nparts > 1)
+	for(int_t p = 0; p < nparts; p++) {
+		for(int_t j = bounds[p]; j < bounds[p+1]; j++) {
 
-	} // j
+			int_t ibgn = colptr[j];
+			int_t iend = colptr[j+1];
+
+			if(!std::is_sorted(rowidx + ibgn, rowidx + iend)) {
+				std::sort(rowidx + ibgn, rowidx + iend);
+			} // unsorted
+
+		} // j
+	} // p
 }
 /*-------------------------------------------------*/
+/*
+ * In-place co-sort of (keys,vals) by keys
+ * Introsort with insertion sort for short ranges, no extra storage
+ */
+static constexpr int_t COSORT_INSERTION_LIMIT = 16;
+/*-------------------------------------------------*/
 template <typename T_Scalar>
-class RowValuePair {
-	public:
-		RowValuePair() : i(0), v(0) {}
-		~RowValuePair() = default;
-		RowValuePair(const RowValuePair<T_Scalar>& r) : i(r.i), v(r.v) {} // Removes ABI warning
-
-		int_t    i;
-		T_Scalar v;
-
-		bool operator<(const RowValuePair<T_Scalar>& other) const
-		{
-			return (i < other.i);
-		}
-};
+static inline void cosort_swap(int_t *keys, T_Scalar *vals, int_t a, int_t b)
+{
+	std::swap(keys[a], keys[b]);
+	std::swap(vals[a], vals[b]);
+}
 /*-------------------------------------------------*/
-// 
-// TODO: implement without extra storage
-//
 template <typename T_Scalar>
-void sort(int_t n, const int_t *colptr, int_t *rowidx, T_Scalar *values)
+static void cosort_insertion(int_t *keys, T_Scalar *vals, int_t len)
 {
-	if(!n) return;
+	for(int_t k = 1; k < len; k++) {
 
-	int_t milen = maxrlen(n, colptr);
+		int_t    key = keys[k];
+		T_Scalar val = vals[k];
+		int_t    pos = k;
 
-	if(!milen) return;
+		while(pos > 0 && key < keys[pos-1]) {
+			keys[pos] = keys[pos-1];
+			vals[pos] = vals[pos-1];
+			pos--;
+		} // shift
 
-	std::vector<RowValuePair<T_Scalar>> row_pairs;
-	row_pairs.reserve(milen);
+		keys[pos] = key;
+		vals[pos] = val;
 
-	for(int_t j = 0; j < n; j++) {
+	} // k
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static void cosort_sift_down(int_t *keys, T_Scalar *vals, int_t root, int_t len)
+{
+	for(;;) {
 
-		int_t ibgn = colptr[j];
-		int_t iend = colptr[j+1];
-		int_t ilen = iend - ibgn;
+		int_t child = 2 * root + 1;
 
-		if(ilen < 2) continue;
+		if(child >= len) break;
 
-		row_pairs.resize(ilen);
+		if(child + 1 < len && keys[child] < keys[child+1]) child++;
 
-		for(int_t irow = ibgn; irow < iend; irow++) {
-			row_pairs[irow - ibgn].i = rowidx[irow];
-			row_pairs[irow - ibgn].v = values[irow];
-		} // irow
+		if(!(keys[root] < keys[child])) break;
 
-		std::sort(row_pairs.begin(), row_pairs.end());
+		cosort_swap(keys, vals, root, child);
+		root = child;
 
-		for(int_t irow = ibgn; irow < iend; irow++) {
-			rowidx[irow] = row_pairs[irow - ibgn].i;
-			values[irow] = row_pairs[irow - ibgn].v;
-		} // irow
+	} // sift
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static void cosort_heap(int_t *keys, T_Scalar *vals, int_t len)
+{
+	for(int_t k = len / 2 - 1; k >= 0; k--) {
+		cosort_sift_down(keys, vals, k, len);
+	} // k
+
+	for(int_t k = len - 1; k > 0; k--) {
+		cosort_swap(keys, vals, 0, k);
+		cosort_sift_down(keys, vals, 0, k);
+	} // k
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static void cosort_intro(int_t *keys, T_Scalar *vals, int_t len, int_t depth)
+{
+	while(len > COSORT_INSERTION_LIMIT) {
+
+		if(!depth) {
+			cosort_heap(keys, vals, len);
+			return;
+		} // depth exhausted
+
+		depth--;
+
+		//
+		// median of three moved to position 0
+		//
+		int_t mid = len / 2;
+		int_t last = len - 1;
+		if(keys[mid ] < keys[0  ]) cosort_swap(keys, vals, mid , 0  );
+		if(keys[last] < keys[0  ]) cosort_swap(keys, vals, last, 0  );
+		if(keys[last] < keys[mid]) cosort_swap(keys, vals, last, mid);
+		cosort_swap(keys, vals, 0, mid);
+
+		int_t pivot = keys[0];
+		int_t lo = 1;
+		int_t hi = last;
+
+		for(;;) {
+			while(lo <= hi && keys[lo] < pivot) lo++;
+			while(lo <= hi && pivot < keys[hi]) hi--;
+			if(lo >= hi) break;
+			cosort_swap(keys, vals, lo, hi);
+			lo++;
+			hi--;
+		} // partition
+
+		cosort_swap(keys, vals, 0, hi);
+
+		//
+		// recurse on the smaller part, iterate on the larger
+		//
+		int_t nleft = hi;
+		int_t nright = len - hi - 1;
+
+		if(nleft < nright) {
+			cosort_intro(keys, vals, nleft, depth);
+			keys += hi + 1;
+			vals += hi + 1;
+			len = nright;
+		} else {
+			cosort_intro(keys + hi + 1, vals + hi + 1, nright, depth);
+			len = nleft;
+		} // smaller part
 
-	} // j
+	} // len
+
+	cosort_insertion(keys, vals, len);
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static void cosort(int_t *keys, T_Scalar *vals, int_t len)
+{
+	if(len < 2 || std::is_sorted(keys, keys + len)) return;
+
+	int_t depth = 0;
+	for(int_t k = len; k > 1; k >>= 1) depth += 2;
+
+	cosort_intro(keys, vals, len, depth);
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void sort(int_t n, const int_t *colptr, int_t *rowidx, T_Scalar *values)
+{
+	if(!n) return;
+
+	int_t nparts = num_column_parts(n, colptr);
+	std::vector<int_t> bounds(nparts + 1);
+	partition_columns(n, colptr, nparts, bounds.data());
+
+#pragma omp parallel for schedule(dynamic,1) if(nparts > 1)
+	for(int_t p = 0; p < nparts; p++) {
+		for(int_t j = bounds[p]; j < bounds[p+1]; j++) {
+			cosort(rowidx + colptr[j], values + colptr[j], colptr[j+1] - colptr[j]);
+		} // j
+	} // p
 }
 /*-------------------------------------------------*/
 template void sort(int_t, const int_t *, int_t *, real_t    *);
@@ -240,52 +463,154 @@ template void print_to_stream(std::ostream&, int_t n, const int_t *, const int_t
 template void print_to_stream(std::ostream&, int_t n, const int_t *, const int_t *, const complex_t *, std::streamsize);
 template void print_to_stream(std::ostream&, int_t n, const int_t *, const int_t *, const complex8_t*, std::streamsize);
 /*-------------------------------------------------*/
-static void transpose_colptr(int_t m, int_t n, const int_t *colptr, const int_t *rowidx, int_t *colptr_out)
+/*
+ * Scatter helpers shared by transpose & uplo2ge operations
+ *
+ * Input columns are split in nparts ranges, each range keeps a private histogram
+ * of the entries it sends to every output column. Converting the histograms to offsets
+ * lets every range write its entries independently, in increasing input column order,
+ * so output columns come out sorted.
+ */
+/*-------------------------------------------------*/
+static inline bool is_stored(uplo_t uplo, int_t i, int_t j)
 {
-	for(int_t j = 0; j < m+1; j++) {
-		colptr_out[j] = 0;
-	} // j
+	if(uplo == uplo_t::Lower) return (i >= j);
+	if(uplo == uplo_t::Upper) return (i <= j);
+	return true;
+}
+/*-------------------------------------------------*/
+static inline bool is_mirrored(uplo_t uplo, int_t i, int_t j)
+{
+	if(uplo == uplo_t::Lower) return (i > j);
+	if(uplo == uplo_t::Upper) return (i < j);
+	return true;
+}
+/*-------------------------------------------------*/
+static int_t num_scatter_parts(int_t m, int_t n, const int_t *colptr)
+{
+	int_t nparts = std::min(num_column_parts(n, colptr), static_cast<int_t>(mt::maxThreads()));
 
-	for(int_t j = 0; j < n; j++) {
+	//
+	// Histograms cost (nparts x m), keep them below the number of non zeros
+	//
+	if(nparts > 1) {
+		nparts = std::min(nparts, 1 + colptr[n] / std::max(m, int_t(1)));
+	} // nparts
 
-		int_t ibgn = colptr[j];
-		int_t iend = colptr[j+1];
+	return nparts;
+}
+/*-------------------------------------------------*/
+static inline int_t* part_histogram(std::vector<int_t>& hist, int_t m, int_t p)
+{
+	return hist.data() + static_cast<std::size_t>(p) * static_cast<std::size_t>(m);
+}
+/*-------------------------------------------------*/
+static void mirror_histograms(uplo_t uplo, int_t m, const int_t *colptr, const int_t *rowidx, 
+		int_t nparts, const int_t *bounds, std::vector<int_t>& hist)
+{
+	hist.assign(static_cast<std::size_t>(nparts) * static_cast<std::size_t>(m), 0);
 
-		for(int_t irow = ibgn; irow < iend; irow++) {
-			colptr_out[rowidx[irow] + 1]++;
-		} // irow
+#pragma omp parallel for schedule(static,1) if(nparts > 1)
+	for(int_t p = 0; p < nparts; p++) {
 
-	} // j
+		int_t *hp = part_histogram(hist, m, p);
+
+		for(int_t j = bounds[p]; j < bounds[p+1]; j++) {
+			for(int_t irow = colptr[j]; irow < colptr[j+1]; irow++) {
+				int_t i = rowidx[irow];
+				if(is_mirrored(uplo, i, j)) {
+					hp[i]++;
+				} // mirrored
+			} // irow
+		} // j
+
+	} // p
+}
+/*-------------------------------------------------*/
+static void histograms_to_offsets(int_t m, int_t nparts, std::vector<int_t>& hist, int_t *totals)
+{
+#pragma omp parallel for if(nparts > 1)
+	for(int_t i = 0; i < m; i++) {
+
+		int_t sum = 0;
+
+		for(int_t p = 0; p < nparts; p++) {
+			int_t *hp = part_histogram(hist, m, p);
+			int_t cnt = hp[i];
+			hp[i] = sum;
+			sum += cnt;
+		} // p
+
+		totals[i] = sum;
+
+	} // i
+}
+/*-------------------------------------------------*/
+static void transpose_colptr(int_t m, int_t /*n*/, const int_t *colptr, const int_t *rowidx, int_t *colptr_out,
+		int_t nparts, const int_t *bounds, std::vector<int_t>& hist)
+{
+	mirror_histograms(uplo_t::Full, m, colptr, rowidx, nparts, bounds, hist);
+
+	colptr_out[0] = 0;
+	histograms_to_offsets(m, nparts, hist, colptr_out + 1);
 
 	roll(m, colptr_out);
 }
 /*-------------------------------------------------*/
 template <typename T_Scalar>
 static void hybrid_transpose_tmpl(int_t m, int_t n, const int_t *colptr, const int_t *rowidx, const T_Scalar *values, 
-		int_t *colptr_out, int_t *rowidx_out, T_Scalar *values_out, T_Scalar coeff, bool conjop) 
+		int_t *colptr_out, int_t *rowidx_out, T_Scalar *values_out, T_Scalar coeff, bool conjop, int_t *pos_out = nullptr) 
 {
-	transpose_colptr(m, n, colptr, rowidx, colptr_out);
+	int_t nparts = num_scatter_parts(m, n, colptr);
+	std::vector<int_t> bounds(nparts + 1);
+	std::vector<int_t> hist;
 
-	for(int_t j = 0; j < n; j++) {
+	partition_columns(n, colptr, nparts, bounds.data());
 
-		int_t ibgn = colptr[j];
-		int_t iend = colptr[j+1];
+	transpose_colptr(m, n, colptr, rowidx, colptr_out, nparts, bounds.data(), hist);
 
-		for(int_t irow = ibgn; irow < iend; irow++) {
+#pragma omp parallel for schedule(static,1) if(nparts > 1)
+	for(int_t p = 0; p < nparts; p++) {
 
-			int_t    i = rowidx[irow];
-			T_Scalar v = values[irow];
+		int_t *hp = part_histogram(hist, m, p);
 
-			rowidx_out[colptr_out[i]] = j;
-			values_out[colptr_out[i]] = coeff * (conjop ? arith::conj(v) : v);
+		for(int_t j = bounds[p]; j < bounds[p+1]; j++) {
+			for(int_t irow = colptr[j]; irow < colptr[j+1]; irow++) {
 
-			colptr_out[i]++;
+				int_t i = rowidx[irow];
 
-		} // irow
+				int_t pos = colptr_out[i] + hp[i];
+				hp[i]++;
 
-	} // j
+				rowidx_out[pos] = j;
 
-	unroll(m, colptr_out);
+				if(pos_out) {
+					pos_out[pos] = irow;
+				} // positions
+
+				if(values) {
+					T_Scalar v = values[irow];
+					values_out[pos] = coeff * (conjop ? arith::conj(v) : v);
+				} // values
+
+			} // irow
+		} // j
+
+	} // p
+}
+/*-------------------------------------------------*/
+void transpose(int_t m, int_t n, const int_t *colptr, const int_t *rowidx, int_t *colptr_out, int_t *rowidx_out)
+{
+	const real_t *values = nullptr;
+	real_t *values_out = nullptr;
+	hybrid_transpose_tmpl(m, n, colptr, rowidx, values, colptr_out, rowidx_out, values_out, real_t(1), false);
+}
+/*-------------------------------------------------*/
+void transpose(int_t m, int_t n, const int_t *colptr, const int_t *rowidx, int_t *colptr_out, int_t *rowidx_out, int_t *pos_out)
+{
+	const real_t *values = nullptr;
+	real_t *values_out = nullptr;
+	hybrid_transpose_tmpl(m, n, colptr, rowidx, values, colptr_out, rowidx_out, values_out, real_t(1), false, pos_out);
 }
 /*-------------------------------------------------*/
 template <typename T_Scalar>
@@ -312,84 +637,286 @@ template void conjugate_transpose(int_t, int_t, const int_t *, const int_t *, co
 template void conjugate_transpose(int_t, int_t, const int_t *, const int_t *, const complex_t *, int_t *, int_t *, complex_t *, complex_t );
 template void conjugate_transpose(int_t, int_t, const int_t *, const int_t *, const complex8_t*, int_t *, int_t *, complex8_t*, complex8_t);
 /*-------------------------------------------------*/
-void uplo2ge_colptr(uplo_t uplo, int_t n, const int_t *colptr, const int_t *rowidx, int_t *colptr_out)
+static void stored_counts(uplo_t uplo, int_t n, const int_t *colptr, const int_t *rowidx, int_t *counts)
 {
-	if(uplo == uplo_t::Full) {
-		std::copy(colptr, colptr + (n+1), colptr_out);
-		return;
-	}
-
-	std::fill(colptr_out, colptr_out + (n+1), 0);
+	bool multithreaded = (colptr[n] >= MT_NNZ_THRESHOLD);
 
+#pragma omp parallel for schedule(static) if(multithreaded)
 	for(int_t j = 0; j < n; j++) {
 
-		int_t ibgn = colptr[j];
-		int_t iend = colptr[j+1];
+		int_t cnt = 0;
 
-		for(int_t irow = ibgn; irow < iend; irow++) {
+		for(int_t irow = colptr[j]; irow < colptr[j+1]; irow++) {
+			if(is_stored(uplo, rowidx[irow], j)) {
+				cnt++;
+			} // stored
+		} // irow
 
-			int_t i = rowidx[irow];
+		counts[j] = cnt;
 
-			if(i == j) {
-				colptr_out[j+1]++;
-			} else if(uplo == uplo_t::Lower && i > j) {
-				colptr_out[j+1]++;
-				colptr_out[i+1]++;
-			} else if(uplo == uplo_t::Upper && i < j) {
-				colptr_out[j+1]++;
-				colptr_out[i+1]++;
-			} // lower/upper
+	} // j
+}
+/*-------------------------------------------------*/
+static void uplo2ge_counts(uplo_t uplo, int_t n, const int_t *colptr, const int_t *rowidx, int_t *colptr_out,
+		int_t nparts, const int_t *bounds, std::vector<int_t>& hist, std::vector<int_t>& stored, std::vector<int_t>& mirrored)
+{
+	stored.resize(n);
+	mirrored.resize(n);
 
-		} // irow
+	stored_counts(uplo, n, colptr, rowidx, stored.data());
+	mirror_histograms(uplo, n, colptr, rowidx, nparts, bounds, hist);
+	histograms_to_offsets(n, nparts, hist, mirrored.data());
+
+	bool multithreaded = (nparts > 1);
 
+	colptr_out[0] = 0;
+#pragma omp parallel for schedule(static) if(multithreaded)
+	for(int_t j = 0; j < n; j++) {
+		colptr_out[j+1] = stored[j] + mirrored[j];
 	} // j
 
 	roll(n, colptr_out);
 }
 /*-------------------------------------------------*/
+void block_colptr(int_t ibgn, int_t jbgn, int_t ni, int_t nj, const int_t *colptr, const int_t *rowidx, int_t *colptr_out)
+{
+	int_t iend = ibgn + ni;
+
+	bool multithreaded = (colptr[jbgn + nj] - colptr[jbgn] >= MT_NNZ_THRESHOLD);
+
+	colptr_out[0] = 0;
+#pragma omp parallel for schedule(static) if(multithreaded)
+	for(int_t jl = 0; jl < nj; jl++) {
+		const int_t *rbgn = rowidx + colptr[jbgn + jl];
+		const int_t *rend = rowidx + colptr[jbgn + jl + 1];
+		const int_t *lo = std::lower_bound(rbgn, rend, ibgn);
+		const int_t *hi = std::lower_bound(lo  , rend, iend);
+		colptr_out[jl+1] = static_cast<int_t>(hi - lo);
+	} // jl
+
+	roll(nj, colptr_out);
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void block(int_t ibgn, int_t jbgn, int_t /*ni*/, int_t nj, const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
+		const int_t *colptr_out, int_t *rowidx_out, T_Scalar *values_out)
+{
+	bool multithreaded = (colptr_out[nj] >= MT_NNZ_THRESHOLD);
+
+#pragma omp parallel for schedule(static) if(multithreaded)
+	for(int_t jl = 0; jl < nj; jl++) {
+		int_t kbgn = colptr[jbgn + jl];
+		int_t kend = colptr[jbgn + jl + 1];
+		int_t k = static_cast<int_t>(std::lower_bound(rowidx + kbgn, rowidx + kend, ibgn) - rowidx);
+		for(int_t kl = colptr_out[jl]; kl < colptr_out[jl+1]; kl++, k++) {
+			rowidx_out[kl] = rowidx[k] - ibgn;
+			values_out[kl] = values[k];
+		} // kl
+	} // jl
+}
+/*-------------------------------------------------*/
+template void block(int_t, int_t, int_t, int_t, const int_t *, const int_t *, const real_t    *, const int_t *, int_t *, real_t    *);
+template void block(int_t, int_t, int_t, int_t, const int_t *, const int_t *, const real4_t   *, const int_t *, int_t *, real4_t   *);
+template void block(int_t, int_t, int_t, int_t, const int_t *, const int_t *, const complex_t *, const int_t *, int_t *, complex_t *);
+template void block(int_t, int_t, int_t, int_t, const int_t *, const int_t *, const complex8_t*, const int_t *, int_t *, complex8_t*);
+/*-------------------------------------------------*/
+//
+// Row to row-part map for block partitioning
+//
+static void partition_rowmap(int_t m, int_t nrp, const int_t *rbounds, std::vector<int_t>& rmap)
+{
+	rmap.resize(m);
+
+#pragma omp parallel for schedule(static) if(m >= MT_NNZ_THRESHOLD)
+	for(int_t p = 0; p < nrp; p++) {
+		std::fill(rmap.begin() + rbounds[p], rmap.begin() + rbounds[p+1], p);
+	} // p
+}
+/*-------------------------------------------------*/
+//
+// Visits the per row-part segments of columns [jbgn,jend)
+// func(p, q, jl, kbgn, kend) is called for every non-empty segment, q is the column part & jl the local column
+//
+template <typename T_Func>
+static void partition_sweep(int_t jbgn, int_t jend, const int_t *colptr, const int_t *rowidx,
+		const int_t *rbounds, const std::vector<int_t>& rmap, int_t ncp, const int_t *cbounds, T_Func func)
+{
+	int_t q = static_cast<int_t>(std::upper_bound(cbounds, cbounds + ncp + 1, jbgn) - cbounds) - 1;
+
+	for(int_t j = jbgn; j < jend; j++) {
+
+		while(j >= cbounds[q+1]) q++;
+
+		int_t kend = colptr[j+1];
+		int_t k = colptr[j];
+
+		while(k < kend) {
+			int_t p = rmap[rowidx[k]];
+			int_t kseg = static_cast<int_t>(std::lower_bound(rowidx + k, rowidx + kend, rbounds[p+1]) - rowidx);
+			func(p, q, j - cbounds[q], k, kseg);
+			k = kseg;
+		} // k
+
+	} // j
+}
+/*-------------------------------------------------*/
+void partition_colptr(int_t m, int_t n, const int_t *colptr, const int_t *rowidx,
+		int_t nrp, const int_t *rbounds, int_t ncp, const int_t *cbounds, int_t **colptr_out)
+{
+	std::vector<int_t> rmap;
+	partition_rowmap(m, nrp, rbounds, rmap);
+
+	int_t nblocks = nrp * ncp;
+
+#pragma omp parallel for schedule(static) if(static_cast<long long int>(nblocks) * n >= MT_NNZ_THRESHOLD)
+	for(int_t b = 0; b < nblocks; b++) {
+		int_t q = b / nrp;
+		std::fill(colptr_out[b], colptr_out[b] + cbounds[q+1] - cbounds[q] + 1, 0);
+	} // b
+
+	int_t nparts = num_column_parts(n, colptr);
+	std::vector<int_t> bounds(nparts + 1);
+	partition_columns(n, colptr, nparts, bounds.data());
+
+#pragma omp parallel for schedule(dynamic,1) if(nparts > 1)
+	for(int_t p = 0; p < nparts; p++) {
+		partition_sweep(bounds[p], bounds[p+1], colptr, rowidx, rbounds, rmap, ncp, cbounds, 
+				[&](int_t pr, int_t q, int_t jl, int_t kbgn, int_t kend) {
+					colptr_out[pr + q * nrp][jl+1] = kend - kbgn;
+				});
+	} // p
+
+#pragma omp parallel for schedule(dynamic,1) if(nparts > 1)
+	for(int_t b = 0; b < nblocks; b++) {
+		int_t q = b / nrp;
+		roll(cbounds[q+1] - cbounds[q], colptr_out[b]);
+	} // b
+}
+/*-------------------------------------------------*/
 template <typename T_Scalar>
-static inline void append_to_selected_part(int_t i, int_t j, T_Scalar v, int_t *colptr_out, int_t *rowidx_out, T_Scalar *values_out, bool conjop)
+void partition(int_t m, int_t n, const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
+		int_t nrp, const int_t *rbounds, int_t ncp, const int_t *cbounds, 
+		const int_t *const *colptr_out, int_t **rowidx_out, T_Scalar **values_out)
+{
+	std::vector<int_t> rmap;
+	partition_rowmap(m, nrp, rbounds, rmap);
+
+	int_t nparts = num_column_parts(n, colptr);
+	std::vector<int_t> bounds(nparts + 1);
+	partition_columns(n, colptr, nparts, bounds.data());
+
+#pragma omp parallel for schedule(dynamic,1) if(nparts > 1)
+	for(int_t p = 0; p < nparts; p++) {
+		partition_sweep(bounds[p], bounds[p+1], colptr, rowidx, rbounds, rmap, ncp, cbounds, 
+				[&](int_t pr, int_t q, int_t jl, int_t kbgn, int_t kend) {
+					int_t b = pr + q * nrp;
+					int_t kl = colptr_out[b][jl];
+					int_t ibgn = rbounds[pr];
+					for(int_t k = kbgn; k < kend; k++, kl++) {
+						rowidx_out[b][kl] = rowidx[k] - ibgn;
+						values_out[b][kl] = values[k];
+					} // k
+				});
+	} // p
+}
+/*-------------------------------------------------*/
+#define instantiate_partition(T_Scl) \
+template void partition(int_t, int_t, const int_t*, const int_t*, const T_Scl*, \
+		int_t, const int_t*, int_t, const int_t*, const int_t *const *, int_t**, T_Scl**)
+instantiate_partition(real_t    );
+instantiate_partition(real4_t   );
+instantiate_partition(complex_t );
+instantiate_partition(complex8_t);
+#undef instantiate_partition
+/*-------------------------------------------------*/
+void uplo2ge_colptr(uplo_t uplo, int_t n, const int_t *colptr, const int_t *rowidx, int_t *colptr_out)
 {
-	// original part
-	rowidx_out[colptr_out[j]] = i;
-	values_out[colptr_out[j]] = v;
-	colptr_out[j]++;
+	if(uplo == uplo_t::Full) {
+		std::copy(colptr, colptr + (n+1), colptr_out);
+		return;
+	}
+
+	int_t nparts = num_scatter_parts(n, n, colptr);
+	std::vector<int_t> bounds(nparts + 1);
+	std::vector<int_t> hist;
+	std::vector<int_t> stored;
+	std::vector<int_t> mirrored;
+
+	partition_columns(n, colptr, nparts, bounds.data());
 
-	// opposite part
-	if(i != j) {
-		rowidx_out[colptr_out[i]] = j;
-		values_out[colptr_out[i]] = (conjop ? arith::conj(v) : v);
-		colptr_out[i]++;
-	} // strict part
+	uplo2ge_counts(uplo, n, colptr, rowidx, colptr_out, nparts, bounds.data(), hist, stored, mirrored);
 }
 /*-------------------------------------------------*/
+/*
+ * Pattern only expansion if values is null
+ */
 template <typename T_Scalar>
-void xx2ge(uplo_t uplo, int_t n, const int_t *colptr, const int_t *rowidx, const T_Scalar *values, 
+static void xx2ge(uplo_t uplo, int_t n, const int_t *colptr, const int_t *rowidx, const T_Scalar *values, 
 		int_t *colptr_out, int_t *rowidx_out, T_Scalar *values_out, bool conjop) 
 {
-	uplo2ge_colptr(uplo, n, colptr, rowidx, colptr_out);
+	if(uplo == uplo_t::Full) {
+		std::copy(colptr, colptr + (n+1), colptr_out);
+		std::copy(rowidx, rowidx + colptr[n], rowidx_out);
+		if(values) std::copy(values, values + colptr[n], values_out);
+		return;
+	}
 
-	for(int_t j = 0; j < n; j++) {
+	int_t nparts = num_scatter_parts(n, n, colptr);
+	std::vector<int_t> bounds(nparts + 1);
+	std::vector<int_t> hist;
+	std::vector<int_t> stored;
+	std::vector<int_t> mirrored;
 
-		int_t ibgn = colptr[j];
-		int_t iend = colptr[j+1];
+	partition_columns(n, colptr, nparts, bounds.data());
 
-		for(int_t irow = ibgn; irow < iend; irow++) {
+	uplo2ge_counts(uplo, n, colptr, rowidx, colptr_out, nparts, bounds.data(), hist, stored, mirrored);
 
-			int_t    i = rowidx[irow];
-			T_Scalar v = values[irow];
+	//
+	// Output column layout:
+	//   Lower: [mirrored entries (rows < j)] [stored entries (rows >= j)]
+	//   Upper: [stored entries (rows <= j)] [mirrored entries (rows > j)]
+	//
+	bool lower = (uplo == uplo_t::Lower);
 
-			if(uplo == uplo_t::Lower && i >= j) {
-				append_to_selected_part(i, j, v, colptr_out, rowidx_out, values_out, conjop);
-			} else if(uplo == uplo_t::Upper && i <= j) {
-				append_to_selected_part(i, j, v, colptr_out, rowidx_out, values_out, conjop);
-			} // lower/upper
+#pragma omp parallel for schedule(static,1) if(nparts > 1)
+	for(int_t p = 0; p < nparts; p++) {
 
-		} // irow
+		int_t *hp = part_histogram(hist, n, p);
 
-	} // j
+		for(int_t j = bounds[p]; j < bounds[p+1]; j++) {
 
-	unroll(n, colptr_out);
+			int_t pos_j = colptr_out[j] + (lower ? mirrored[j] : 0);
+
+			for(int_t irow = colptr[j]; irow < colptr[j+1]; irow++) {
+
+				int_t    i = rowidx[irow];
+				T_Scalar v = (values ? values[irow] : T_Scalar(0));
+
+				if(!is_stored(uplo, i, j)) continue;
+
+				// original part
+				rowidx_out[pos_j] = i;
+				if(values) values_out[pos_j] = v;
+				pos_j++;
+
+				// opposite part
+				if(i != j) {
+					int_t pos_i = colptr_out[i] + (lower ? 0 : stored[i]) + hp[i];
+					hp[i]++;
+					rowidx_out[pos_i] = j;
+					if(values) values_out[pos_i] = (conjop ? arith::conj(v) : v);
+				} // strict part
+
+			} // irow
+
+		} // j
+
+	} // p
+}
+/*-------------------------------------------------*/
+void uplo2ge(uplo_t uplo, int_t n, const int_t *colptr, const int_t *rowidx, int_t *colptr_out, int_t *rowidx_out)
+{
+	xx2ge<real_t>(uplo, n, colptr, rowidx, nullptr, colptr_out, rowidx_out, nullptr, false);
 }
 /*-------------------------------------------------*/
 template <typename T_Scalar>
@@ -792,6 +1319,272 @@ instantiate_permute(int_t, complex_t );
 instantiate_permute(int_t, complex8_t);
 #undef instantiate_permute
 /*-------------------------------------------------*/
+/*
+ * Random generation, every column uses its own counter based streams
+ * (3j: degree weight, 3j+1: degree rounding, 3j+2: content),
+ * so the output depends only on the seed
+ */
+static bool random_forced_diag(const Property& prop, int_t m, int_t n)
+{
+	return (prop.isSymmetric() || prop.isHermitian() || prop.isTriangular() || (prop.isGeneral() && m == n));
+}
+/*-------------------------------------------------*/
+static int_t random_diag_count(const Property& prop, int_t m, int_t n, int_t nz)
+{
+	return (random_forced_diag(prop, m, n) ? std::min(std::min(m, n), nz) : 0);
+}
+/*-------------------------------------------------*/
+/*
+ * Off-diagonal admissible rows of column j are [rlo,rhi], excluding j if gap is set
+ * Returns their number
+ */
+static int_t random_column_domain(const Property& prop, bool skipdiag, int_t m, int_t j, int_t bw, int_t& rlo, int_t& rhi, bool& gap)
+{
+	rlo = 0;
+	rhi = m - 1;
+
+	if(prop.isUpper()) rhi = std::min(rhi, j);
+	if(prop.isLower()) rlo = j;
+
+	if(bw >= 0) {
+		if(bw < j) rlo = std::max(rlo, j - bw);
+		if(j < m && bw < m - 1 - j) rhi = std::min(rhi, j + bw);
+	} // band
+
+	if(rhi < rlo) {
+		gap = false;
+		return 0;
+	}
+
+	gap = (skipdiag && rlo <= j && j <= rhi);
+
+	return (rhi - rlo + 1 - (gap ? 1 : 0));
+}
+/*-------------------------------------------------*/
+static real_t random_fill_sum(int_t n, const int_t *cap, const real_t *w, real_t s)
+{
+	real_t ret = 0;
+
+#pragma omp parallel for reduction(+:ret) if(n >= MT_NNZ_THRESHOLD)
+	for(int_t j = 0; j < n; j++) {
+		ret += std::min(static_cast<real_t>(cap[j]), s * w[j]);
+	} // j
+
+	return ret;
+}
+/*-------------------------------------------------*/
+/*
+ * Sorted distinct sample of k values in [0,L) in out(k)
+ */
+static void random_sample(RandomStream& rs, int_t L, int_t k, int_t *out)
+{
+	if(2 * k > L) {
+
+		//
+		// Dense case: selection sampling, linear in L
+		//
+		int_t nsel = 0;
+		for(int_t r = 0; r < L && nsel < k; r++) {
+			if(static_cast<real_t>(L - r) * rs.uniform() < static_cast<real_t>(k - nsel)) {
+				out[nsel++] = r;
+			}
+		} // r
+
+	} else {
+
+		//
+		// Sparse case: draw, sort and top up duplicates
+		//
+		int_t nsel = 0;
+		while(nsel < k) {
+			for(int_t q = nsel; q < k; q++) {
+				out[q] = rs.index(L);
+			} // q
+			std::sort(out, out + k);
+			nsel = static_cast<int_t>(std::unique(out, out + k) - out);
+		} // top up
+
+	} // dense/sparse
+}
+/*-------------------------------------------------*/
+int_t random_colptr(prop_t ptype, uplo_t uplo, int_t m, int_t n, int_t nz,
+		nzdist_t dist, int_t bw, real_t exponent, bool exact, unsigned long long seed, int_t *colptr)
+{
+	Property prop(ptype, uplo);
+
+	bool skipdiag = (prop.isSkew() || random_forced_diag(prop, m, n));
+	int_t nd = random_diag_count(prop, m, n, nz);
+
+	std::vector<int_t> cap(n);
+	std::vector<real_t> w(n);
+
+	long long int capsum = 0;
+	real_t wsum = 0;
+
+#pragma omp parallel for reduction(+:capsum,wsum) if(n >= MT_NNZ_THRESHOLD)
+	for(int_t j = 0; j < n; j++) {
+
+		int_t rlo, rhi;
+		bool gap;
+		cap[j] = random_column_domain(prop, skipdiag, m, j, bw, rlo, rhi, gap);
+
+		if(dist == nzdist_t::PowerLaw && cap[j]) {
+			// Pareto weights, P(d) ~ d^(-exponent)
+			RandomStream rs(seed, 3ULL * j);
+			w[j] = std::pow(1. - rs.uniform(), -1. / (exponent - 1.));
+		} else {
+			w[j] = static_cast<real_t>(cap[j]);
+		} // dist
+
+		capsum += cap[j];
+		wsum += w[j];
+
+	} // j
+
+	int_t off = static_cast<int_t>(std::min(static_cast<long long int>(nz - nd), capsum));
+
+	//
+	// Column targets t_j = min(cap_j, s * w_j), with s chosen so that they sum to off
+	// Uniform weights never saturate, heavy tails need a search on s
+	//
+	real_t s = (off ? static_cast<real_t>(off) / wsum : 0.);
+
+	if(off && random_fill_sum(n, cap.data(), w.data(), s) < off - 0.5) {
+
+		real_t slo = s;
+		real_t shi = 2 * s;
+		while(random_fill_sum(n, cap.data(), w.data(), shi) < off) {
+			slo = shi;
+			shi *= 2;
+		} // bracket
+
+		for(int it = 0; it < 64; it++) {
+			real_t smid = (slo + shi) / 2;
+			if(random_fill_sum(n, cap.data(), w.data(), smid) < off) slo = smid;
+			else shi = smid;
+		} // bisect
+
+		s = shi;
+
+	} // saturation
+
+	colptr[0] = 0;
+
+	if(exact) {
+
+		//
+		// Cumulative rounding keeps the running total exact,
+		// float leftovers go to the first columns with spare room
+		//
+		real_t acc = 0;
+		int_t used = 0;
+		for(int_t j = 0; j < n; j++) {
+			acc += std::min(static_cast<real_t>(cap[j]), s * w[j]);
+			int_t target = std::min(off, static_cast<int_t>(std::llround(acc)));
+			int_t d = std::min(cap[j], std::max(target - used, int_t(0)));
+			colptr[j+1] = d;
+			used += d;
+		} // j
+
+		for(int_t j = 0; j < n && used < off; j++) {
+			int_t d = std::min(cap[j] - colptr[j+1], off - used);
+			colptr[j+1] += d;
+			used += d;
+		} // j
+
+	} else {
+
+		//
+		// Independent stochastic rounding, nnz matches on average
+		//
+#pragma omp parallel for if(n >= MT_NNZ_THRESHOLD)
+		for(int_t j = 0; j < n; j++) {
+			RandomStream rs(seed, 3ULL * j + 1);
+			real_t t = std::min(static_cast<real_t>(cap[j]), s * w[j]);
+			real_t f = std::floor(t);
+			int_t d = static_cast<int_t>(f) + (rs.uniform() < t - f ? 1 : 0);
+			colptr[j+1] = std::min(cap[j], d);
+		} // j
+
+	} // exact/expected
+
+	for(int_t j = 0; j < nd; j++) {
+		colptr[j+1]++;
+	} // j
+
+	roll(n, colptr);
+
+	return colptr[n];
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void random(prop_t ptype, uplo_t uplo, int_t m, int_t n, int_t nz, int_t bw, unsigned long long seed,
+		typename TypeTraits<T_Scalar>::real_type lo,
+		typename TypeTraits<T_Scalar>::real_type hi,
+		const int_t *colptr, int_t *rowidx, T_Scalar *values)
+{
+	if(!n) return;
+
+	Property prop(ptype, uplo);
+
+	bool skipdiag = (prop.isSkew() || random_forced_diag(prop, m, n));
+	int_t nd = random_diag_count(prop, m, n, nz);
+
+	int_t nparts = num_column_parts(n, colptr);
+	std::vector<int_t> bounds(nparts + 1);
+	partition_columns(n, colptr, nparts, bounds.data());
+
+#pragma omp parallel for schedule(dynamic,1) if(nparts > 1)
+	for(int_t p = 0; p < nparts; p++) {
+		for(int_t j = bounds[p]; j < bounds[p+1]; j++) {
+
+			RandomStream rs(seed, 3ULL * j + 2);
+
+			int_t *ri = rowidx + colptr[j];
+			T_Scalar *vi = values + colptr[j];
+			int_t len = colptr[j+1] - colptr[j];
+			bool diag = (j < nd);
+			int_t k = len - (diag ? 1 : 0);
+
+			int_t rlo, rhi;
+			bool gap;
+			int_t L = random_column_domain(prop, skipdiag, m, j, bw, rlo, rhi, gap);
+
+			random_sample(rs, L, k, ri);
+
+			for(int_t q = 0; q < k; q++) {
+				int_t i = rlo + ri[q];
+				ri[q] = (gap && i >= j ? i + 1 : i);
+			} // q
+
+			if(diag) {
+				int_t pos = static_cast<int_t>(std::lower_bound(ri, ri + k, j) - ri);
+				std::copy_backward(ri + pos, ri + k, ri + k + 1);
+				ri[pos] = j;
+			} // diag
+
+			for(int_t q = 0; q < len; q++) {
+				vi[q] = rand<T_Scalar>(rs, lo, hi);
+				if(ri[q] == j && prop.isHermitian()) {
+					arith::setIm(vi[q], 0);
+				}
+			} // q
+
+		} // j
+	} // p
+}
+/*-------------------------------------------------*/
+#define instantiate_random(T_Scl) \
+template void random(prop_t, uplo_t, int_t, int_t, int_t, int_t, unsigned long long, \
+		typename TypeTraits<T_Scl>::real_type, \
+		typename TypeTraits<T_Scl>::real_type, \
+		const int_t*, int_t*, T_Scl*)
+instantiate_random(real_t    );
+instantiate_random(real4_t   );
+instantiate_random(complex_t );
+instantiate_random(complex8_t);
+#undef instantiate_random
+/*-------------------------------------------------*/
 } // namespace csc
 } // namespace blk
 } // namespace cla3p
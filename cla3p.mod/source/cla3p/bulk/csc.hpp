@@ -31,14 +31,35 @@ namespace blk {
 namespace csc {
 /*-------------------------------------------------*/
 
+//
+// Minimum number of non zeros for multithreaded column sweeps
+//
+constexpr int_t MT_NNZ_THRESHOLD = 16384;
+
 void roll(int_t n, int_t *colptr);
 
 void unroll(int_t n, int_t *colptr);
 
 int_t maxrlen(int_t n, const int_t *colptr);
 
+//
+// Splits columns [0,n) in nparts contiguous ranges [bounds[p],bounds[p+1]) with balanced non zeros
+// bounds(nparts + 1)
+//
+void partition_columns(int_t n, const int_t *colptr, int_t nparts, int_t *bounds);
+
+//
+// Number of column ranges used for multithreaded column sweeps (1 for small matrices)
+//
+int_t num_column_parts(int_t n, const int_t *colptr);
+
 void check(prop_t ptype, uplo_t uplo, int_t m, int_t n, const int_t *colptr, const int_t *rowidx);
 
+//
+// 64-bit fingerprint of the (m x n) sorted pattern and its property, independent of the number of threads
+//
+unsigned long long pattern_hash(prop_t ptype, uplo_t uplo, int_t m, int_t n, const int_t *colptr, const int_t *rowidx);
+
 void sort(int_t n, const int_t *colptr, int_t *rowidx);
 
 template <typename T_Scalar>
@@ -53,6 +74,13 @@ void print(int_t n, const int_t *colptr, const int_t *rowidx, const T_Scalar *va
 	print_to_stream(std::cout, n, colptr, rowidx, values, prec);
 }
 
+void transpose(int_t m, int_t n, const int_t *colptr, const int_t *rowidx, int_t *colptr_out, int_t *rowidx_out);
+
+//
+// Pattern transpose, pos_out(nnz) holds the position of each output entry in the input
+//
+void transpose(int_t m, int_t n, const int_t *colptr, const int_t *rowidx, int_t *colptr_out, int_t *rowidx_out, int_t *pos_out);
+
 template <typename T_Scalar>
 void transpose(int_t m, int_t n, const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
 		int_t *colptr_out, int_t *rowidx_out, T_Scalar *values_out, T_Scalar coeff = 1);
@@ -61,8 +89,36 @@ template <typename T_Scalar>
 void conjugate_transpose(int_t m, int_t n, const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
 		int_t *colptr_out, int_t *rowidx_out, T_Scalar *values_out, T_Scalar coeff = 1);
 
+//
+// Block of rows [ibgn,ibgn+ni) and columns [jbgn,jbgn+nj), row ranges are located with binary search (sorted columns)
+// colptr_out(nj + 1), rowidx_out & values_out sized by colptr_out[nj]
+//
+void block_colptr(int_t ibgn, int_t jbgn, int_t ni, int_t nj, const int_t *colptr, const int_t *rowidx, int_t *colptr_out);
+
+template <typename T_Scalar>
+void block(int_t ibgn, int_t jbgn, int_t ni, int_t nj, const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
+		const int_t *colptr_out, int_t *rowidx_out, T_Scalar *values_out);
+
+//
+// Splits a (m x n) matrix in (nrp x ncp) blocks using row & column boundaries rbounds(nrp + 1) & cbounds(ncp + 1)
+// Block (p,q) is stored at position (p + q * nrp) of the output pointer arrays
+// colptr_out[p + q * nrp] sized (cbounds[q+1] - cbounds[q] + 1), rowidx_out & values_out sized by the last colptr entry
+//
+void partition_colptr(int_t m, int_t n, const int_t *colptr, const int_t *rowidx,
+		int_t nrp, const int_t *rbounds, int_t ncp, const int_t *cbounds, int_t **colptr_out);
+
+template <typename T_Scalar>
+void partition(int_t m, int_t n, const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
+		int_t nrp, const int_t *rbounds, int_t ncp, const int_t *cbounds, 
+		const int_t *const *colptr_out, int_t **rowidx_out, T_Scalar **values_out);
+
 void uplo2ge_colptr(uplo_t uplo, int_t n, const int_t *colptr, const int_t *rowidx, int_t *colptr_out);
 
+//
+// Pattern only expansion of a triangle to both parts, colptr_out(n+1) & rowidx_out sized by uplo2ge_colptr
+//
+void uplo2ge(uplo_t uplo, int_t n, const int_t *colptr, const int_t *rowidx, int_t *colptr_out, int_t *rowidx_out);
+
 template <typename T_Scalar>
 void sy2ge(uplo_t uplo, int_t n, const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
 		int_t *colptr_out, int_t *rowidx_out, T_Scalar *values_out);
@@ -95,6 +151,20 @@ void permute(prop_t ptype, uplo_t uplo, int_t m, int_t n,
 		const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
 		int_t *colptr_out, int_t *rowidx_out, T_Scalar *values_out, const int_t *P, const int_t *Q);
 
+//
+// Random structure generation with reproducible per-column streams, output depends only on seed
+// random_colptr returns the number of non zeros (nz exactly or on average, capped by the admissible positions)
+// bw < 0 disables the band restriction, exponent is only used with nzdist_t::PowerLaw
+//
+int_t random_colptr(prop_t ptype, uplo_t uplo, int_t m, int_t n, int_t nz,
+		nzdist_t dist, int_t bw, real_t exponent, bool exact, unsigned long long seed, int_t *colptr);
+
+template <typename T_Scalar>
+void random(prop_t ptype, uplo_t uplo, int_t m, int_t n, int_t nz, int_t bw, unsigned long long seed,
+		typename TypeTraits<T_Scalar>::real_type lo,
+		typename TypeTraits<T_Scalar>::real_type hi,
+		const int_t *colptr, int_t *rowidx, T_Scalar *values);
+
 /*-------------------------------------------------*/
 } // namespace csc
 } // namespace blk
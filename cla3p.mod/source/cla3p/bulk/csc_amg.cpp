@@ -0,0 +1,514 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/bulk/csc_amg.hpp"
+
+// system
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/bulk/csc.hpp"
+#include "cla3p/bulk/csc_math.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace blk {
+namespace csc {
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static T_Scalar diagonal_entry(int_t j, const int_t *colptr, const int_t *rowidx, const T_Scalar *values)
+{
+	const int_t *it = std::lower_bound(rowidx + colptr[j], rowidx + colptr[j+1], j);
+
+	if(it == rowidx + colptr[j+1] || *it != j)
+		return 0;
+
+	return values[it - rowidx];
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void amg_strength(int_t n, const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
+		typename TypeTraits<T_Scalar>::real_type theta, int_t **colptrS, int_t **rowidxS)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	bool multithreaded = (colptr[n] >= MT_NNZ_THRESHOLD);
+
+	std::vector<T_RScalar> dabs(n);
+
+#pragma omp parallel for if(multithreaded)
+	for(int_t j = 0; j < n; j++) {
+		dabs[j] = std::abs(diagonal_entry(j, colptr, rowidx, values));
+	} // j
+
+	T_RScalar theta2 = theta * theta;
+
+	auto strong = [&](int_t i, int_t j, T_Scalar aij) {
+		return (i != j && std::norm(aij) >= theta2 * dabs[i] * dabs[j] && aij != T_Scalar(0));
+	};
+
+	//
+	// One sided graph
+	//
+
+	std::vector<int_t> colptrC(n + 1, 0);
+
+#pragma omp parallel for if(multithreaded)
+	for(int_t j = 0; j < n; j++) {
+		int_t cnt = 0;
+		for(int_t irow = colptr[j]; irow < colptr[j+1]; irow++) {
+			if(strong(rowidx[irow], j, values[irow])) cnt++;
+		} // irow
+		colptrC[j+1] = cnt;
+	} // j
+
+	roll(n, colptrC.data());
+
+	std::vector<int_t> rowidxC(colptrC[n]);
+
+#pragma omp parallel for if(multithreaded)
+	for(int_t j = 0; j < n; j++) {
+		int_t pos = colptrC[j];
+		for(int_t irow = colptr[j]; irow < colptr[j+1]; irow++) {
+			if(strong(rowidx[irow], j, values[irow])) rowidxC[pos++] = rowidx[irow];
+		} // irow
+	} // j
+
+	//
+	// Symmetrize
+	//
+
+	std::vector<int_t> colptrT(n + 1);
+	std::vector<int_t> rowidxT(colptrC[n]);
+
+	transpose(n, n, colptrC.data(), rowidxC.data(), colptrT.data(), rowidxT.data());
+
+	add_symbolic(n, colptrC.data(), rowidxC.data(), colptrT.data(), rowidxT.data(), colptrS, rowidxS);
+}
+/*-------------------------------------------------*/
+#define instantiate_amg_strength(T_Scl) \
+template void amg_strength(int_t, const int_t*, const int_t*, const T_Scl*, \
+		typename TypeTraits<T_Scl>::real_type, int_t**, int_t**)
+instantiate_amg_strength(real_t);
+instantiate_amg_strength(real4_t);
+instantiate_amg_strength(complex_t);
+instantiate_amg_strength(complex8_t);
+#undef instantiate_amg_strength
+/*-------------------------------------------------*/
+//
+// Greedy aggregation of nodes [lo,hi), neighbors outside the range are ignored
+// Aggregates are numbered locally from zero, returns their number
+//
+static int_t aggregate_range(int_t lo, int_t hi, const int_t *colptrS, const int_t *rowidxS, int_t *agg, int_t *tmp)
+{
+	const int_t unset = -2;
+	const int_t isolated = -1;
+
+	int_t nagg = 0;
+
+	//
+	// Pass 1: nodes with all neighbors free form aggregates with them
+	//
+
+	for(int_t i = lo; i < hi; i++) {
+
+		if(agg[i] != unset) continue;
+
+		if(colptrS[i] == colptrS[i+1]) {
+			agg[i] = isolated;
+			continue;
+		} // no strong connections
+
+		bool free = true;
+		for(int_t irow = colptrS[i]; irow < colptrS[i+1] && free; irow++) {
+			int_t j = rowidxS[irow];
+			if(j >= lo && j < hi && agg[j] != unset) free = false;
+		} // irow
+
+		if(!free) continue;
+
+		agg[i] = nagg;
+		for(int_t irow = colptrS[i]; irow < colptrS[i+1]; irow++) {
+			int_t j = rowidxS[irow];
+			if(j >= lo && j < hi) agg[j] = nagg;
+		} // irow
+
+		nagg++;
+
+	} // i
+
+	//
+	// Pass 2: remaining nodes join a neighboring aggregate of pass 1
+	//
+
+	for(int_t i = lo; i < hi; i++) {
+
+		tmp[i] = agg[i];
+
+		if(agg[i] != unset) continue;
+
+		for(int_t irow = colptrS[i]; irow < colptrS[i+1]; irow++) {
+			int_t j = rowidxS[irow];
+			if(j >= lo && j < hi && agg[j] >= 0) {
+				tmp[i] = agg[j];
+				break;
+			} // join
+		} // irow
+
+	} // i
+
+	std::copy(tmp + lo, tmp + hi, agg + lo);
+
+	//
+	// Pass 3: leftovers form aggregates with their free neighbors
+	//
+
+	for(int_t i = lo; i < hi; i++) {
+
+		if(agg[i] != unset) continue;
+
+		agg[i] = nagg;
+		for(int_t irow = colptrS[i]; irow < colptrS[i+1]; irow++) {
+			int_t j = rowidxS[irow];
+			if(j >= lo && j < hi && agg[j] == unset) agg[j] = nagg;
+		} // irow
+
+		nagg++;
+
+	} // i
+
+	return nagg;
+}
+/*-------------------------------------------------*/
+int_t amg_aggregate(int_t n, const int_t *colptrS, const int_t *rowidxS, int_t *agg)
+{
+	int_t nparts = num_column_parts(n, colptrS);
+	std::vector<int_t> bounds(nparts + 1);
+	partition_columns(n, colptrS, nparts, bounds.data());
+
+	std::vector<int_t> offsets(nparts + 1, 0);
+	std::vector<int_t> tmp(n);
+
+	std::fill(agg, agg + n, -2);
+
+#pragma omp parallel for schedule(dynamic,1) if(nparts > 1)
+	for(int_t p = 0; p < nparts; p++) {
+		offsets[p+1] = aggregate_range(bounds[p], bounds[p+1], colptrS, rowidxS, agg, tmp.data());
+	} // p
+
+	for(int_t p = 0; p < nparts; p++) {
+		offsets[p+1] += offsets[p];
+	} // p
+
+#pragma omp parallel for schedule(dynamic,1) if(nparts > 1)
+	for(int_t p = 0; p < nparts; p++) {
+		for(int_t i = bounds[p]; i < bounds[p+1]; i++) {
+			if(agg[i] >= 0) agg[i] += offsets[p];
+		} // i
+	} // p
+
+	return offsets[nparts];
+}
+/*-------------------------------------------------*/
+void amg_tentative_colptr(int_t n, int_t nagg, const int_t *agg, int_t *colptrP)
+{
+	std::fill(colptrP, colptrP + nagg + 1, 0);
+
+	for(int_t i = 0; i < n; i++) {
+		if(agg[i] >= 0) colptrP[agg[i] + 1]++;
+	} // i
+
+	roll(nagg, colptrP);
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void amg_tentative(int_t n, int_t nagg, const int_t *agg, const int_t *colptrP, int_t *rowidxP, T_Scalar *valuesP)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	std::vector<int_t> pos(colptrP, colptrP + nagg);
+
+	for(int_t i = 0; i < n; i++) {
+		if(agg[i] >= 0) rowidxP[pos[agg[i]]++] = i;
+	} // i
+
+	for(int_t a = 0; a < nagg; a++) {
+		T_RScalar scale = T_RScalar(1) / std::sqrt(static_cast<T_RScalar>(colptrP[a+1] - colptrP[a]));
+		std::fill(valuesP + colptrP[a], valuesP + colptrP[a+1], T_Scalar(scale));
+	} // a
+}
+/*-------------------------------------------------*/
+#define instantiate_amg_tentative(T_Scl) \
+template void amg_tentative(int_t, int_t, const int_t*, const int_t*, int_t*, T_Scl*)
+instantiate_amg_tentative(real_t);
+instantiate_amg_tentative(real4_t);
+instantiate_amg_tentative(complex_t);
+instantiate_amg_tentative(complex8_t);
+#undef instantiate_amg_tentative
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void amg_diagonal(int_t n, const int_t *colptr, const int_t *rowidx, const T_Scalar *values, T_Scalar *diag)
+{
+	int_t nzeros = 0;
+
+#pragma omp parallel for reduction(+:nzeros) if(colptr[n] >= MT_NNZ_THRESHOLD)
+	for(int_t j = 0; j < n; j++) {
+		diag[j] = diagonal_entry(j, colptr, rowidx, values);
+		if(diag[j] == T_Scalar(0)) nzeros++;
+	} // j
+
+	if(nzeros) {
+		throw err::InvalidOp(msg::DivisionByZero());
+	}
+}
+/*-------------------------------------------------*/
+#define instantiate_amg_diagonal(T_Scl) \
+template void amg_diagonal(int_t, const int_t*, const int_t*, const T_Scl*, T_Scl*)
+instantiate_amg_diagonal(real_t);
+instantiate_amg_diagonal(real4_t);
+instantiate_amg_diagonal(complex_t);
+instantiate_amg_diagonal(complex8_t);
+#undef instantiate_amg_diagonal
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+typename TypeTraits<T_Scalar>::real_type 
+amg_rho_bound(int_t n, const int_t *rowptr, const T_Scalar *values, const T_Scalar *diag)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	T_RScalar ret = 0;
+
+#pragma omp parallel for reduction(max:ret) if(rowptr[n] >= MT_NNZ_THRESHOLD)
+	for(int_t i = 0; i < n; i++) {
+		T_RScalar sum = 0;
+		for(int_t k = rowptr[i]; k < rowptr[i+1]; k++) {
+			sum += std::abs(values[k]);
+		} // k
+		ret = std::max(ret, sum / std::abs(diag[i]));
+	} // i
+
+	return ret;
+}
+/*-------------------------------------------------*/
+#define instantiate_amg_rho_bound(T_Scl) \
+template typename TypeTraits<T_Scl>::real_type \
+amg_rho_bound(int_t, const int_t*, const T_Scl*, const T_Scl*)
+instantiate_amg_rho_bound(real_t);
+instantiate_amg_rho_bound(real4_t);
+instantiate_amg_rho_bound(complex_t);
+instantiate_amg_rho_bound(complex8_t);
+#undef instantiate_amg_rho_bound
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void amg_jacobi_operator(int_t n, const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
+		const T_Scalar *diag, typename TypeTraits<T_Scalar>::real_type omega,
+		const int_t *colptrS, const int_t *rowidxS, T_Scalar *valuesS)
+{
+#pragma omp parallel for schedule(dynamic,256) if(colptrS[n] >= MT_NNZ_THRESHOLD)
+	for(int_t j = 0; j < n; j++) {
+
+		int_t irowS = colptrS[j];
+
+		for(int_t irow = colptrS[j]; irow < colptrS[j+1]; irow++) {
+			valuesS[irow] = (rowidxS[irow] == j ? T_Scalar(1) : T_Scalar(0));
+		} // irow
+
+		for(int_t irow = colptr[j]; irow < colptr[j+1]; irow++) {
+			int_t i = rowidx[irow];
+			while(rowidxS[irowS] < i) irowS++;
+			valuesS[irowS] -= omega * values[irow] / diag[i];
+		} // irow
+
+	} // j
+}
+/*-------------------------------------------------*/
+#define instantiate_amg_jacobi_operator(T_Scl) \
+template void amg_jacobi_operator(int_t, const int_t*, const int_t*, const T_Scl*, \
+		const T_Scl*, typename TypeTraits<T_Scl>::real_type, \
+		const int_t*, const int_t*, T_Scl*)
+instantiate_amg_jacobi_operator(real_t);
+instantiate_amg_jacobi_operator(real4_t);
+instantiate_amg_jacobi_operator(complex_t);
+instantiate_amg_jacobi_operator(complex8_t);
+#undef instantiate_amg_jacobi_operator
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void amg_residual(int_t n, const int_t *rowptr, const int_t *colidx, const T_Scalar *values,
+		const T_Scalar *b, const T_Scalar *x, T_Scalar *r)
+{
+#pragma omp parallel for schedule(static) if(rowptr[n] >= MT_NNZ_THRESHOLD)
+	for(int_t i = 0; i < n; i++) {
+		T_Scalar sum = b[i];
+		for(int_t k = rowptr[i]; k < rowptr[i+1]; k++) {
+			sum -= values[k] * x[colidx[k]];
+		} // k
+		r[i] = sum;
+	} // i
+}
+/*-------------------------------------------------*/
+#define instantiate_amg_residual(T_Scl) \
+template void amg_residual(int_t, const int_t*, const int_t*, const T_Scl*, \
+		const T_Scl*, const T_Scl*, T_Scl*)
+instantiate_amg_residual(real_t);
+instantiate_amg_residual(real4_t);
+instantiate_amg_residual(complex_t);
+instantiate_amg_residual(complex8_t);
+#undef instantiate_amg_residual
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void amg_jacobi(int_t n, const int_t *rowptr, const int_t *colidx, const T_Scalar *values,
+		const T_Scalar *diag, typename TypeTraits<T_Scalar>::real_type omega, int_t nsweeps,
+		const T_Scalar *b, T_Scalar *x, T_Scalar *work)
+{
+	for(int_t s = 0; s < nsweeps; s++) {
+
+		amg_residual(n, rowptr, colidx, values, b, x, work);
+
+#pragma omp parallel for schedule(static) if(n >= MT_NNZ_THRESHOLD)
+		for(int_t i = 0; i < n; i++) {
+			x[i] += omega * work[i] / diag[i];
+		} // i
+
+	} // s
+}
+/*-------------------------------------------------*/
+#define instantiate_amg_jacobi(T_Scl) \
+template void amg_jacobi(int_t, const int_t*, const int_t*, const T_Scl*, \
+		const T_Scl*, typename TypeTraits<T_Scl>::real_type, int_t, \
+		const T_Scl*, T_Scl*, T_Scl*)
+instantiate_amg_jacobi(real_t);
+instantiate_amg_jacobi(real4_t);
+instantiate_amg_jacobi(complex_t);
+instantiate_amg_jacobi(complex8_t);
+#undef instantiate_amg_jacobi
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void amg_gauss_seidel(int_t n, const int_t *rowptr, const int_t *colidx, const T_Scalar *values,
+		const T_Scalar *diag, bool backward, int_t nsweeps, int_t nparts, const int_t *bounds,
+		const T_Scalar *b, T_Scalar *x, T_Scalar *work)
+{
+	for(int_t s = 0; s < nsweeps; s++) {
+
+		if(nparts > 1) {
+			std::copy(x, x + n, work);
+		} // values across ranges
+
+#pragma omp parallel for schedule(dynamic,1) if(nparts > 1)
+		for(int_t p = 0; p < nparts; p++) {
+
+			int_t lo = bounds[p];
+			int_t hi = bounds[p+1];
+
+			for(int_t t = lo; t < hi; t++) {
+
+				int_t i = (backward ? hi - 1 - (t - lo) : t);
+				T_Scalar sum = b[i];
+
+				for(int_t k = rowptr[i]; k < rowptr[i+1]; k++) {
+					int_t j = colidx[k];
+					if(j == i) continue;
+					sum -= values[k] * (j >= lo && j < hi ? x[j] : work[j]);
+				} // k
+
+				x[i] = sum / diag[i];
+
+			} // t
+
+		} // p
+
+	} // s
+}
+/*-------------------------------------------------*/
+#define instantiate_amg_gauss_seidel(T_Scl) \
+template void amg_gauss_seidel(int_t, const int_t*, const int_t*, const T_Scl*, \
+		const T_Scl*, bool, int_t, int_t, const int_t*, \
+		const T_Scl*, T_Scl*, T_Scl*)
+instantiate_amg_gauss_seidel(real_t);
+instantiate_amg_gauss_seidel(real4_t);
+instantiate_amg_gauss_seidel(complex_t);
+instantiate_amg_gauss_seidel(complex8_t);
+#undef instantiate_amg_gauss_seidel
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void amg_chebyshev(int_t n, const int_t *rowptr, const int_t *colidx, const T_Scalar *values,
+		const T_Scalar *diag, typename TypeTraits<T_Scalar>::real_type lmin, typename TypeTraits<T_Scalar>::real_type lmax, 
+		int_t degree, const T_Scalar *b, T_Scalar *x, T_Scalar *work)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	bool multithreaded = (n >= MT_NNZ_THRESHOLD);
+
+	T_Scalar *r = work;
+	T_Scalar *d = work + n;
+
+	T_RScalar theta = (lmax + lmin) / 2;
+	T_RScalar delta = (lmax - lmin) / 2;
+	T_RScalar sigma = theta / delta;
+	T_RScalar rho = 1 / sigma;
+
+	amg_residual(n, rowptr, colidx, values, b, x, r);
+
+#pragma omp parallel for schedule(static) if(multithreaded)
+	for(int_t i = 0; i < n; i++) {
+		d[i] = r[i] / (theta * diag[i]);
+	} // i
+
+	for(int_t k = 0; k < degree; k++) {
+
+#pragma omp parallel for schedule(static) if(multithreaded)
+		for(int_t i = 0; i < n; i++) {
+			x[i] += d[i];
+		} // i
+
+		if(k == degree - 1) break;
+
+		amg_residual(n, rowptr, colidx, values, b, x, r);
+
+		T_RScalar rhoNew = 1 / (2 * sigma - rho);
+		T_RScalar c1 = rhoNew * rho;
+		T_RScalar c2 = 2 * rhoNew / delta;
+		rho = rhoNew;
+
+#pragma omp parallel for schedule(static) if(multithreaded)
+		for(int_t i = 0; i < n; i++) {
+			d[i] = c1 * d[i] + c2 * r[i] / diag[i];
+		} // i
+
+	} // k
+}
+/*-------------------------------------------------*/
+#define instantiate_amg_chebyshev(T_Scl) \
+template void amg_chebyshev(int_t, const int_t*, const int_t*, const T_Scl*, \
+		const T_Scl*, typename TypeTraits<T_Scl>::real_type, typename TypeTraits<T_Scl>::real_type, \
+		int_t, const T_Scl*, T_Scl*, T_Scl*)
+instantiate_amg_chebyshev(real_t);
+instantiate_amg_chebyshev(real4_t);
+instantiate_amg_chebyshev(complex_t);
+instantiate_amg_chebyshev(complex8_t);
+#undef instantiate_amg_chebyshev
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace blk
+} // namespace cla3p
+/*-------------------------------------------------*/
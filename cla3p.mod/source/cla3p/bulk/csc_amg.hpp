@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_BULK_CSC_AMG_HPP_
+#define CLA3P_BULK_CSC_AMG_HPP_
+
+/**
+ * @file
+ */
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace blk {
+namespace csc {
+/*-------------------------------------------------*/
+
+//
+// Smoothed aggregation multigrid kernels, A(n x n) general with sorted columns
+// Row-wise kernels take the transpose of A in csc form (rowptr, colidx, values), so that row i of A is column i
+//
+
+//
+// Symmetrized strength of connection graph without the diagonal:
+//   i,j strongly connected if |a_ij| >= theta * sqrt(|a_ii * a_jj|) or |a_ji| >= theta * sqrt(|a_ii * a_jj|)
+// Allocates colptrS & rowidxS
+//
+template <typename T_Scalar>
+void amg_strength(int_t n, const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
+		typename TypeTraits<T_Scalar>::real_type theta, int_t **colptrS, int_t **rowidxS);
+
+//
+// Greedy aggregation of the strength graph, decoupled in contiguous node ranges aggregated in parallel
+// On exit agg(n) holds the aggregate of each node (-1 for isolated nodes)
+// Returns the number of aggregates
+//
+int_t amg_aggregate(int_t n, const int_t *colptrS, const int_t *rowidxS, int_t *agg);
+
+//
+// Tentative prolongator P(n x nagg) for the constant near null space, columns normalized
+// colptrP(nagg+1), rowidxP & valuesP sized by the number of aggregated nodes
+//
+void amg_tentative_colptr(int_t n, int_t nagg, const int_t *agg, int_t *colptrP);
+
+template <typename T_Scalar>
+void amg_tentative(int_t n, int_t nagg, const int_t *agg, const int_t *colptrP, int_t *rowidxP, T_Scalar *valuesP);
+
+//
+// Diagonal of A, throws on zero entries
+//
+template <typename T_Scalar>
+void amg_diagonal(int_t n, const int_t *colptr, const int_t *rowidx, const T_Scalar *values, T_Scalar *diag);
+
+//
+// Gershgorin bound of the spectral radius of inv(D) * A
+//
+template <typename T_Scalar>
+typename TypeTraits<T_Scalar>::real_type 
+amg_rho_bound(int_t n, const int_t *rowptr, const T_Scalar *values, const T_Scalar *diag);
+
+//
+// Jacobi smoothing operator S = I - omega * inv(D) * A on the pattern of (A + I)
+//
+template <typename T_Scalar>
+void amg_jacobi_operator(int_t n, const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
+		const T_Scalar *diag, typename TypeTraits<T_Scalar>::real_type omega,
+		const int_t *colptrS, const int_t *rowidxS, T_Scalar *valuesS);
+
+//
+// Residual r = b - A * x
+//
+template <typename T_Scalar>
+void amg_residual(int_t n, const int_t *rowptr, const int_t *colidx, const T_Scalar *values,
+		const T_Scalar *b, const T_Scalar *x, T_Scalar *r);
+
+//
+// Damped Jacobi sweeps, work(n)
+//
+template <typename T_Scalar>
+void amg_jacobi(int_t n, const int_t *rowptr, const int_t *colidx, const T_Scalar *values,
+		const T_Scalar *diag, typename TypeTraits<T_Scalar>::real_type omega, int_t nsweeps,
+		const T_Scalar *b, T_Scalar *x, T_Scalar *work);
+
+//
+// Hybrid Gauss-Seidel sweeps, Gauss-Seidel within the row ranges [bounds[p],bounds[p+1]) and Jacobi across them
+// Row ranges are swept in parallel, backward sweeps visit rows in reverse order, work(n)
+//
+template <typename T_Scalar>
+void amg_gauss_seidel(int_t n, const int_t *rowptr, const int_t *colidx, const T_Scalar *values,
+		const T_Scalar *diag, bool backward, int_t nsweeps, int_t nparts, const int_t *bounds,
+		const T_Scalar *b, T_Scalar *x, T_Scalar *work);
+
+//
+// Chebyshev polynomial smoother of given degree for inv(D) * A with eigenvalues in [lmin,lmax], work(2*n)
+//
+template <typename T_Scalar>
+void amg_chebyshev(int_t n, const int_t *rowptr, const int_t *colidx, const T_Scalar *values,
+		const T_Scalar *diag, typename TypeTraits<T_Scalar>::real_type lmin, typename TypeTraits<T_Scalar>::real_type lmax, 
+		int_t degree, const T_Scalar *b, T_Scalar *x, T_Scalar *work);
+
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace blk
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_BULK_CSC_AMG_HPP_
@@ -0,0 +1,497 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/bulk/csc_ilu.hpp"
+
+// system
+#include <cmath>
+#include <vector>
+#include <queue>
+#include <functional>
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/bulk/csc.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace blk {
+namespace csc {
+/*-------------------------------------------------*/
+using MinHeap = std::priority_queue<int_t, std::vector<int_t>, std::greater<int_t> >;
+/*-------------------------------------------------*/
+static void export_indices(const std::vector<int_t>& colptr, const std::vector<int_t>& rowidx, int_t **colptr_out, int_t **rowidx_out)
+{
+	int_t *cptr = i_malloc<int_t>(colptr.size());
+	int_t *ridx = i_malloc<int_t>(rowidx.size());
+
+	std::copy(colptr.begin(), colptr.end(), cptr);
+	std::copy(rowidx.begin(), rowidx.end(), ridx);
+
+	*colptr_out = cptr;
+	*rowidx_out = ridx;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static void export_values(const std::vector<T_Scalar>& values, T_Scalar **values_out)
+{
+	T_Scalar *vals = i_malloc<T_Scalar>(values.size());
+
+	std::copy(values.begin(), values.end(), vals);
+
+	*values_out = vals;
+}
+/*-------------------------------------------------*/
+void ilu_symbolic(int_t n, const int_t *colptr, const int_t *rowidx, int_t level,
+		int_t **colptrL, int_t **rowidxL, int_t **colptrU, int_t **rowidxU)
+{
+	std::vector<int_t> cptrL(n + 1);
+	std::vector<int_t> cptrU(n + 1);
+	std::vector<int_t> ridxL;
+	std::vector<int_t> ridxU;
+	std::vector<int_t> levL;
+
+	ridxL.reserve(colptr[n] + n);
+	ridxU.reserve(colptr[n] + n);
+	levL.reserve(colptr[n] + n);
+
+	std::vector<int_t> mark(n, -1);
+	std::vector<int_t> lev(n);
+	std::vector<int_t> list;
+	MinHeap heap;
+
+	cptrL[0] = 0;
+	cptrU[0] = 0;
+
+	for(int_t j = 0; j < n; j++) {
+
+		list.clear();
+
+		for(int_t irow = colptr[j]; irow < colptr[j+1]; irow++) {
+			int_t i = rowidx[irow];
+			mark[i] = j;
+			lev[i] = 0;
+			list.push_back(i);
+			if(i < j) heap.push(i);
+		} // irow
+
+		if(mark[j] != j) {
+			mark[j] = j;
+			lev[j] = 0;
+			list.push_back(j);
+		} // diagonal
+
+		//
+		// Fill caused by L(:,k), k in ascending order, lev(i,j) = min(lev(i,j), lev(i,k) + lev(k,j) + 1)
+		//
+
+		while(!heap.empty()) {
+
+			int_t k = heap.top();
+			heap.pop();
+
+			for(int_t q = cptrL[k] + 1; q < cptrL[k+1]; q++) {
+
+				int_t i = ridxL[q];
+				int_t l = lev[k] + levL[q] + 1;
+
+				if(l > level) continue;
+
+				if(mark[i] != j) {
+					mark[i] = j;
+					lev[i] = l;
+					list.push_back(i);
+					if(i < j) heap.push(i);
+				} else {
+					lev[i] = std::min(lev[i], l);
+				} // fill/update
+
+			} // q
+		} // heap
+
+		std::sort(list.begin(), list.end());
+
+		for(int_t i : list) {
+			if(i <= j) {
+				ridxU.push_back(i);
+			} // upper & diagonal
+			if(i >= j) {
+				ridxL.push_back(i);
+				levL.push_back(lev[i]);
+			} // diagonal & lower
+		} // i
+
+		cptrL[j+1] = static_cast<int_t>(ridxL.size());
+		cptrU[j+1] = static_cast<int_t>(ridxU.size());
+
+	} // j
+
+	export_indices(cptrL, ridxL, colptrL, rowidxL);
+	export_indices(cptrU, ridxU, colptrU, rowidxU);
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void ilu_numeric(int_t n, const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
+		const int_t *colptrL, const int_t *rowidxL, T_Scalar *valuesL,
+		const int_t *colptrU, const int_t *rowidxU, T_Scalar *valuesU,
+		int_t nlevels, const int_t *levptr, const int_t *order)
+{
+	//
+	// Each level ends with a barrier, so levels need to be wide enough to pay off
+	//
+	bool multithreaded = (colptrL[n] + colptrU[n] >= MT_NNZ_THRESHOLD && n >= 64 * nlevels);
+
+	int_t nzeros = 0;
+
+#pragma omp parallel if(multithreaded)
+	{
+		std::vector<T_Scalar> w(n);
+		std::vector<int_t> mark(n, -1);
+
+		for(int_t l = 0; l < nlevels; l++) {
+
+#pragma omp for schedule(dynamic,16) reduction(+:nzeros)
+			for(int_t p = levptr[l]; p < levptr[l+1]; p++) {
+
+				int_t j = order[p];
+
+				//
+				// Scatter A(:,j) on the pattern of the factors
+				//
+
+				for(int_t irow = colptrU[j]; irow < colptrU[j+1]; irow++) {
+					mark[rowidxU[irow]] = j;
+					w[rowidxU[irow]] = 0;
+				} // irow
+
+				for(int_t irow = colptrL[j]; irow < colptrL[j+1]; irow++) {
+					mark[rowidxL[irow]] = j;
+					w[rowidxL[irow]] = 0;
+				} // irow
+
+				for(int_t irow = colptr[j]; irow < colptr[j+1]; irow++) {
+					int_t i = rowidx[irow];
+					if(mark[i] == j) w[i] = values[irow];
+				} // irow
+
+				//
+				// Left looking updates with the finished columns of L
+				//
+
+				int_t idiag = colptrU[j+1] - 1;
+
+				for(int_t irow = colptrU[j]; irow < idiag; irow++) {
+
+					int_t k = rowidxU[irow];
+					T_Scalar ukj = w[k];
+					valuesU[irow] = ukj;
+
+					if(ukj == T_Scalar(0)) continue;
+
+					for(int_t q = colptrL[k] + 1; q < colptrL[k+1]; q++) {
+						int_t i = rowidxL[q];
+						if(mark[i] == j) w[i] -= valuesL[q] * ukj;
+					} // q
+
+				} // irow
+
+				T_Scalar ujj = w[j];
+				valuesU[idiag] = ujj;
+				valuesL[colptrL[j]] = 1;
+
+				if(ujj == T_Scalar(0)) {
+					nzeros++;
+					continue;
+				} // zero pivot
+
+				for(int_t irow = colptrL[j] + 1; irow < colptrL[j+1]; irow++) {
+					valuesL[irow] = w[rowidxL[irow]] / ujj;
+				} // irow
+
+			} // p
+
+		} // l
+	} // omp parallel
+
+	if(nzeros) {
+		throw err::InvalidOp(msg::DivisionByZero());
+	}
+}
+/*-------------------------------------------------*/
+#define instantiate_ilu_numeric(T_Scl) \
+template void ilu_numeric(int_t, const int_t*, const int_t*, const T_Scl*, \
+		const int_t*, const int_t*, T_Scl*, \
+		const int_t*, const int_t*, T_Scl*, \
+		int_t, const int_t*, const int_t*)
+instantiate_ilu_numeric(real_t);
+instantiate_ilu_numeric(real4_t);
+instantiate_ilu_numeric(complex_t);
+instantiate_ilu_numeric(complex8_t);
+#undef instantiate_ilu_numeric
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void ilut(int_t n, const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
+		typename TypeTraits<T_Scalar>::real_type droptol, int_t maxfill,
+		int_t **colptrL, int_t **rowidxL, T_Scalar **valuesL,
+		int_t **colptrU, int_t **rowidxU, T_Scalar **valuesU)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	std::vector<int_t> cptrL(n + 1);
+	std::vector<int_t> cptrU(n + 1);
+	std::vector<int_t> ridxL;
+	std::vector<int_t> ridxU;
+	std::vector<T_Scalar> valsL;
+	std::vector<T_Scalar> valsU;
+
+	ridxL.reserve(colptr[n] + n);
+	ridxU.reserve(colptr[n] + n);
+	valsL.reserve(colptr[n] + n);
+	valsU.reserve(colptr[n] + n);
+
+	std::vector<T_Scalar> w(n);
+	std::vector<int_t> mark(n, -1);
+	std::vector<int_t> list;
+	std::vector<int_t> upper;
+	std::vector<int_t> lower;
+	MinHeap heap;
+
+	auto larger = [&w](int_t i1, int_t i2) { return std::abs(w[i1]) > std::abs(w[i2]); };
+
+	cptrL[0] = 0;
+	cptrU[0] = 0;
+
+	for(int_t j = 0; j < n; j++) {
+
+		list.clear();
+		upper.clear();
+		lower.clear();
+
+		T_RScalar nrm = 0;
+
+		for(int_t irow = colptr[j]; irow < colptr[j+1]; irow++) {
+			int_t i = rowidx[irow];
+			mark[i] = j;
+			w[i] = values[irow];
+			list.push_back(i);
+			nrm += std::norm(values[irow]);
+			if(i < j) heap.push(i);
+		} // irow
+
+		if(mark[j] != j) {
+			mark[j] = j;
+			w[j] = 0;
+			list.push_back(j);
+		} // diagonal
+
+		T_RScalar thres = droptol * std::sqrt(nrm);
+
+		//
+		// Left looking updates with the finished columns of L, small multipliers are dropped
+		//
+
+		while(!heap.empty()) {
+
+			int_t k = heap.top();
+			heap.pop();
+
+			T_Scalar ukj = w[k];
+
+			if(std::abs(ukj) <= thres) {
+				w[k] = 0;
+				continue;
+			} // drop
+
+			for(int_t q = cptrL[k] + 1; q < cptrL[k+1]; q++) {
+
+				int_t i = ridxL[q];
+
+				if(mark[i] != j) {
+					mark[i] = j;
+					w[i] = 0;
+					list.push_back(i);
+					if(i < j) heap.push(i);
+				} // fill
+
+				w[i] -= valsL[q] * ukj;
+
+			} // q
+		} // heap
+
+		for(int_t i : list) {
+			if(i < j && w[i] != T_Scalar(0)) upper.push_back(i);
+			if(i > j && std::abs(w[i]) > thres) lower.push_back(i);
+		} // i
+
+		if(maxfill >= 0 && static_cast<int_t>(upper.size()) > maxfill) {
+			std::nth_element(upper.begin(), upper.begin() + maxfill, upper.end(), larger);
+			upper.resize(maxfill);
+		} // keep largest
+
+		if(maxfill >= 0 && static_cast<int_t>(lower.size()) > maxfill) {
+			std::nth_element(lower.begin(), lower.begin() + maxfill, lower.end(), larger);
+			lower.resize(maxfill);
+		} // keep largest
+
+		std::sort(upper.begin(), upper.end());
+		std::sort(lower.begin(), lower.end());
+
+		T_Scalar ujj = w[j];
+
+		if(ujj == T_Scalar(0)) {
+			throw err::InvalidOp(msg::DivisionByZero());
+		} // zero pivot
+
+		for(int_t i : upper) {
+			ridxU.push_back(i);
+			valsU.push_back(w[i]);
+		} // i
+
+		ridxU.push_back(j);
+		valsU.push_back(ujj);
+
+		ridxL.push_back(j);
+		valsL.push_back(1);
+
+		for(int_t i : lower) {
+			ridxL.push_back(i);
+			valsL.push_back(w[i] / ujj);
+		} // i
+
+		cptrL[j+1] = static_cast<int_t>(ridxL.size());
+		cptrU[j+1] = static_cast<int_t>(ridxU.size());
+
+	} // j
+
+	export_indices(cptrL, ridxL, colptrL, rowidxL);
+	export_indices(cptrU, ridxU, colptrU, rowidxU);
+	export_values(valsL, valuesL);
+	export_values(valsU, valuesU);
+}
+/*-------------------------------------------------*/
+#define instantiate_ilut(T_Scl) \
+template void ilut(int_t, const int_t*, const int_t*, const T_Scl*, \
+		typename TypeTraits<T_Scl>::real_type, int_t, \
+		int_t**, int_t**, T_Scl**, \
+		int_t**, int_t**, T_Scl**)
+instantiate_ilut(real_t);
+instantiate_ilut(real4_t);
+instantiate_ilut(complex_t);
+instantiate_ilut(complex8_t);
+#undef instantiate_ilut
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void ic_numeric(int_t n, const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
+		const int_t *colptrU, const int_t *rowidxU, T_Scalar *valuesU,
+		int_t nlevels, const int_t *levptr, const int_t *order)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	//
+	// Each level ends with a barrier, so levels need to be wide enough to pay off
+	//
+	bool multithreaded = (colptrU[n] >= MT_NNZ_THRESHOLD && n >= 64 * nlevels);
+
+	int_t nfails = 0;
+
+#pragma omp parallel if(multithreaded)
+	{
+		std::vector<T_Scalar> w(n);
+		std::vector<int_t> mark(n, -1);
+
+		for(int_t l = 0; l < nlevels; l++) {
+
+#pragma omp for schedule(dynamic,16) reduction(+:nfails)
+			for(int_t p = levptr[l]; p < levptr[l+1]; p++) {
+
+				int_t j = order[p];
+
+				//
+				// Scatter the upper part of A(:,j) on the pattern of U(:,j)
+				//
+
+				for(int_t irow = colptrU[j]; irow < colptrU[j+1]; irow++) {
+					mark[rowidxU[irow]] = j;
+					w[rowidxU[irow]] = 0;
+				} // irow
+
+				for(int_t irow = colptr[j]; irow < colptr[j+1]; irow++) {
+					int_t i = rowidx[irow];
+					if(i <= j && mark[i] == j) w[i] = values[irow];
+				} // irow
+
+				//
+				// U(k,j) = (A(k,j) - U(1:k-1,k)^H * U(1:k-1,j)) / U(k,k)
+				//
+
+				int_t idiag = colptrU[j+1] - 1;
+				T_RScalar d = arith::getRe(w[j]);
+
+				for(int_t irow = colptrU[j]; irow < idiag; irow++) {
+
+					int_t k = rowidxU[irow];
+					int_t kdiag = colptrU[k+1] - 1;
+					T_Scalar sum = w[k];
+
+					for(int_t q = colptrU[k]; q < kdiag; q++) {
+						int_t i = rowidxU[q];
+						if(mark[i] == j) sum -= arith::conj(valuesU[q]) * w[i];
+					} // q
+
+					T_Scalar ukj = sum / valuesU[kdiag];
+					w[k] = ukj;
+					valuesU[irow] = ukj;
+					d -= std::norm(ukj);
+
+				} // irow
+
+				if(d > 0) {
+					valuesU[idiag] = std::sqrt(d);
+				} else {
+					valuesU[idiag] = 1;
+					nfails++;
+				} // pivot
+
+			} // p
+
+		} // l
+	} // omp parallel
+
+	if(nfails) {
+		throw err::InvalidOp(msg::NonPositivePivot());
+	}
+}
+/*-------------------------------------------------*/
+#define instantiate_ic_numeric(T_Scl) \
+template void ic_numeric(int_t, const int_t*, const int_t*, const T_Scl*, \
+		const int_t*, const int_t*, T_Scl*, \
+		int_t, const int_t*, const int_t*)
+instantiate_ic_numeric(real_t);
+instantiate_ic_numeric(real4_t);
+instantiate_ic_numeric(complex_t);
+instantiate_ic_numeric(complex8_t);
+#undef instantiate_ic_numeric
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace blk
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_BULK_CSC_ILU_HPP_
+#define CLA3P_BULK_CSC_ILU_HPP_
+
+/**
+ * @file
+ */
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace blk {
+namespace csc {
+/*-------------------------------------------------*/
+
+//
+// Incomplete factorizations of cscA(n x n) (sorted columns)
+// L is unit lower triangular with the diagonal first in each column
+// U is upper triangular with the diagonal last in each column
+// Entries of A outside the factor patterns are discarded
+//
+
+//
+// Level of fill pattern of ILU(level), level 0 gives the pattern of A (plus the diagonal)
+// Allocates colptrL, rowidxL, colptrU & rowidxU
+//
+void ilu_symbolic(int_t n, const int_t *colptr, const int_t *rowidx, int_t level,
+		int_t **colptrL, int_t **rowidxL, int_t **colptrU, int_t **rowidxU);
+
+//
+// Numeric ILU on the patterns of ilu_symbolic()
+// Columns are grouped in dependency levels levptr(nlevels+1), order(n) (tri_levels() of U^T),
+// columns of the same level are factorized in parallel
+//
+template <typename T_Scalar>
+void ilu_numeric(int_t n, const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
+		const int_t *colptrL, const int_t *rowidxL, T_Scalar *valuesL,
+		const int_t *colptrU, const int_t *rowidxU, T_Scalar *valuesU,
+		int_t nlevels, const int_t *levptr, const int_t *order);
+
+//
+// Threshold ILU, entries smaller than droptol * norm(A(:,j)) are dropped from column j
+// and at most maxfill off diagonal entries are kept in each column of L & U (maxfill < 0 for no limit)
+// Allocates colptrL, rowidxL, valuesL, colptrU, rowidxU & valuesU
+//
+template <typename T_Scalar>
+void ilut(int_t n, const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
+		typename TypeTraits<T_Scalar>::real_type droptol, int_t maxfill,
+		int_t **colptrL, int_t **rowidxL, T_Scalar **valuesL,
+		int_t **colptrU, int_t **rowidxU, T_Scalar **valuesU);
+
+//
+// Numeric IC(0) A = U^H * U on the pattern of U, using the upper part of cscA (symmetric real or hermitian)
+// Dependency levels as in ilu_numeric()
+//
+template <typename T_Scalar>
+void ic_numeric(int_t n, const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
+		const int_t *colptrU, const int_t *rowidxU, T_Scalar *valuesU,
+		int_t nlevels, const int_t *levptr, const int_t *order);
+
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace blk
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_BULK_CSC_ILU_HPP_
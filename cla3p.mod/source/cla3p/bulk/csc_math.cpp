@@ -18,12 +18,17 @@
 #include "cla3p/bulk/csc_math.hpp"
 
 // system
+#include <vector>
+#include <algorithm>
 
 // 3rd
 
 // cla3p
 #include "cla3p/error/exceptions.hpp"
 #include "cla3p/error/literals.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/support/mt.hpp"
+#include "cla3p/bulk/csc.hpp"
 #include "cla3p/proxies/blas_proxy.hpp"
 #if defined(CLA3P_INTEL_MKL)
 #include "cla3p/proxies/mkl_sparse_proxy.hpp"
@@ -36,30 +41,205 @@ namespace cla3p {
 namespace blk {
 namespace csc {
 /*-------------------------------------------------*/
+bool same_pattern(int_t n, 
+		const int_t *colptrA, const int_t *rowidxA, 
+		const int_t *colptrB, const int_t *rowidxB)
+{
+	if(colptrA == colptrB && rowidxA == rowidxB)
+		return true;
+
+	if(!std::equal(colptrA, colptrA + n + 1, colptrB))
+		return false;
+
+	int_t nz = colptrA[n];
+	int_t mismatches = 0;
+
+#pragma omp parallel for schedule(static) reduction(+:mismatches) if(nz >= MT_NNZ_THRESHOLD)
+	for(int_t k = 0; k < nz; k++) {
+		mismatches += (rowidxA[k] != rowidxB[k]);
+	} // k
+
+	return (mismatches == 0);
+}
+/*-------------------------------------------------*/
+bool pattern_includes(int_t n, 
+		const int_t *colptrC, const int_t *rowidxC, 
+		const int_t *colptrA, const int_t *rowidxA)
+{
+	int_t missing = 0;
+
+#pragma omp parallel for schedule(dynamic,256) reduction(+:missing) if(colptrC[n] >= MT_NNZ_THRESHOLD)
+	for(int_t j = 0; j < n; j++) {
+		int_t kc = colptrC[j];
+		for(int_t ka = colptrA[j]; ka < colptrA[j+1]; ka++) {
+			while(kc < colptrC[j+1] && rowidxC[kc] < rowidxA[ka]) kc++;
+			if(kc == colptrC[j+1] || rowidxC[kc] != rowidxA[ka]) {
+				missing++;
+				break;
+			}
+		} // ka
+	} // j
+
+	return (missing == 0);
+}
+/*-------------------------------------------------*/
+//
+// Symbolic pass of the merge: colptrC holds the union column lengths on exit (rolled)
+//
+static void add_colptr(int_t n, 
+		const int_t *colptrA, const int_t *rowidxA, 
+		const int_t *colptrB, const int_t *rowidxB, 
+		int_t *colptrC, bool multithreaded)
+{
+	colptrC[0] = 0;
+
+#pragma omp parallel for schedule(dynamic,256) if(multithreaded)
+	for(int_t j = 0; j < n; j++) {
+		int_t ka = colptrA[j];
+		int_t kb = colptrB[j];
+		int_t cnt = 0;
+		while(ka < colptrA[j+1] && kb < colptrB[j+1]) {
+			int_t ia = rowidxA[ka];
+			int_t ib = rowidxB[kb];
+			ka += (ia <= ib);
+			kb += (ib <= ia);
+			cnt++;
+		} // merge
+		colptrC[j+1] = cnt + (colptrA[j+1] - ka) + (colptrB[j+1] - kb);
+	} // j
+
+	roll(n, colptrC);
+}
+/*-------------------------------------------------*/
+//
+// Numeric pass of the merge: fills rowidxC on the colptrC of add_colptr()
+//
+static void add_rowidx(int_t n, 
+		const int_t *colptrA, const int_t *rowidxA, 
+		const int_t *colptrB, const int_t *rowidxB, 
+		const int_t *colptrC, int_t *rowidxC, bool multithreaded)
+{
+#pragma omp parallel for schedule(dynamic,256) if(multithreaded)
+	for(int_t j = 0; j < n; j++) {
+		std::set_union(
+				rowidxA + colptrA[j], rowidxA + colptrA[j+1],
+				rowidxB + colptrB[j], rowidxB + colptrB[j+1],
+				rowidxC + colptrC[j]);
+	} // j
+}
+/*-------------------------------------------------*/
+void add_symbolic(int_t n,
+		const int_t *colptrA, const int_t *rowidxA,
+		const int_t *colptrB, const int_t *rowidxB,
+		int_t **colptrC, int_t **rowidxC)
+{
+	bool multithreaded = (colptrA[n] + colptrB[n] >= MT_NNZ_THRESHOLD);
+
+	int_t *cptr = i_malloc<int_t>(n + 1);
+
+	add_colptr(n, colptrA, rowidxA, colptrB, rowidxB, cptr, multithreaded);
+
+	int_t *ridx = i_malloc<int_t>(cptr[n]);
+
+	add_rowidx(n, colptrA, rowidxA, colptrB, rowidxB, cptr, ridx, multithreaded);
+
+	*colptrC = cptr;
+	*rowidxC = ridx;
+}
+/*-------------------------------------------------*/
+void add_symbolic(int_t n,
+		const int_t *colptrA, const int_t *rowidxA,
+		const int_t *colptrB, const int_t *rowidxB,
+		std::vector<int_t>& colptrC, std::vector<int_t>& rowidxC)
+{
+	bool multithreaded = (colptrA[n] + colptrB[n] >= MT_NNZ_THRESHOLD);
+
+	colptrC.resize(n + 1);
+
+	add_colptr(n, colptrA, rowidxA, colptrB, rowidxB, colptrC.data(), multithreaded);
+
+	rowidxC.resize(colptrC[n]);
+
+	add_rowidx(n, colptrA, rowidxA, colptrB, rowidxB, colptrC.data(), rowidxC.data(), multithreaded);
+}
+/*-------------------------------------------------*/
 template <typename T_Scalar>
-void add(int_t m, int_t n,
+void add(int_t /*m*/, int_t n,
 		T_Scalar alpha, const int_t *colptrA, const int_t *rowidxA, const T_Scalar *valuesA,
 		T_Scalar beta, const int_t *colptrB, const int_t *rowidxB, const T_Scalar *valuesB,
 		int_t **colptrC, int_t **rowidxC, T_Scalar **valuesC)
 {
-#if defined(CLA3P_INTEL_MKL)
-	// Multiply everything with (1/beta) to calculate
-	// (1/beta)*C = (alpha/beta) * A + B
-	// then scale C to get proper result
-	if(beta != T_Scalar(1)) { alpha = alpha / beta; }
-	mkl::csc_add(m, n, alpha, op_t::N,
-			colptrA, rowidxA, valuesA,
-			colptrB, rowidxB, valuesB,
-			colptrC, rowidxC, valuesC);
-	if(beta != T_Scalar(1)) { blas::scal((*colptrC)[n], beta, *valuesC, 1); }
-#elif defined(CLA3P_ARMPL)
-	armpl::csc_add(m, n,
-			alpha, op_t::N, colptrA, rowidxA, valuesA,
-			beta, op_t::N, colptrB, rowidxB, valuesB,
-			colptrC, rowidxC, valuesC);
-#else
-	throw err::InvalidOp(msg::MissingThirdParty());
-#endif
+	bool multithreaded = (colptrA[n] + colptrB[n] >= MT_NNZ_THRESHOLD);
+
+	int_t *cptr = i_malloc<int_t>(n + 1);
+
+	if(same_pattern(n, colptrA, rowidxA, colptrB, rowidxB)) {
+
+		//
+		// Shared pattern, values only
+		//
+
+		int_t nz = colptrA[n];
+
+		int_t    *ridx = i_malloc<int_t>(nz);
+		T_Scalar *vals = i_malloc<T_Scalar>(nz);
+
+		std::copy(colptrA, colptrA + n + 1, cptr);
+
+#pragma omp parallel for schedule(static) if(multithreaded)
+		for(int_t k = 0; k < nz; k++) {
+			ridx[k] = rowidxA[k];
+			vals[k] = alpha * valuesA[k] + beta * valuesB[k];
+		} // k
+
+		*colptrC = cptr;
+		*rowidxC = ridx;
+		*valuesC = vals;
+
+		return;
+
+	} // same pattern
+
+	add_colptr(n, colptrA, rowidxA, colptrB, rowidxB, cptr, multithreaded);
+
+	int_t nz = cptr[n];
+
+	int_t    *ridx = i_malloc<int_t>(nz);
+	T_Scalar *vals = i_malloc<T_Scalar>(nz);
+
+#pragma omp parallel for schedule(dynamic,256) if(multithreaded)
+	for(int_t j = 0; j < n; j++) {
+		int_t ka = colptrA[j];
+		int_t kb = colptrB[j];
+		int_t kc = cptr[j];
+		while(ka < colptrA[j+1] && kb < colptrB[j+1]) {
+			int_t ia = rowidxA[ka];
+			int_t ib = rowidxB[kb];
+			if(ia < ib) {
+				ridx[kc] = ia;
+				vals[kc] = alpha * valuesA[ka++];
+			} else if(ib < ia) {
+				ridx[kc] = ib;
+				vals[kc] = beta * valuesB[kb++];
+			} else {
+				ridx[kc] = ia;
+				vals[kc] = alpha * valuesA[ka++] + beta * valuesB[kb++];
+			}
+			kc++;
+		} // merge
+		for(; ka < colptrA[j+1]; ka++, kc++) {
+			ridx[kc] = rowidxA[ka];
+			vals[kc] = alpha * valuesA[ka];
+		} // ka
+		for(; kb < colptrB[j+1]; kb++, kc++) {
+			ridx[kc] = rowidxB[kb];
+			vals[kc] = beta * valuesB[kb];
+		} // kb
+	} // j
+
+	*colptrC = cptr;
+	*rowidxC = ridx;
+	*valuesC = vals;
 }
 /*-------------------------------------------------*/
 #define instantiate_add(T_Scl) \
@@ -74,6 +254,39 @@ instantiate_add(complex8_t);
 #undef instantiate_add
 /*-------------------------------------------------*/
 template <typename T_Scalar>
+void add_numeric(int_t n,
+		T_Scalar alpha, const int_t *colptrA, const int_t *rowidxA, const T_Scalar *valuesA,
+		T_Scalar beta, const int_t *colptrB, const int_t *rowidxB, const T_Scalar *valuesB,
+		const int_t *colptrC, const int_t *rowidxC, T_Scalar *valuesC)
+{
+	bool multithreaded = (colptrC[n] >= MT_NNZ_THRESHOLD);
+
+#pragma omp parallel for schedule(dynamic,256) if(multithreaded)
+	for(int_t j = 0; j < n; j++) {
+		int_t ka = colptrA[j];
+		int_t kb = colptrB[j];
+		for(int_t kc = colptrC[j]; kc < colptrC[j+1]; kc++) {
+			int_t i = rowidxC[kc];
+			T_Scalar v = 0;
+			if(ka < colptrA[j+1] && rowidxA[ka] == i) v += alpha * valuesA[ka++];
+			if(kb < colptrB[j+1] && rowidxB[kb] == i) v += beta  * valuesB[kb++];
+			valuesC[kc] = v;
+		} // kc
+	} // j
+}
+/*-------------------------------------------------*/
+#define instantiate_add_numeric(T_Scl) \
+template void add_numeric(int_t, \
+		T_Scl, const int_t*, const int_t*, const T_Scl*, \
+		T_Scl, const int_t*, const int_t*, const T_Scl*, \
+		const int_t*, const int_t*, T_Scl*)
+instantiate_add_numeric(real_t);
+instantiate_add_numeric(real4_t);
+instantiate_add_numeric(complex_t);
+instantiate_add_numeric(complex8_t);
+#undef instantiate_add_numeric
+/*-------------------------------------------------*/
+template <typename T_Scalar>
 void gem_x_vec(op_t opA, int_t m, int_t n, T_Scalar alpha,
 		const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
 		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
@@ -100,6 +313,253 @@ instantiate_gem_x_vec(complex8_t);
 #undef instantiate_gem_x_vec
 /*-------------------------------------------------*/
 template <typename T_Scalar>
+static void scale_vec(int_t n, T_Scalar beta, T_Scalar *y, bool multithreaded)
+{
+	if(beta == T_Scalar(1)) 
+		return;
+
+#pragma omp parallel for schedule(static) if(multithreaded)
+	for(int_t i = 0; i < n; i++) {
+		y[i] = (beta == T_Scalar(0) ? T_Scalar(0) : beta * y[i]);
+	} // i
+}
+/*-------------------------------------------------*/
+/*
+ * Implicit unit values of pattern matrices
+ */
+class UnitValues {
+	public:
+		real4_t operator[](std::size_t) const { return 1; }
+};
+/*-------------------------------------------------*/
+/*
+ * Values (a pointer or UnitValues) are promoted to T_Scalar on load, accumulation takes place in T_Scalar
+ */
+template <typename T_Ptr, typename T_Idx, typename T_Values, typename T_Scalar>
+static void gem_x_vec_kernel(op_t opA, int_t m, int_t n, T_Scalar alpha,
+		const T_Ptr *colptr, const T_Idx *rowidx, T_Values values,
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	bool multithreaded = (static_cast<int_t>(colptr[n]) >= MT_NNZ_THRESHOLD);
+
+	if(opA != op_t::N) {
+
+		//
+		// Column dot products, no write conflicts
+		//
+
+		bool conjop = (opA == op_t::C);
+
+		scale_vec(n, beta, y, multithreaded);
+
+#pragma omp parallel for schedule(dynamic,256) if(multithreaded)
+		for(int_t j = 0; j < n; j++) {
+			T_Scalar sum = 0;
+			for(T_Ptr irow = colptr[j]; irow < colptr[j+1]; irow++) {
+				T_Scalar a = static_cast<T_Scalar>(values[irow]);
+				sum += (conjop ? arith::conj(a) : a) * x[rowidx[irow]];
+			} // irow
+			y[j] += alpha * sum;
+		} // j
+
+		return;
+
+	} // op T/C
+
+	//
+	// Column scatter, serial to avoid write conflicts on y
+	// Callers route threaded op N products to the library or to op T on a transposed copy
+	//
+
+	scale_vec(m, beta, y, multithreaded);
+
+	for(int_t j = 0; j < n; j++) {
+		T_Scalar xj = alpha * x[j];
+		for(T_Ptr irow = colptr[j]; irow < colptr[j+1]; irow++) {
+			y[rowidx[irow]] += static_cast<T_Scalar>(values[irow]) * xj;
+		} // irow
+	} // j
+}
+/*-------------------------------------------------*/
+template <typename T_Ptr, typename T_Idx, typename T_Scalar>
+void gem_x_vec_native(op_t opA, int_t m, int_t n, T_Scalar alpha,
+		const T_Ptr *colptr, const T_Idx *rowidx, const T_Scalar *values,
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	gem_x_vec_kernel(opA, m, n, alpha, colptr, rowidx, values, x, beta, y);
+}
+/*-------------------------------------------------*/
+#define instantiate_gem_x_vec_native(T_Ptr, T_Idx, T_Scl) \
+template void gem_x_vec_native(op_t, int_t, int_t, T_Scl, \
+		const T_Ptr*, const T_Idx*, const T_Scl*, \
+		const T_Scl*, T_Scl, T_Scl*)
+#define instantiate_gem_x_vec_native_all(T_Ptr, T_Idx) \
+instantiate_gem_x_vec_native(T_Ptr, T_Idx, real_t); \
+instantiate_gem_x_vec_native(T_Ptr, T_Idx, real4_t); \
+instantiate_gem_x_vec_native(T_Ptr, T_Idx, complex_t); \
+instantiate_gem_x_vec_native(T_Ptr, T_Idx, complex8_t)
+instantiate_gem_x_vec_native_all(int_t, int_t);
+#if defined(CLA3P_I64)
+instantiate_gem_x_vec_native_all(int_t, nint_t);
+instantiate_gem_x_vec_native_all(nint_t, nint_t);
+#endif
+#undef instantiate_gem_x_vec_native_all
+#undef instantiate_gem_x_vec_native
+/*-------------------------------------------------*/
+template <typename T_Value, typename T_Scalar>
+void gem_x_vec_mixed(op_t opA, int_t m, int_t n, T_Scalar alpha,
+		const int_t *colptr, const int_t *rowidx, const T_Value *values,
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	gem_x_vec_kernel(opA, m, n, alpha, colptr, rowidx, values, x, beta, y);
+}
+/*-------------------------------------------------*/
+#define instantiate_gem_x_vec_mixed(T_Val, T_Scl) \
+template void gem_x_vec_mixed(op_t, int_t, int_t, T_Scl, \
+		const int_t*, const int_t*, const T_Val*, \
+		const T_Scl*, T_Scl, T_Scl*)
+instantiate_gem_x_vec_mixed(real4_t, real_t);
+instantiate_gem_x_vec_mixed(complex8_t, complex_t);
+#undef instantiate_gem_x_vec_mixed
+/*-------------------------------------------------*/
+/*
+ * Symmetric/Hermitian product from either stored triangle
+ * Entry (i,j) contributes to y[i] by scatter and to y[j] by a column dot product
+ */
+template <typename T_Values, typename T_Scalar>
+static void xhm_x_vec_kernel(bool conjop, int_t n, T_Scalar alpha,
+		const int_t *colptr, const int_t *rowidx, T_Values values,
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	scale_vec(n, beta, y, colptr[n] >= MT_NNZ_THRESHOLD);
+
+	for(int_t j = 0; j < n; j++) {
+		T_Scalar xj = alpha * x[j];
+		T_Scalar sum = 0;
+		for(int_t irow = colptr[j]; irow < colptr[j+1]; irow++) {
+			int_t i = rowidx[irow];
+			T_Scalar a = static_cast<T_Scalar>(values[irow]);
+			y[i] += a * xj;
+			if(i != j) {
+				sum += (conjop ? arith::conj(a) : a) * x[i];
+			}
+		} // irow
+		y[j] += alpha * sum;
+	} // j
+}
+/*-------------------------------------------------*/
+/*
+ * Symmetric/Hermitian product from either stored triangle A and its transpose T
+ * Row i is gathered from column i of A (entries (j,i) of the triangle, conjugated for Hermitian) 
+ * and from column i of T (entries (i,j) of the triangle), so rows are computed with no write conflicts
+ */
+template <typename T_Value, typename T_Scalar>
+static void xhm_x_vec_gather(bool conjop, int_t n, T_Scalar alpha,
+		const int_t *colptr, const int_t *rowidx, const T_Value *values,
+		const int_t *colptrT, const int_t *rowidxT, const T_Value *valuesT,
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	bool multithreaded = (colptr[n] >= MT_NNZ_THRESHOLD);
+
+#pragma omp parallel for schedule(dynamic,256) if(multithreaded)
+	for(int_t i = 0; i < n; i++) {
+		T_Scalar sum = 0;
+		for(int_t irow = colptr[i]; irow < colptr[i+1]; irow++) {
+			T_Scalar a = static_cast<T_Scalar>(values[irow]);
+			sum += (conjop ? arith::conj(a) : a) * x[rowidx[irow]];
+		} // irow
+		for(int_t irow = colptrT[i]; irow < colptrT[i+1]; irow++) {
+			if(rowidxT[irow] != i) {
+				sum += static_cast<T_Scalar>(valuesT[irow]) * x[rowidxT[irow]];
+			}
+		} // irow
+		y[i] = (beta == T_Scalar(0) ? T_Scalar(0) : beta * y[i]) + alpha * sum;
+	} // i
+}
+/*-------------------------------------------------*/
+template <typename T_Value, typename T_Scalar>
+void sym_x_vec_mixed(uplo_t /*uplo*/, int_t n, T_Scalar alpha,
+		const int_t *colptr, const int_t *rowidx, const T_Value *values,
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	xhm_x_vec_kernel(false, n, alpha, colptr, rowidx, values, x, beta, y);
+}
+/*-------------------------------------------------*/
+template <typename T_Value, typename T_Scalar>
+void hem_x_vec_mixed(uplo_t /*uplo*/, int_t n, T_Scalar alpha,
+		const int_t *colptr, const int_t *rowidx, const T_Value *values,
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	xhm_x_vec_kernel(true, n, alpha, colptr, rowidx, values, x, beta, y);
+}
+/*-------------------------------------------------*/
+template <typename T_Value, typename T_Scalar>
+void sym_x_vec_mixed(int_t n, T_Scalar alpha,
+		const int_t *colptr, const int_t *rowidx, const T_Value *values,
+		const int_t *colptrT, const int_t *rowidxT, const T_Value *valuesT,
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	xhm_x_vec_gather(false, n, alpha, colptr, rowidx, values, colptrT, rowidxT, valuesT, x, beta, y);
+}
+/*-------------------------------------------------*/
+template <typename T_Value, typename T_Scalar>
+void hem_x_vec_mixed(int_t n, T_Scalar alpha,
+		const int_t *colptr, const int_t *rowidx, const T_Value *values,
+		const int_t *colptrT, const int_t *rowidxT, const T_Value *valuesT,
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	xhm_x_vec_gather(true, n, alpha, colptr, rowidx, values, colptrT, rowidxT, valuesT, x, beta, y);
+}
+/*-------------------------------------------------*/
+#define instantiate_xhm_x_vec_mixed(T_Val, T_Scl) \
+template void sym_x_vec_mixed(uplo_t, int_t, T_Scl, \
+		const int_t*, const int_t*, const T_Val*, \
+		const T_Scl*, T_Scl, T_Scl*); \
+template void hem_x_vec_mixed(uplo_t, int_t, T_Scl, \
+		const int_t*, const int_t*, const T_Val*, \
+		const T_Scl*, T_Scl, T_Scl*); \
+template void sym_x_vec_mixed(int_t, T_Scl, \
+		const int_t*, const int_t*, const T_Val*, \
+		const int_t*, const int_t*, const T_Val*, \
+		const T_Scl*, T_Scl, T_Scl*); \
+template void hem_x_vec_mixed(int_t, T_Scl, \
+		const int_t*, const int_t*, const T_Val*, \
+		const int_t*, const int_t*, const T_Val*, \
+		const T_Scl*, T_Scl, T_Scl*)
+instantiate_xhm_x_vec_mixed(real4_t, real_t);
+instantiate_xhm_x_vec_mixed(complex8_t, complex_t);
+#undef instantiate_xhm_x_vec_mixed
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void gem_x_vec_pattern(op_t opA, int_t m, int_t n, T_Scalar alpha,
+		const int_t *colptr, const int_t *rowidx,
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	gem_x_vec_kernel(opA, m, n, alpha, colptr, rowidx, UnitValues(), x, beta, y);
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void sym_x_vec_pattern(uplo_t /*uplo*/, int_t n, T_Scalar alpha,
+		const int_t *colptr, const int_t *rowidx,
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	xhm_x_vec_kernel(false, n, alpha, colptr, rowidx, UnitValues(), x, beta, y);
+}
+/*-------------------------------------------------*/
+#define instantiate_x_vec_pattern(T_Scl) \
+template void gem_x_vec_pattern(op_t, int_t, int_t, T_Scl, \
+		const int_t*, const int_t*, \
+		const T_Scl*, T_Scl, T_Scl*); \
+template void sym_x_vec_pattern(uplo_t, int_t, T_Scl, \
+		const int_t*, const int_t*, \
+		const T_Scl*, T_Scl, T_Scl*)
+instantiate_x_vec_pattern(real_t);
+instantiate_x_vec_pattern(real4_t);
+instantiate_x_vec_pattern(complex_t);
+instantiate_x_vec_pattern(complex8_t);
+#undef instantiate_x_vec_pattern
+/*-------------------------------------------------*/
+template <typename T_Scalar>
 void sym_x_vec(uplo_t uplo, int_t n, T_Scalar alpha,
 		const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
 		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
@@ -151,24 +611,196 @@ instantiate_hem_x_vec(complex_t);
 instantiate_hem_x_vec(complex8_t);
 #undef instantiate_hem_x_vec
 /*-------------------------------------------------*/
+/*
+ * Row-major micro-panel kernels
+ * W right hand sides are updated per sweep of the sparse matrix,
+ * so every index and value load is amortized over W contiguous entries
+ */
+template <int W, typename T_Scalar>
+static void rmp_gather(bool conjop, int_t nsweep, T_Scalar alpha,
+		const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
+		const T_Scalar *b, int_t ldb, T_Scalar *c, int_t ldc, bool multithreaded)
+{
+#pragma omp parallel for schedule(dynamic,256) if(multithreaded)
+	for(int_t j = 0; j < nsweep; j++) {
+
+		T_Scalar acc[W];
+		for(int w = 0; w < W; w++) acc[w] = 0;
+
+		for(int_t irow = colptr[j]; irow < colptr[j+1]; irow++) {
+			T_Scalar a = (conjop ? arith::conj(values[irow]) : values[irow]);
+			const T_Scalar *bi = b + static_cast<std::size_t>(rowidx[irow]) * ldb;
+			for(int w = 0; w < W; w++) acc[w] += a * bi[w];
+		} // irow
+
+		T_Scalar *cj = c + static_cast<std::size_t>(j) * ldc;
+		for(int w = 0; w < W; w++) cj[w] += alpha * acc[w];
+
+	} // j
+}
+/*-------------------------------------------------*/
+/*
+ * Scatter of the entries of rows [ibgn,iend), located with binary search (sorted columns)
+ */
+template <int W, typename T_Scalar>
+static void rmp_scatter(int_t ibgn, int_t iend, int_t nsweep, T_Scalar alpha,
+		const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
+		const T_Scalar *b, int_t ldb, T_Scalar *c, int_t ldc)
+{
+	for(int_t j = 0; j < nsweep; j++) {
+
+		const int_t *rbgn = rowidx + colptr[j];
+		const int_t *rend = rowidx + colptr[j+1];
+
+		if(rbgn == rend || rbgn[0] >= iend || rend[-1] < ibgn) 
+			continue;
+
+		const int_t *r = (rbgn[0] >= ibgn ? rbgn : std::lower_bound(rbgn, rend, ibgn));
+
+		T_Scalar bj[W];
+		for(int w = 0; w < W; w++) bj[w] = alpha * b[static_cast<std::size_t>(j) * ldb + w];
+
+		for(; r < rend && *r < iend; r++) {
+			T_Scalar a = values[r - rowidx];
+			T_Scalar *ci = c + static_cast<std::size_t>(*r) * ldc;
+			for(int w = 0; w < W; w++) ci[w] += a * bj[w];
+		} // r
+
+	} // j
+}
+/*-------------------------------------------------*/
+/*
+ * op T/C sweeps the m columns of A gathering rows of B
+ * op N sweeps the columns of A scattering to rows of C, 
+ * multiple threads own disjoint row ranges of C, so no write conflicts arise
+ */
+template <int W, typename T_Scalar>
+static void rmp_sweep(bool gather, bool conjop, int_t m, int_t nsweep, T_Scalar alpha,
+		const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
+		const T_Scalar *b, int_t ldb, T_Scalar *c, int_t ldc, bool multithreaded)
+{
+	if(gather) {
+		rmp_gather<W>(conjop, nsweep, alpha, colptr, rowidx, values, b, ldb, c, ldc, multithreaded);
+		return;
+	} // gather
+
+	int_t nparts = (multithreaded ? std::min(m, static_cast<int_t>(4 * mt::maxThreads())) : 1);
+
+#pragma omp parallel for schedule(dynamic,1) if(nparts > 1)
+	for(int_t p = 0; p < nparts; p++) {
+		int_t ibgn = static_cast<int_t>((static_cast<long long int>(m) * p) / nparts);
+		int_t iend = static_cast<int_t>((static_cast<long long int>(m) * (p + 1)) / nparts);
+		rmp_scatter<W>(ibgn, iend, nsweep, alpha, colptr, rowidx, values, b, ldb, c, ldc);
+	} // p
+}
+/*-------------------------------------------------*/
+static int rmp_width(int_t n)
+{
+	return (n >= 16 ? 16 : n >= 8 ? 8 : n >= 4 ? 4 : n >= 2 ? 2 : 1);
+}
+/*-------------------------------------------------*/
+/*
+ * Sweep of C(m x width) += alpha * op(A) * B(k x width) on row-major micro-panels
+ */
+template <typename T_Scalar>
+static void rmp_panel(int width, op_t opA, int_t m, int_t k, T_Scalar alpha,
+		const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
+		const T_Scalar *b, int_t ldb, T_Scalar *c, int_t ldc)
+{
+	bool gather = (opA != op_t::N);
+	bool conjop = (opA == op_t::C);
+	int_t nsweep = (gather ? m : k);
+	bool multithreaded = (colptr[nsweep] >= MT_NNZ_THRESHOLD);
+
+	switch(width) {
+		case 16: rmp_sweep<16>(gather, conjop, m, nsweep, alpha, colptr, rowidx, values, b, ldb, c, ldc, multithreaded); break;
+		case  8: rmp_sweep< 8>(gather, conjop, m, nsweep, alpha, colptr, rowidx, values, b, ldb, c, ldc, multithreaded); break;
+		case  4: rmp_sweep< 4>(gather, conjop, m, nsweep, alpha, colptr, rowidx, values, b, ldb, c, ldc, multithreaded); break;
+		case  2: rmp_sweep< 2>(gather, conjop, m, nsweep, alpha, colptr, rowidx, values, b, ldb, c, ldc, multithreaded); break;
+		default: rmp_sweep< 1>(gather, conjop, m, nsweep, alpha, colptr, rowidx, values, b, ldb, c, ldc, multithreaded); break;
+	} // width
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void gem_x_gem_native(op_t opA, int_t m, int_t n, int_t k, T_Scalar alpha,
+		const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
+		const T_Scalar *b, int_t ldb, T_Scalar beta, T_Scalar *c, int_t ldc)
+{
+	if(!m || !n) return;
+
+	//
+	// Column-major B and C are interleaved panel by panel into row-major micro-panels
+	//
+	int width = rmp_width(n);
+	std::vector<T_Scalar> bp(static_cast<std::size_t>(k) * width);
+	std::vector<T_Scalar> cp(static_cast<std::size_t>(m) * width);
+
+	for(int_t q = 0; q < n; ) {
+
+		width = rmp_width(n - q);
+
+		const T_Scalar *bq = b + static_cast<std::size_t>(q) * ldb;
+		T_Scalar *cq = c + static_cast<std::size_t>(q) * ldc;
+
+#pragma omp parallel for schedule(static) if(static_cast<std::size_t>(k) * width >= MT_NNZ_THRESHOLD)
+		for(int_t i = 0; i < k; i++) {
+			for(int w = 0; w < width; w++) {
+				bp[static_cast<std::size_t>(i) * width + w] = bq[i + static_cast<std::size_t>(w) * ldb];
+			} // w
+		} // i
+
+#pragma omp parallel for schedule(static) if(static_cast<std::size_t>(m) * width >= MT_NNZ_THRESHOLD)
+		for(int_t i = 0; i < m; i++) {
+			for(int w = 0; w < width; w++) {
+				T_Scalar cij = cq[i + static_cast<std::size_t>(w) * ldc];
+				cp[static_cast<std::size_t>(i) * width + w] = (beta == T_Scalar(0) ? T_Scalar(0) : beta * cij);
+			} // w
+		} // i
+
+		rmp_panel(width, opA, m, k, alpha, colptr, rowidx, values, bp.data(), width, cp.data(), width);
+
+#pragma omp parallel for schedule(static) if(static_cast<std::size_t>(m) * width >= MT_NNZ_THRESHOLD)
+		for(int_t i = 0; i < m; i++) {
+			for(int w = 0; w < width; w++) {
+				cq[i + static_cast<std::size_t>(w) * ldc] = cp[static_cast<std::size_t>(i) * width + w];
+			} // w
+		} // i
+
+		q += width;
+
+	} // q
+}
+/*-------------------------------------------------*/
+#define instantiate_gem_x_gem_native(T_Scl) \
+template void gem_x_gem_native(op_t, int_t, int_t, int_t, T_Scl, \
+		const int_t*, const int_t*, const T_Scl*, \
+		const T_Scl*, int_t, T_Scl, T_Scl*, int_t )
+instantiate_gem_x_gem_native(real_t);
+instantiate_gem_x_gem_native(real4_t);
+instantiate_gem_x_gem_native(complex_t);
+instantiate_gem_x_gem_native(complex8_t);
+#undef instantiate_gem_x_gem_native
+/*-------------------------------------------------*/
 template <typename T_Scalar>
 void gem_x_gem(op_t opA, int_t m, int_t n, int_t k, T_Scalar alpha,
 		const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
 		const T_Scalar *b, int_t ldb, T_Scalar beta, T_Scalar *c, int_t ldc)
 {
+#if defined(CLA3P_INTEL_MKL) || defined(CLA3P_ARMPL)
+	if(n < RMP_MIN_RHS || n > RMP_MAX_RHS) {
+		int_t mA = (opA == op_t::N ? m : k);
+		int_t nA = (opA == op_t::N ? k : m);
+		Property pr = Property::General();
 #if defined(CLA3P_INTEL_MKL)
-	int_t mA = (opA == op_t::N ? m : k);
-	int_t nA = (opA == op_t::N ? k : m);
-	Property pr = Property::General();
-	mkl::csc_mm(pr.type(), pr.uplo(), mA, nA, alpha, opA, colptr, rowidx, values, n, b, ldb, beta, c, ldc);
-#elif defined(CLA3P_ARMPL)
-	int_t mA = (opA == op_t::N ? m : k);
-	int_t nA = (opA == op_t::N ? k : m);
-	Property pr = Property::General();
-	armpl::csc_mm(pr.type(), pr.uplo(), mA, nA, alpha, opA, colptr, rowidx, values, n, b, ldb, beta, c, ldc);
+		mkl::csc_mm(pr.type(), pr.uplo(), mA, nA, alpha, opA, colptr, rowidx, values, n, b, ldb, beta, c, ldc);
 #else
-	throw err::InvalidOp(msg::MissingThirdParty());
+		armpl::csc_mm(pr.type(), pr.uplo(), mA, nA, alpha, opA, colptr, rowidx, values, n, b, ldb, beta, c, ldc);
+#endif
+		return;
+	} // third party
 #endif
+
+	gem_x_gem_native(opA, m, n, k, alpha, colptr, rowidx, values, b, ldb, beta, c, ldc);
 }
 /*-------------------------------------------------*/
 #define instantiate_gem_x_gem(T_Scl) \
@@ -270,8 +902,295 @@ instantiate_gem_x_gem(complex_t);
 instantiate_gem_x_gem(complex8_t);
 #undef instantiate_gem_x_gem
 /*-------------------------------------------------*/
+//
+// Gives the element k of opX(X), reading through the positions of transposed operands
+//
+template <typename T_Scalar>
+static inline T_Scalar operand_value(const ProductOperand& X, const T_Scalar *values, int_t k)
+{
+	T_Scalar v = values[X.pos ? X.pos[k] : k];
+	return (X.conj ? arith::conj(v) : v);
+}
+/*-------------------------------------------------*/
+void product_operand_pattern(op_t op, int_t m, int_t n, const int_t *colptr, const int_t *rowidx,
+		std::vector<int_t>& colptr_out, std::vector<int_t>& rowidx_out, std::vector<int_t>& pos_out)
+{
+	if(op == op_t::N) {
+		colptr_out.clear();
+		rowidx_out.clear();
+		pos_out.clear();
+		return;
+	} // op N
+
+	int_t nz = colptr[n];
+
+	colptr_out.resize(m + 1);
+	rowidx_out.resize(nz);
+	pos_out.resize(nz);
+
+	transpose(m, n, colptr, rowidx, colptr_out.data(), rowidx_out.data(), pos_out.data());
+}
+/*-------------------------------------------------*/
+ProductOperand product_operand(op_t op, const int_t *colptr, const int_t *rowidx,
+		const std::vector<int_t>& colptr_t, const std::vector<int_t>& rowidx_t, const std::vector<int_t>& pos_t)
+{
+	ProductOperand ret;
+
+	if(op == op_t::N) {
+		ret.colptr = colptr;
+		ret.rowidx = rowidx;
+		ret.pos = nullptr;
+	} else {
+		ret.colptr = colptr_t.data();
+		ret.rowidx = rowidx_t.data();
+		ret.pos = pos_t.data();
+	} // op
+
+	ret.conj = (op == op_t::C);
+
+	return ret;
+}
+/*-------------------------------------------------*/
+int_t product_partition(int_t n, const ProductOperand& A, const ProductOperand& B, std::vector<int_t>& bounds)
+{
+	//
+	// Multiply-add counts can exceed the index range, so they are accumulated in long long
+	//
+	std::vector<long long int> flops(n + 1);
+
+	bool multithreaded = (B.colptr[n] >= MT_NNZ_THRESHOLD);
+
+	flops[0] = 0;
+#pragma omp parallel for schedule(static) if(multithreaded)
+	for(int_t j = 0; j < n; j++) {
+
+		long long int cnt = 0;
+
+		for(int_t irow = B.colptr[j]; irow < B.colptr[j+1]; irow++) {
+			int_t kk = B.rowidx[irow];
+			cnt += A.colptr[kk+1] - A.colptr[kk];
+		} // irow
+
+		flops[j+1] = cnt;
+
+	} // j
+
+	for(int_t j = 0; j < n; j++) {
+		flops[j+1] += flops[j];
+	} // j
+
+	long long int total = flops[n];
+
+	int_t nparts = 1;
+	if(n >= 2 && total >= MT_NNZ_THRESHOLD) {
+		nparts = std::min(n, static_cast<int_t>(4 * mt::maxThreads()));
+	}
+
+	bounds.resize(nparts + 1);
+	bounds[0] = 0;
+
+	for(int_t p = 1; p < nparts; p++) {
+		long long int target = (total / nparts) * p + ((total % nparts) * p) / nparts;
+		int_t jp = static_cast<int_t>(std::upper_bound(flops.begin(), flops.end(), target) - flops.begin()) - 1;
+		bounds[p] = std::min(n, std::max(bounds[p-1], jp));
+	} // p
+
+	bounds[nparts] = n;
+
+	return nparts;
+}
+/*-------------------------------------------------*/
+//
+// Gustavson symbolic count pass of C = A * B: colptr holds the column lengths of C on exit (rolled)
+// A per thread marker keeps the last column each row was seen in, so repeated rows are counted once
+//
+static void product_colptr(int_t m, int_t n, 
+		const ProductOperand& A, const ProductOperand& B,
+		int_t nparts, const int_t *bounds, int_t *colptr)
+{
+	colptr[0] = 0;
+
+#pragma omp parallel if(nparts > 1)
+	{
+		std::vector<int_t> marker(m, -1);
+
+#pragma omp for schedule(dynamic,1)
+		for(int_t p = 0; p < nparts; p++) {
+			for(int_t j = bounds[p]; j < bounds[p+1]; j++) {
+
+				int_t cnt = 0;
+
+				for(int_t irowB = B.colptr[j]; irowB < B.colptr[j+1]; irowB++) {
+					int_t kk = B.rowidx[irowB];
+					for(int_t irowA = A.colptr[kk]; irowA < A.colptr[kk+1]; irowA++) {
+						int_t i = A.rowidx[irowA];
+						if(marker[i] != j) {
+							marker[i] = j;
+							cnt++;
+						} // new entry
+					} // irowA
+				} // irowB
+
+				colptr[j+1] = cnt;
+
+			} // j
+		} // p
+	} // omp parallel
+
+	roll(n, colptr);
+}
+/*-------------------------------------------------*/
+//
+// Symbolic fill pass of C = A * B: fills rowidx (sorted columns) on the colptr of product_colptr()
+//
+static void product_rowidx(int_t m, 
+		const ProductOperand& A, const ProductOperand& B,
+		int_t nparts, const int_t *bounds, const int_t *colptr, int_t *rowidx)
+{
+#pragma omp parallel if(nparts > 1)
+	{
+		std::vector<int_t> marker(m, -1);
+
+#pragma omp for schedule(dynamic,1)
+		for(int_t p = 0; p < nparts; p++) {
+			for(int_t j = bounds[p]; j < bounds[p+1]; j++) {
+
+				int_t pos = colptr[j];
+
+				for(int_t irowB = B.colptr[j]; irowB < B.colptr[j+1]; irowB++) {
+					int_t kk = B.rowidx[irowB];
+					for(int_t irowA = A.colptr[kk]; irowA < A.colptr[kk+1]; irowA++) {
+						int_t i = A.rowidx[irowA];
+						if(marker[i] != j) {
+							marker[i] = j;
+							rowidx[pos++] = i;
+						} // new entry
+					} // irowA
+				} // irowB
+
+				std::sort(rowidx + colptr[j], rowidx + colptr[j+1]);
+
+			} // j
+		} // p
+	} // omp parallel
+}
+/*-------------------------------------------------*/
+void gem_x_gem_symbolic(int_t m, int_t n, 
+		const ProductOperand& A, const ProductOperand& B,
+		int_t nparts, const int_t *bounds,
+		int_t **colptrC, int_t **rowidxC)
+{
+	int_t *colptr = i_malloc<int_t>(n + 1);
+
+	product_colptr(m, n, A, B, nparts, bounds, colptr);
+
+	int_t *rowidx = i_malloc<int_t>(colptr[n]);
+
+	product_rowidx(m, A, B, nparts, bounds, colptr, rowidx);
+
+	*colptrC = colptr;
+	*rowidxC = rowidx;
+}
+/*-------------------------------------------------*/
+void gem_x_gem_symbolic(int_t m, int_t n, 
+		const ProductOperand& A, const ProductOperand& B,
+		int_t nparts, const int_t *bounds,
+		std::vector<int_t>& colptrC, std::vector<int_t>& rowidxC)
+{
+	colptrC.resize(n + 1);
+
+	product_colptr(m, n, A, B, nparts, bounds, colptrC.data());
+
+	rowidxC.resize(colptrC[n]);
+
+	product_rowidx(m, A, B, nparts, bounds, colptrC.data(), rowidxC.data());
+}
+/*-------------------------------------------------*/
+//
+// Gustavson numeric phase for C = beta * C + alpha * A * B on the existing pattern of C
+// A per thread position map points each row of the current column to its slot in C
+// If work is provided, the product is accumulated in work(nnz(C)) and C is not accessed
+// Returns the number of product entries that fall outside the pattern of C
+//
 template <typename T_Scalar>
-void gem_x_gem(int_t m, int_t n, int_t k,
+static int_t numeric_nn(int_t m, T_Scalar alpha,
+		const ProductOperand& A, const T_Scalar *valuesA,
+		const ProductOperand& B, const T_Scalar *valuesB,
+		T_Scalar beta, const int_t *colptrC, const int_t *rowidxC, T_Scalar *valuesC,
+		T_Scalar *work, int_t nparts, const int_t *bounds)
+{
+	int_t nout = 0;
+
+	T_Scalar *acc = (work ? work : valuesC);
+
+#pragma omp parallel if(nparts > 1)
+	{
+		std::vector<int_t> position(m, -1);
+
+#pragma omp for schedule(dynamic,1) reduction(+:nout)
+		for(int_t p = 0; p < nparts; p++) {
+			for(int_t j = bounds[p]; j < bounds[p+1]; j++) {
+
+				for(int_t irowC = colptrC[j]; irowC < colptrC[j+1]; irowC++) {
+					position[rowidxC[irowC]] = irowC;
+					acc[irowC] = ((work || beta == T_Scalar(0)) ? T_Scalar(0) : beta * valuesC[irowC]);
+				} // irowC
+
+				for(int_t irowB = B.colptr[j]; irowB < B.colptr[j+1]; irowB++) {
+
+					int_t kk = B.rowidx[irowB];
+					T_Scalar bkj = alpha * operand_value(B, valuesB, irowB);
+
+					for(int_t irowA = A.colptr[kk]; irowA < A.colptr[kk+1]; irowA++) {
+						int_t pos = position[A.rowidx[irowA]];
+						if(pos < 0) {
+							nout++;
+						} else {
+							acc[pos] += operand_value(A, valuesA, irowA) * bkj;
+						} // pos
+					} // irowA
+
+				} // irowB
+
+				for(int_t irowC = colptrC[j]; irowC < colptrC[j+1]; irowC++) {
+					position[rowidxC[irowC]] = -1;
+				} // irowC
+
+			} // j
+		} // p
+	} // omp parallel
+
+	return nout;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void gem_x_gem_numeric(int_t m, int_t /*n*/, T_Scalar alpha,
+		const ProductOperand& A, const T_Scalar *valuesA,
+		const ProductOperand& B, const T_Scalar *valuesB,
+		T_Scalar beta, const int_t *colptrC, const int_t *rowidxC, T_Scalar *valuesC,
+		int_t nparts, const int_t *bounds)
+{
+	numeric_nn(m, alpha, 
+			A, valuesA, 
+			B, valuesB, 
+			beta, colptrC, rowidxC, valuesC,
+			static_cast<T_Scalar*>(nullptr), nparts, bounds);
+}
+/*-------------------------------------------------*/
+#define instantiate_gem_x_gem_numeric(T_Scl) \
+template void gem_x_gem_numeric(int_t, int_t, T_Scl, \
+		const ProductOperand&, const T_Scl*, \
+		const ProductOperand&, const T_Scl*, \
+		T_Scl, const int_t*, const int_t*, T_Scl*, \
+		int_t, const int_t*)
+instantiate_gem_x_gem_numeric(real_t);
+instantiate_gem_x_gem_numeric(real4_t);
+instantiate_gem_x_gem_numeric(complex_t);
+instantiate_gem_x_gem_numeric(complex8_t);
+#undef instantiate_gem_x_gem_numeric
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void gem_x_gem(int_t m, int_t n, int_t k, T_Scalar alpha,
 		op_t opA, const int_t *colptrA, const int_t *rowidxA, const T_Scalar *valuesA,
 		op_t opB, const int_t *colptrB, const int_t *rowidxB, const T_Scalar *valuesB,
 		int_t **colptrC, int_t **rowidxC, T_Scalar **valuesC)
@@ -281,23 +1200,30 @@ void gem_x_gem(int_t m, int_t n, int_t k,
 	int_t mB = (opB == op_t::N ? k : n);
 	int_t nB = (opB == op_t::N ? n : k);
 
-#if defined(CLA3P_INTEL_MKL)
-	mkl::csc_sp2m(
-			opA, mA, nA, colptrA, rowidxA, valuesA,
-			opB, mB, nB, colptrB, rowidxB, valuesB,
-			colptrC, rowidxC, valuesC);
-#elif defined(CLA3P_ARMPL)
-	armpl::csc_spmm(T_Scalar(1),
-			opA, mA, nA, colptrA, rowidxA, valuesA,
-			opB, mB, nB, colptrB, rowidxB, valuesB,
-			colptrC, rowidxC, valuesC);
-#else
-	throw err::InvalidOp(msg::MissingThirdParty());
-#endif
+	std::vector<int_t> colptrTmpA, rowidxTmpA, posA, colptrTmpB, rowidxTmpB, posB;
+
+	product_operand_pattern(opA, mA, nA, colptrA, rowidxA, colptrTmpA, rowidxTmpA, posA);
+	product_operand_pattern(opB, mB, nB, colptrB, rowidxB, colptrTmpB, rowidxTmpB, posB);
+
+	ProductOperand A = product_operand(opA, colptrA, rowidxA, colptrTmpA, rowidxTmpA, posA);
+	ProductOperand B = product_operand(opB, colptrB, rowidxB, colptrTmpB, rowidxTmpB, posB);
+
+	std::vector<int_t> bounds;
+	int_t nparts = product_partition(n, A, B, bounds);
+
+	gem_x_gem_symbolic(m, n, A, B, nparts, bounds.data(), colptrC, rowidxC);
+
+	*valuesC = i_malloc<T_Scalar>((*colptrC)[n]);
+
+	gem_x_gem_numeric(m, n, alpha, 
+			A, valuesA, 
+			B, valuesB, 
+			T_Scalar(0), *colptrC, *rowidxC, *valuesC,
+			nparts, bounds.data());
 }
 /*-------------------------------------------------*/
 #define instantiate_gem_x_gem(T_Scl) \
-template void gem_x_gem(int_t, int_t, int_t, \
+template void gem_x_gem(int_t, int_t, int_t, T_Scl, \
 		op_t, const int_t*, const int_t*, const T_Scl*, \
 		op_t, const int_t*, const int_t*, const T_Scl*, \
 		int_t**, int_t**, T_Scl**)
@@ -307,6 +1233,246 @@ instantiate_gem_x_gem(complex_t);
 instantiate_gem_x_gem(complex8_t);
 #undef instantiate_gem_x_gem
 /*-------------------------------------------------*/
+void gem_x_gem_symbolic(int_t m, int_t n, int_t k,
+		op_t opA, const int_t *colptrA, const int_t *rowidxA,
+		op_t opB, const int_t *colptrB, const int_t *rowidxB,
+		int_t **colptrC, int_t **rowidxC)
+{
+	int_t mA = (opA == op_t::N ? m : k);
+	int_t nA = (opA == op_t::N ? k : m);
+	int_t mB = (opB == op_t::N ? k : n);
+	int_t nB = (opB == op_t::N ? n : k);
+
+	std::vector<int_t> colptrTmpA, rowidxTmpA, posA, colptrTmpB, rowidxTmpB, posB;
+
+	product_operand_pattern(opA, mA, nA, colptrA, rowidxA, colptrTmpA, rowidxTmpA, posA);
+	product_operand_pattern(opB, mB, nB, colptrB, rowidxB, colptrTmpB, rowidxTmpB, posB);
+
+	ProductOperand A = product_operand(opA, colptrA, rowidxA, colptrTmpA, rowidxTmpA, posA);
+	ProductOperand B = product_operand(opB, colptrB, rowidxB, colptrTmpB, rowidxTmpB, posB);
+
+	std::vector<int_t> bounds;
+	int_t nparts = product_partition(n, A, B, bounds);
+
+	gem_x_gem_symbolic(m, n, A, B, nparts, bounds.data(), colptrC, rowidxC);
+}
+/*-------------------------------------------------*/
+void gem_x_gem_symbolic(int_t m, int_t n, int_t k,
+		op_t opA, const int_t *colptrA, const int_t *rowidxA,
+		op_t opB, const int_t *colptrB, const int_t *rowidxB,
+		std::vector<int_t>& colptrC, std::vector<int_t>& rowidxC)
+{
+	int_t mA = (opA == op_t::N ? m : k);
+	int_t nA = (opA == op_t::N ? k : m);
+	int_t mB = (opB == op_t::N ? k : n);
+	int_t nB = (opB == op_t::N ? n : k);
+
+	std::vector<int_t> colptrTmpA, rowidxTmpA, posA, colptrTmpB, rowidxTmpB, posB;
+
+	product_operand_pattern(opA, mA, nA, colptrA, rowidxA, colptrTmpA, rowidxTmpA, posA);
+	product_operand_pattern(opB, mB, nB, colptrB, rowidxB, colptrTmpB, rowidxTmpB, posB);
+
+	ProductOperand A = product_operand(opA, colptrA, rowidxA, colptrTmpA, rowidxTmpA, posA);
+	ProductOperand B = product_operand(opB, colptrB, rowidxB, colptrTmpB, rowidxTmpB, posB);
+
+	std::vector<int_t> bounds;
+	int_t nparts = product_partition(n, A, B, bounds);
+
+	gem_x_gem_symbolic(m, n, A, B, nparts, bounds.data(), colptrC, rowidxC);
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void gem_x_gem_numeric(int_t m, int_t n, int_t k, T_Scalar alpha,
+		op_t opA, const int_t *colptrA, const int_t *rowidxA, const T_Scalar *valuesA,
+		op_t opB, const int_t *colptrB, const int_t *rowidxB, const T_Scalar *valuesB,
+		T_Scalar beta, const int_t *colptrC, const int_t *rowidxC, T_Scalar *valuesC)
+{
+	int_t mA = (opA == op_t::N ? m : k);
+	int_t nA = (opA == op_t::N ? k : m);
+	int_t mB = (opB == op_t::N ? k : n);
+	int_t nB = (opB == op_t::N ? n : k);
+
+	std::vector<int_t> colptrTmpA, rowidxTmpA, posA, colptrTmpB, rowidxTmpB, posB;
+
+	product_operand_pattern(opA, mA, nA, colptrA, rowidxA, colptrTmpA, rowidxTmpA, posA);
+	product_operand_pattern(opB, mB, nB, colptrB, rowidxB, colptrTmpB, rowidxTmpB, posB);
+
+	ProductOperand A = product_operand(opA, colptrA, rowidxA, colptrTmpA, rowidxTmpA, posA);
+	ProductOperand B = product_operand(opB, colptrB, rowidxB, colptrTmpB, rowidxTmpB, posB);
+
+	std::vector<int_t> bounds;
+	int_t nparts = product_partition(n, A, B, bounds);
+
+	//
+	// The product is staged so that C is left intact on pattern mismatch
+	//
+	int_t nzC = colptrC[n];
+	std::vector<T_Scalar> work(nzC);
+
+	int_t nout = numeric_nn(m, alpha, 
+			A, valuesA, 
+			B, valuesB, 
+			beta, colptrC, rowidxC, valuesC,
+			work.data(), nparts, bounds.data());
+
+	if(nout) {
+		throw err::NoConsistency(msg::PatternMismatch());
+	} // nout
+
+#pragma omp parallel for schedule(static) if(nzC >= MT_NNZ_THRESHOLD)
+	for(int_t irow = 0; irow < nzC; irow++) {
+		valuesC[irow] = (beta == T_Scalar(0) ? work[irow] : beta * valuesC[irow] + work[irow]);
+	} // irow
+}
+/*-------------------------------------------------*/
+#define instantiate_gem_x_gem_numeric(T_Scl) \
+template void gem_x_gem_numeric(int_t, int_t, int_t, T_Scl, \
+		op_t, const int_t*, const int_t*, const T_Scl*, \
+		op_t, const int_t*, const int_t*, const T_Scl*, \
+		T_Scl, const int_t*, const int_t*, T_Scl*)
+instantiate_gem_x_gem_numeric(real_t);
+instantiate_gem_x_gem_numeric(real4_t);
+instantiate_gem_x_gem_numeric(complex_t);
+instantiate_gem_x_gem_numeric(complex8_t);
+#undef instantiate_gem_x_gem_numeric
+/*-------------------------------------------------*/
+int_t tri_levels(uplo_t uplo, op_t opA, int_t n, const int_t *colptr, const int_t *rowidx,
+		int_t *rowptr, int_t *colidx, int_t *valpos, int_t *diagpos, int_t *levptr, int_t *order)
+{
+	bool trans = (opA != op_t::N);
+	bool lower = ((uplo == uplo_t::Lower) != trans);
+
+	//
+	// Row-wise form of opA(A), entries outside uplo are ignored
+	//
+
+	std::fill(rowptr, rowptr + n + 1, 0);
+	std::fill(diagpos, diagpos + n, -1);
+
+	for(int_t j = 0; j < n; j++) {
+		for(int_t irow = colptr[j]; irow < colptr[j+1]; irow++) {
+			int_t i = rowidx[irow];
+			if(i == j) {
+				diagpos[j] = irow;
+			} else if((uplo == uplo_t::Lower && i > j) || (uplo == uplo_t::Upper && i < j)) {
+				rowptr[(trans ? j : i) + 1]++;
+			} // off-diagonal
+		} // irow
+	} // j
+
+	for(int_t j = 0; j < n; j++) {
+		if(diagpos[j] < 0) {
+			throw err::InvalidOp(msg::DivisionByZero());
+		} // missing diagonal
+	} // j
+
+	roll(n, rowptr);
+
+	std::vector<int_t> cursor(rowptr, rowptr + n);
+
+	for(int_t j = 0; j < n; j++) {
+		for(int_t irow = colptr[j]; irow < colptr[j+1]; irow++) {
+			int_t i = rowidx[irow];
+			if((uplo == uplo_t::Lower && i > j) || (uplo == uplo_t::Upper && i < j)) {
+				int_t r = (trans ? j : i);
+				int_t pos = cursor[r]++;
+				colidx[pos] = (trans ? i : j);
+				valpos[pos] = irow;
+			} // off-diagonal
+		} // irow
+	} // j
+
+	//
+	// Level of a row is one past the deepest level it depends on
+	//
+
+	std::vector<int_t> level(n);
+	int_t nlevels = 0;
+
+	for(int_t t = 0; t < n; t++) {
+
+		int_t i = (lower ? t : n - 1 - t);
+		int_t lev = 0;
+
+		for(int_t k = rowptr[i]; k < rowptr[i+1]; k++) {
+			lev = std::max(lev, level[colidx[k]] + 1);
+		} // k
+
+		level[i] = lev;
+		nlevels = std::max(nlevels, lev + 1);
+
+	} // t
+
+	std::fill(levptr, levptr + nlevels + 1, 0);
+
+	for(int_t i = 0; i < n; i++) {
+		levptr[level[i] + 1]++;
+	} // i
+
+	roll(nlevels, levptr);
+
+	cursor.assign(levptr, levptr + nlevels);
+
+	for(int_t i = 0; i < n; i++) {
+		order[cursor[level[i]]++] = i;
+	} // i
+
+	return nlevels;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void tri_x_gem_solve(op_t opA, int_t n, int_t nrhs, T_Scalar alpha, const T_Scalar *values,
+		const int_t *rowptr, const int_t *colidx, const int_t *valpos, const int_t *diagpos,
+		int_t nlevels, const int_t *levptr, const int_t *order, T_Scalar *b, int_t ldb)
+{
+	bool conjop = (opA == op_t::C);
+
+	//
+	// Each level ends with a barrier, so levels need to be wide enough to pay off
+	//
+	bool multithreaded = (rowptr[n] * nrhs >= MT_NNZ_THRESHOLD && n >= 64 * nlevels);
+
+#pragma omp parallel if(multithreaded)
+	{
+		for(int_t l = 0; l < nlevels; l++) {
+
+#pragma omp for schedule(static)
+			for(int_t p = levptr[l]; p < levptr[l+1]; p++) {
+
+				int_t i = order[p];
+				T_Scalar d = values[diagpos[i]];
+				d = (conjop ? arith::conj(d) : d);
+
+				for(int_t r = 0; r < nrhs; r++) {
+
+					T_Scalar *x = b + r * ldb;
+					T_Scalar sum = alpha * x[i];
+
+					for(int_t k = rowptr[i]; k < rowptr[i+1]; k++) {
+						T_Scalar a = values[valpos[k]];
+						sum -= (conjop ? arith::conj(a) : a) * x[colidx[k]];
+					} // k
+
+					x[i] = sum / d;
+
+				} // r
+
+			} // p
+
+		} // l
+	} // omp parallel
+}
+/*-------------------------------------------------*/
+#define instantiate_tri_x_gem_solve(T_Scl) \
+template void tri_x_gem_solve(op_t, int_t, int_t, T_Scl, const T_Scl*, \
+		const int_t*, const int_t*, const int_t*, const int_t*, \
+		int_t, const int_t*, const int_t*, T_Scl*, int_t)
+instantiate_tri_x_gem_solve(real_t);
+instantiate_tri_x_gem_solve(real4_t);
+instantiate_tri_x_gem_solve(complex_t);
+instantiate_tri_x_gem_solve(complex8_t);
+#undef instantiate_tri_x_gem_solve
+/*-------------------------------------------------*/
 } // namespace csc
 } // namespace blk
 } // namespace cla3p
@@ -21,6 +21,8 @@
  * @file
  */
 
+#include <vector>
+
 #include "cla3p/types.hpp"
 
 /*-------------------------------------------------*/
@@ -30,7 +32,48 @@ namespace csc {
 /*-------------------------------------------------*/
 
 //
-// Update: cscC = alpha * cscA + cscB
+// Range of right hand sides routed to the native micro-panel kernels when a third party library is available
+// Narrower blocks do not amortize the index loads and are left to the library
+//
+constexpr int_t RMP_MIN_RHS = 4;
+constexpr int_t RMP_MAX_RHS = 64;
+
+//
+// Checks if cscA & cscB share the same pattern (sorted columns)
+//
+bool same_pattern(int_t n, 
+		const int_t *colptrA, const int_t *rowidxA, 
+		const int_t *colptrB, const int_t *rowidxB);
+
+//
+// Checks if the pattern of cscC contains the pattern of cscA (sorted columns)
+//
+bool pattern_includes(int_t n, 
+		const int_t *colptrC, const int_t *rowidxC, 
+		const int_t *colptrA, const int_t *rowidxA);
+
+//
+// Pattern union of cscA & cscB (sorted columns)
+// Allocates colptrC & rowidxC
+// cscC(m x n)
+//
+void add_symbolic(int_t n,
+		const int_t *colptrA, const int_t *rowidxA,
+		const int_t *colptrB, const int_t *rowidxB,
+		int_t **colptrC, int_t **rowidxC);
+
+//
+// Pattern union of cscA & cscB (sorted columns), resizes colptrC & rowidxC
+// cscC(m x n)
+//
+void add_symbolic(int_t n,
+		const int_t *colptrA, const int_t *rowidxA,
+		const int_t *colptrB, const int_t *rowidxB,
+		std::vector<int_t>& colptrC, std::vector<int_t>& rowidxC);
+
+//
+// Update: cscC = alpha * cscA + beta * cscB
+// Native two pass merge, cscC is allocated with the union pattern
 // cscC(m x n)
 //
 template <typename T_Scalar>
@@ -39,6 +82,18 @@ void add(int_t m, int_t n,
 		T_Scalar beta, const int_t *colptrB, const int_t *rowidxB, const T_Scalar *valuesB,
 		int_t **colptrC, int_t **rowidxC, T_Scalar **valuesC);
 
+//
+// Update: cscC = alpha * cscA + beta * cscB
+// Numeric merge on the existing pattern of cscC, which must contain the patterns of cscA & cscB
+// valuesC can alias valuesA (or valuesB) if the patterns of cscC & cscA (or cscB) coincide
+// cscC(m x n)
+//
+template <typename T_Scalar>
+void add_numeric(int_t n,
+		T_Scalar alpha, const int_t *colptrA, const int_t *rowidxA, const T_Scalar *valuesA,
+		T_Scalar beta, const int_t *colptrB, const int_t *rowidxB, const T_Scalar *valuesB,
+		const int_t *colptrC, const int_t *rowidxC, T_Scalar *valuesC);
+
 //
 // Update: dnsY = beta * dnsY + alpha * op(cscA) * dnsX
 // A(m x n)
@@ -48,6 +103,73 @@ void gem_x_vec(op_t opA, int_t m, int_t n, T_Scalar alpha,
 		const int_t *colptr, const int_t *rowidx, const T_Scalar *values, 
 		const T_Scalar *x, T_Scalar beta, T_Scalar *y);
 
+//
+// Update: dnsY = beta * dnsY + alpha * op(cscA) * dnsX
+// Native kernel, colptr & rowidx can have different widths, op N is serial
+// A(m x n)
+//
+template <typename T_Ptr, typename T_Idx, typename T_Scalar>
+void gem_x_vec_native(op_t opA, int_t m, int_t n, T_Scalar alpha, 
+		const T_Ptr *colptr, const T_Idx *rowidx, const T_Scalar *values, 
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y);
+
+//
+// Update: dnsY = beta * dnsY + alpha * op(cscA) * dnsX
+// Mixed precision kernel, values are stored in T_Value and accumulated in T_Scalar
+// A(m x n)
+//
+template <typename T_Value, typename T_Scalar>
+void gem_x_vec_mixed(op_t opA, int_t m, int_t n, T_Scalar alpha, 
+		const int_t *colptr, const int_t *rowidx, const T_Value *values, 
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y);
+
+//
+// Update: dnsY = beta * dnsY + alpha * cscA * dnsX
+// Mixed precision serial kernels, values are stored in T_Value and accumulated in T_Scalar
+// A(n x n)
+//
+template <typename T_Value, typename T_Scalar>
+void sym_x_vec_mixed(uplo_t uplo, int_t n, T_Scalar alpha, 
+		const int_t *colptr, const int_t *rowidx, const T_Value *values, 
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y);
+
+template <typename T_Value, typename T_Scalar>
+void hem_x_vec_mixed(uplo_t uplo, int_t n, T_Scalar alpha, 
+		const int_t *colptr, const int_t *rowidx, const T_Value *values, 
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y);
+
+//
+// Update: dnsY = beta * dnsY + alpha * cscA * dnsX
+// Mixed precision kernels on the stored triangle cscA and its transpose cscT, rows are gathered in parallel
+// A(n x n)
+//
+template <typename T_Value, typename T_Scalar>
+void sym_x_vec_mixed(int_t n, T_Scalar alpha, 
+		const int_t *colptr, const int_t *rowidx, const T_Value *values, 
+		const int_t *colptrT, const int_t *rowidxT, const T_Value *valuesT, 
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y);
+
+template <typename T_Value, typename T_Scalar>
+void hem_x_vec_mixed(int_t n, T_Scalar alpha, 
+		const int_t *colptr, const int_t *rowidx, const T_Value *values, 
+		const int_t *colptrT, const int_t *rowidxT, const T_Value *valuesT, 
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y);
+
+//
+// Update: dnsY = beta * dnsY + alpha * op(cscA) * dnsX
+// Pattern only kernels, all stored entries are implicitly 1
+// A(m x n) for gem, A(n x n) for sym
+//
+template <typename T_Scalar>
+void gem_x_vec_pattern(op_t opA, int_t m, int_t n, T_Scalar alpha, 
+		const int_t *colptr, const int_t *rowidx, 
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y);
+
+template <typename T_Scalar>
+void sym_x_vec_pattern(uplo_t uplo, int_t n, T_Scalar alpha, 
+		const int_t *colptr, const int_t *rowidx, 
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y);
+
 //
 // Update: dnsY = beta * dnsY + alpha * cscA * dnsX
 // A(n x n)
@@ -68,6 +190,18 @@ void hem_x_vec(uplo_t uplo, int_t n, T_Scalar alpha,
 
 //
 // Update: dnsC = beta * dnsC + alpha * opA(cscA) * dnsB
+// Native kernel, B & C are processed in row-major micro-panels of up to 16 columns
+// C(m x n)
+//
+template <typename T_Scalar>
+void gem_x_gem_native(op_t opA, int_t m, int_t n, int_t k, T_Scalar alpha,
+		const int_t *colptr, const int_t *rowidx, const T_Scalar *values, 
+		const T_Scalar *b, int_t ldb, T_Scalar beta, T_Scalar *c, int_t ldc);
+
+//
+// Update: dnsC = beta * dnsC + alpha * opA(cscA) * dnsB
+// Tall-skinny blocks (RMP_MIN_RHS <= n <= RMP_MAX_RHS) use gem_x_gem_native
+// Without a third party library gem_x_gem_native is used for all sizes
 // C(m x n)
 //
 template <typename T_Scalar>
@@ -104,15 +238,125 @@ void gem_x_gem(int_t m, int_t n, int_t k, T_Scalar alpha,
 		T_Scalar beta, T_Scalar *c, int_t ldc); 
 
 //
-// Update: cscC = opA(cscA) * opB(cscB)
+// Update: cscC = alpha * opA(cscA) * opB(cscB)
 // C(m x n)
 //
 template <typename T_Scalar>
-void gem_x_gem(int_t m, int_t n, int_t k,
+void gem_x_gem(int_t m, int_t n, int_t k, T_Scalar alpha,
 		op_t opA, const int_t *colptrA, const int_t *rowidxA, const T_Scalar *valuesA, 
 		op_t opB, const int_t *colptrB, const int_t *rowidxB, const T_Scalar *valuesB, 
 		int_t **colptrC, int_t **rowidxC, T_Scalar **valuesC); 
 
+//
+// Symbolic phase of cscC = opA(cscA) * opB(cscB)
+// Allocates colptrC & rowidxC (sorted columns), no values are computed
+// C(m x n)
+//
+void gem_x_gem_symbolic(int_t m, int_t n, int_t k,
+		op_t opA, const int_t *colptrA, const int_t *rowidxA,
+		op_t opB, const int_t *colptrB, const int_t *rowidxB,
+		int_t **colptrC, int_t **rowidxC);
+
+//
+// Symbolic phase of cscC = opA(cscA) * opB(cscB), resizes colptrC & rowidxC (sorted columns)
+// C(m x n)
+//
+void gem_x_gem_symbolic(int_t m, int_t n, int_t k,
+		op_t opA, const int_t *colptrA, const int_t *rowidxA,
+		op_t opB, const int_t *colptrB, const int_t *rowidxB,
+		std::vector<int_t>& colptrC, std::vector<int_t>& rowidxC);
+
+//
+// Numeric phase: cscC = beta * cscC + alpha * opA(cscA) * opB(cscB)
+// The pattern of cscC must contain the pattern of the product, otherwise cscC is left intact and NoConsistency is thrown
+// C(m x n)
+//
+template <typename T_Scalar>
+void gem_x_gem_numeric(int_t m, int_t n, int_t k, T_Scalar alpha,
+		op_t opA, const int_t *colptrA, const int_t *rowidxA, const T_Scalar *valuesA,
+		op_t opB, const int_t *colptrB, const int_t *rowidxB, const T_Scalar *valuesB,
+		T_Scalar beta, const int_t *colptrC, const int_t *rowidxC, T_Scalar *valuesC);
+
+//
+// Operand opX(cscX) of a sparse-sparse product
+// For op T/C, colptr & rowidx hold the transposed pattern and pos the positions of its entries in the values of X
+// For op N, pos is nullptr
+//
+struct ProductOperand {
+	const int_t *colptr;
+	const int_t *rowidx;
+	const int_t *pos;
+	bool conj;
+};
+
+//
+// Transposed pattern of X(m x n) with positions, for op T/C (buffers are cleared for op N)
+//
+void product_operand_pattern(op_t op, int_t m, int_t n, const int_t *colptr, const int_t *rowidx,
+		std::vector<int_t>& colptr_out, std::vector<int_t>& rowidx_out, std::vector<int_t>& pos_out);
+
+//
+// Operand of opX(X), using the buffers of product_operand_pattern() for op T/C
+//
+ProductOperand product_operand(op_t op, const int_t *colptr, const int_t *rowidx,
+		const std::vector<int_t>& colptr_t, const std::vector<int_t>& rowidx_t, const std::vector<int_t>& pos_t);
+
+//
+// Splits the n columns of C = A * B in parts with balanced multiply-add counts
+// Returns the number of parts, bounds(nparts + 1)
+//
+int_t product_partition(int_t n, const ProductOperand& A, const ProductOperand& B, std::vector<int_t>& bounds);
+
+//
+// Symbolic phase of cscC = A * B on prepared operands and partition
+// C(m x n)
+//
+void gem_x_gem_symbolic(int_t m, int_t n, 
+		const ProductOperand& A, const ProductOperand& B,
+		int_t nparts, const int_t *bounds,
+		int_t **colptrC, int_t **rowidxC);
+
+//
+// Symbolic phase of cscC = A * B on prepared operands and partition, resizes colptrC & rowidxC
+// C(m x n)
+//
+void gem_x_gem_symbolic(int_t m, int_t n, 
+		const ProductOperand& A, const ProductOperand& B,
+		int_t nparts, const int_t *bounds,
+		std::vector<int_t>& colptrC, std::vector<int_t>& rowidxC);
+
+//
+// Numeric phase: cscC = beta * cscC + alpha * A * B on prepared operands and partition
+// The pattern of cscC must be the one created by the symbolic phase (not checked)
+// C(m x n)
+//
+template <typename T_Scalar>
+void gem_x_gem_numeric(int_t m, int_t n, T_Scalar alpha,
+		const ProductOperand& A, const T_Scalar *valuesA,
+		const ProductOperand& B, const T_Scalar *valuesB,
+		T_Scalar beta, const int_t *colptrC, const int_t *rowidxC, T_Scalar *valuesC,
+		int_t nparts, const int_t *bounds);
+
+//
+// Level set analysis of triangular opA(cscA), A(n x n)
+// Builds the row-wise form of opA(A) without the diagonal:
+//   rowptr(n+1), colidx(nnz), valpos(nnz) positions in values of A, diagpos(n) diagonal positions
+// and groups the rows in dependency levels: levptr(n+1), order(n)
+// Returns the number of levels
+//
+int_t tri_levels(uplo_t uplo, op_t opA, int_t n, const int_t *colptr, const int_t *rowidx,
+		int_t *rowptr, int_t *colidx, int_t *valpos, int_t *diagpos, int_t *levptr, int_t *order);
+
+//
+// Solve: opA(cscA) * X = alpha * B, using the analysis of tri_levels()
+// Rows of the same level are solved in parallel
+// B(n x nrhs)
+//
+template <typename T_Scalar>
+void tri_x_gem_solve(op_t opA, int_t n, int_t nrhs, T_Scalar alpha, const T_Scalar *values,
+		const int_t *rowptr, const int_t *colidx, const int_t *valpos, const int_t *diagpos,
+		int_t nlevels, const int_t *levptr, const int_t *order, T_Scalar *b, int_t ldb);
+
 /*-------------------------------------------------*/
 } // namespace csc
 } // namespace blk
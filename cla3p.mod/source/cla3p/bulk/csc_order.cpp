@@ -0,0 +1,620 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/bulk/csc_order.hpp"
+
+// system
+#include <vector>
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+#include "cla3p/bulk/csc.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace blk {
+namespace csc {
+/*-------------------------------------------------*/
+//
+// Subgraphs up to this size are ordered with minimum degree in nested dissection
+//
+constexpr int_t ND_LEAF_SIZE = 256;
+//
+// Minimum subgraph size for a separate nested dissection task
+//
+constexpr int_t ND_TASK_SIZE = 4096;
+/*-------------------------------------------------*/
+//
+// Undirected graph in compressed form, no self loops
+//
+struct Graph {
+	int_t n = 0;
+	std::vector<int_t> xadj;
+	std::vector<int_t> adj;
+
+	int_t degree(int_t v) const { return xadj[v+1] - xadj[v]; }
+};
+/*-------------------------------------------------*/
+static void build_graph(int_t n, const int_t *colptr, const int_t *rowidx, Graph& g)
+{
+	std::vector<int_t> ptr(n + 1, 0);
+
+	for(int_t j = 0; j < n; j++) {
+		for(int_t irow = colptr[j]; irow < colptr[j+1]; irow++) {
+			int_t i = rowidx[irow];
+			if(i != j) {
+				ptr[i+1]++;
+				ptr[j+1]++;
+			} // offdiag
+		} // irow
+	} // j
+
+	roll(n, ptr.data());
+
+	std::vector<int_t> cursor(ptr.begin(), ptr.begin() + n);
+	std::vector<int_t> tmp(ptr[n]);
+
+	for(int_t j = 0; j < n; j++) {
+		for(int_t irow = colptr[j]; irow < colptr[j+1]; irow++) {
+			int_t i = rowidx[irow];
+			if(i != j) {
+				tmp[cursor[i]++] = j;
+				tmp[cursor[j]++] = i;
+			} // offdiag
+		} // irow
+	} // j
+
+	//
+	// Remove duplicates (entries present in both halves)
+	//
+
+	g.n = n;
+	g.xadj.resize(n + 1);
+	g.xadj[0] = 0;
+
+	bool multithreaded = (ptr[n] >= MT_NNZ_THRESHOLD);
+
+#pragma omp parallel for schedule(static) if(multithreaded)
+	for(int_t v = 0; v < n; v++) {
+		std::sort(tmp.begin() + ptr[v], tmp.begin() + ptr[v+1]);
+		g.xadj[v+1] = static_cast<int_t>(std::unique(tmp.begin() + ptr[v], tmp.begin() + ptr[v+1]) - (tmp.begin() + ptr[v]));
+	} // v
+
+	roll(n, g.xadj.data());
+
+	g.adj.resize(g.xadj[n]);
+
+#pragma omp parallel for schedule(static) if(multithreaded)
+	for(int_t v = 0; v < n; v++) {
+		std::copy(tmp.begin() + ptr[v], tmp.begin() + ptr[v] + g.degree(v), g.adj.begin() + g.xadj[v]);
+	} // v
+}
+/*-------------------------------------------------*/
+//
+// Level structure rooted at root, restricted to vertices with mark != stamp
+// Visited vertices are stored in queue, level l is [lvlptr[l], lvlptr[l+1])
+// Returns the number of levels
+//
+static int_t level_structure(const Graph& g, int_t root, std::vector<int_t>& mark, int_t stamp,
+		std::vector<int_t>& queue, std::vector<int_t>& lvlptr)
+{
+	queue.clear();
+	lvlptr.clear();
+
+	queue.push_back(root);
+	mark[root] = stamp;
+	lvlptr.push_back(0);
+
+	std::size_t bgn = 0;
+
+	while(bgn < queue.size()) {
+
+		std::size_t end = queue.size();
+
+		for(std::size_t q = bgn; q < end; q++) {
+			int_t v = queue[q];
+			for(int_t k = g.xadj[v]; k < g.xadj[v+1]; k++) {
+				int_t w = g.adj[k];
+				if(mark[w] != stamp) {
+					mark[w] = stamp;
+					queue.push_back(w);
+				} // unvisited
+			} // k
+		} // q
+
+		lvlptr.push_back(static_cast<int_t>(end));
+		bgn = end;
+
+	} // levels
+
+	return static_cast<int_t>(lvlptr.size()) - 1;
+}
+/*-------------------------------------------------*/
+//
+// George-Liu pseudo-peripheral vertex search in the component of root
+// On exit, queue & lvlptr hold the level structure of the returned vertex
+//
+static int_t pseudo_peripheral(const Graph& g, int_t root, std::vector<int_t>& mark, int_t& stamp,
+		std::vector<int_t>& queue, std::vector<int_t>& lvlptr)
+{
+	std::vector<int_t> queue2;
+	std::vector<int_t> lvlptr2;
+
+	int_t nlev = level_structure(g, root, mark, ++stamp, queue, lvlptr);
+
+	for(;;) {
+
+		int_t cand = queue[lvlptr[nlev-1]];
+		for(int_t q = lvlptr[nlev-1]; q < lvlptr[nlev]; q++) {
+			if(g.degree(queue[q]) < g.degree(cand)) {
+				cand = queue[q];
+			} // min degree
+		} // q
+
+		int_t nlev2 = level_structure(g, cand, mark, ++stamp, queue2, lvlptr2);
+
+		if(nlev2 <= nlev) 
+			break;
+
+		root = cand;
+		nlev = nlev2;
+		queue.swap(queue2);
+		lvlptr.swap(lvlptr2);
+
+	} // iterations
+
+	return root;
+}
+/*-------------------------------------------------*/
+static void rcm_order(const Graph& g, int_t *order)
+{
+	std::vector<int_t> mark(g.n, -1);
+	std::vector<char> visited(g.n, 0);
+	std::vector<int_t> queue;
+	std::vector<int_t> lvlptr;
+	std::vector<int_t> nbrs;
+
+	int_t stamp = 0;
+	int_t cnt = 0;
+
+	for(int_t s = 0; s < g.n; s++) {
+
+		if(visited[s]) continue;
+
+		int_t root = pseudo_peripheral(g, s, mark, stamp, queue, lvlptr);
+
+		int_t head = cnt;
+		order[cnt++] = root;
+		visited[root] = 1;
+
+		while(head < cnt) {
+
+			int_t v = order[head++];
+
+			nbrs.clear();
+			for(int_t k = g.xadj[v]; k < g.xadj[v+1]; k++) {
+				int_t w = g.adj[k];
+				if(!visited[w]) {
+					visited[w] = 1;
+					nbrs.push_back(w);
+				} // unvisited
+			} // k
+
+			std::stable_sort(nbrs.begin(), nbrs.end(), 
+					[&g](int_t a, int_t b) { return g.degree(a) < g.degree(b); });
+
+			for(int_t w : nbrs) {
+				order[cnt++] = w;
+			} // w
+
+		} // bfs
+
+	} // s
+
+	std::reverse(order, order + g.n);
+}
+/*-------------------------------------------------*/
+//
+// Minimum degree on the quotient graph with approximate external degrees
+// Each eliminated variable becomes an element, elements adjacent to the pivot are absorbed
+//
+static void amd_order(const Graph& g, int_t *order)
+{
+	const int_t n = g.n;
+
+	const char Variable = 0;
+	const char Element  = 1;
+	const char Absorbed = 2;
+
+	std::vector<std::vector<int_t> > A(n); // adjacent variables
+	std::vector<std::vector<int_t> > E(n); // adjacent elements
+	std::vector<std::vector<int_t> > L(n); // element variables
+
+	std::vector<char> status(n, Variable);
+	std::vector<int_t> degree(n);
+	std::vector<int_t> mark(n, -1);
+	std::vector<int_t> w(n, -1);
+	std::vector<int_t> touched;
+
+	//
+	// Degree lists
+	//
+	std::vector<int_t> head(n, -1);
+	std::vector<int_t> next(n, -1);
+	std::vector<int_t> prev(n, -1);
+
+	auto insert = [&](int_t v) {
+		int_t d = degree[v];
+		prev[v] = -1;
+		next[v] = head[d];
+		if(head[d] >= 0) prev[head[d]] = v;
+		head[d] = v;
+	};
+
+	auto remove = [&](int_t v) {
+		if(prev[v] >= 0) next[prev[v]] = next[v]; else head[degree[v]] = next[v];
+		if(next[v] >= 0) prev[next[v]] = prev[v];
+	};
+
+	for(int_t v = 0; v < n; v++) {
+		A[v].assign(g.adj.begin() + g.xadj[v], g.adj.begin() + g.xadj[v+1]);
+		degree[v] = g.degree(v);
+		insert(v);
+	} // v
+
+	int_t mindeg = 0;
+
+	for(int_t k = 0; k < n; k++) {
+
+		//
+		// Select pivot
+		//
+
+		while(head[mindeg] < 0) mindeg++;
+
+		int_t p = head[mindeg];
+		remove(p);
+
+		order[k] = p;
+		status[p] = Element;
+
+		//
+		// New element pattern, absorb adjacent elements
+		//
+
+		std::vector<int_t>& Lp = L[p];
+		Lp.clear();
+		mark[p] = k;
+
+		for(int_t v : A[p]) {
+			if(status[v] == Variable && mark[v] != k) {
+				mark[v] = k;
+				Lp.push_back(v);
+			} // new
+		} // v
+
+		for(int_t e : E[p]) {
+			if(status[e] != Element) continue;
+			for(int_t v : L[e]) {
+				if(status[v] == Variable && mark[v] != k) {
+					mark[v] = k;
+					Lp.push_back(v);
+				} // new
+			} // v
+			status[e] = Absorbed;
+			std::vector<int_t>().swap(L[e]);
+		} // e
+
+		std::vector<int_t>().swap(A[p]);
+		std::vector<int_t>().swap(E[p]);
+
+		//
+		// External element sizes |Le \ Lp|
+		//
+
+		touched.clear();
+
+		for(int_t i : Lp) {
+			for(int_t e : E[i]) {
+				if(status[e] != Element) continue;
+				if(w[e] < 0) {
+					w[e] = static_cast<int_t>(L[e].size());
+					touched.push_back(e);
+				}
+				w[e]--;
+			} // e
+		} // i
+
+		//
+		// Update variables in Lp
+		//
+
+		int_t nlp = static_cast<int_t>(Lp.size());
+		int_t nleft = n - k - 1;
+
+		for(int_t i : Lp) {
+
+			remove(i);
+
+			int_t d = nlp - 1;
+
+			std::vector<int_t>& Ei = E[i];
+			std::size_t ne = 0;
+			for(int_t e : Ei) {
+				if(status[e] == Element && w[e] > 0) {
+					Ei[ne++] = e;
+					d += w[e];
+				} // live
+			} // e
+			Ei.resize(ne);
+			Ei.push_back(p);
+
+			std::vector<int_t>& Ai = A[i];
+			std::size_t na = 0;
+			for(int_t v : Ai) {
+				if(status[v] == Variable && mark[v] != k) {
+					Ai[na++] = v;
+				} // outside Lp
+			} // v
+			Ai.resize(na);
+			d += static_cast<int_t>(na);
+
+			degree[i] = std::max(static_cast<int_t>(0), std::min(d, nleft - 1));
+			insert(i);
+			mindeg = std::min(mindeg, degree[i]);
+
+		} // i
+
+		//
+		// Elements covered by Lp are absorbed
+		//
+
+		for(int_t e : touched) {
+			if(w[e] == 0) {
+				status[e] = Absorbed;
+				std::vector<int_t>().swap(L[e]);
+			}
+			w[e] = -1;
+		} // e
+
+	} // k
+}
+/*-------------------------------------------------*/
+static void subgraph(const Graph& g, const std::vector<int_t>& verts, std::vector<int_t>& loc, Graph& sg)
+{
+	int_t ns = static_cast<int_t>(verts.size());
+
+	for(int_t k = 0; k < ns; k++) {
+		loc[verts[k]] = k;
+	} // k
+
+	sg.n = ns;
+	sg.xadj.resize(ns + 1);
+	sg.adj.clear();
+	sg.xadj[0] = 0;
+
+	for(int_t k = 0; k < ns; k++) {
+		int_t v = verts[k];
+		for(int_t kk = g.xadj[v]; kk < g.xadj[v+1]; kk++) {
+			int_t lw = loc[g.adj[kk]];
+			if(lw >= 0) {
+				sg.adj.push_back(lw);
+			} // inside
+		} // kk
+		sg.xadj[k+1] = static_cast<int_t>(sg.adj.size());
+	} // k
+
+	for(int_t k = 0; k < ns; k++) {
+		loc[verts[k]] = -1;
+	} // k
+}
+/*-------------------------------------------------*/
+static void leaf_order(const Graph& g, const int_t *gid, int_t *order)
+{
+	std::vector<int_t> lorder(g.n);
+
+	amd_order(g, lorder.data());
+
+	for(int_t k = 0; k < g.n; k++) {
+		order[k] = gid[lorder[k]];
+	} // k
+}
+/*-------------------------------------------------*/
+//
+// Splits g in parts A & B, separated by S (no edges between A & B)
+// Disconnected graphs are split by components with an empty separator
+// Returns false if no useful split exists
+//
+static bool dissect(const Graph& g, std::vector<int_t>& partA, std::vector<int_t>& partB, std::vector<int_t>& sep)
+{
+	std::vector<int_t> mark(g.n, -1);
+	std::vector<int_t> queue;
+	std::vector<int_t> lvlptr;
+	int_t stamp = 0;
+
+	partA.clear();
+	partB.clear();
+	sep.clear();
+
+	pseudo_peripheral(g, 0, mark, stamp, queue, lvlptr);
+	int_t nlev = static_cast<int_t>(lvlptr.size()) - 1;
+
+	if(static_cast<int_t>(queue.size()) < g.n) {
+
+		//
+		// Disconnected, fill A with whole components up to half the vertices
+		//
+
+		partA = queue;
+		std::vector<int_t> comp;
+
+		for(int_t v = 0; v < g.n; v++) {
+			if(mark[v] >= 0) continue;
+			level_structure(g, v, mark, ++stamp, comp, lvlptr);
+			std::vector<int_t>& part = (static_cast<int_t>(partA.size()) < g.n / 2 ? partA : partB);
+			part.insert(part.end(), comp.begin(), comp.end());
+		} // v
+
+		if(partB.empty()) {
+			// the first component holds more than half, move it to B
+			partB.assign(partA.begin(), partA.begin() + queue.size());
+			partA.erase(partA.begin(), partA.begin() + queue.size());
+		}
+
+		return true;
+	}
+
+	if(nlev < 3) 
+		return false;
+
+	//
+	// Middle level becomes the separator
+	//
+
+	int_t s = 1;
+	while(s < nlev - 2 && lvlptr[s+1] <= g.n / 2) s++;
+
+	std::vector<char> side(g.n); // 0: A, 1: S, 2: B
+
+	for(int_t l = 0; l < nlev; l++) {
+		char sd = (l < s ? 0 : (l == s ? 1 : 2));
+		for(int_t q = lvlptr[l]; q < lvlptr[l+1]; q++) {
+			side[queue[q]] = sd;
+		} // q
+	} // l
+
+	//
+	// Separator vertices without neighbors in B move to A
+	//
+
+	for(int_t q = lvlptr[s]; q < lvlptr[s+1]; q++) {
+		int_t v = queue[q];
+		bool touchesB = false;
+		for(int_t k = g.xadj[v]; k < g.xadj[v+1] && !touchesB; k++) {
+			touchesB = (side[g.adj[k]] == 2);
+		} // k
+		if(!touchesB) side[v] = 0;
+	} // q
+
+	for(int_t v = 0; v < g.n; v++) {
+		if(side[v] == 0) partA.push_back(v);
+		else if(side[v] == 1) sep.push_back(v);
+		else partB.push_back(v);
+	} // v
+
+	return true;
+}
+/*-------------------------------------------------*/
+static void nd_recurse(const Graph& g, const int_t *gid, int_t *order)
+{
+	std::vector<int_t> partA;
+	std::vector<int_t> partB;
+	std::vector<int_t> sep;
+
+	if(g.n <= ND_LEAF_SIZE || !dissect(g, partA, partB, sep)) {
+		leaf_order(g, gid, order);
+		return;
+	}
+
+	Graph gA;
+	Graph gB;
+	std::vector<int_t> loc(g.n, -1);
+
+	subgraph(g, partA, loc, gA);
+	subgraph(g, partB, loc, gB);
+
+	std::vector<int_t> gidA(partA.size());
+	std::vector<int_t> gidB(partB.size());
+
+	for(std::size_t k = 0; k < partA.size(); k++) gidA[k] = gid[partA[k]];
+	for(std::size_t k = 0; k < partB.size(); k++) gidB[k] = gid[partB[k]];
+
+	int_t *orderA = order;
+	int_t *orderB = order + gA.n;
+	int_t *orderS = order + gA.n + gB.n;
+
+	for(std::size_t k = 0; k < sep.size(); k++) {
+		orderS[k] = gid[sep[k]];
+	} // k
+
+#pragma omp task shared(gA, gidA) if(gA.n >= ND_TASK_SIZE)
+	nd_recurse(gA, gidA.data(), orderA);
+
+#pragma omp task shared(gB, gidB) if(gB.n >= ND_TASK_SIZE)
+	nd_recurse(gB, gidB.data(), orderB);
+
+#pragma omp taskwait
+}
+/*-------------------------------------------------*/
+static void order_to_perm(int_t n, const int_t *order, int_t *P)
+{
+	for(int_t k = 0; k < n; k++) {
+		P[order[k]] = k;
+	} // k
+}
+/*-------------------------------------------------*/
+void order_rcm(int_t n, const int_t *colptr, const int_t *rowidx, int_t *P)
+{
+	Graph g;
+	build_graph(n, colptr, rowidx, g);
+
+	std::vector<int_t> order(n);
+	rcm_order(g, order.data());
+
+	order_to_perm(n, order.data(), P);
+}
+/*-------------------------------------------------*/
+void order_amd(int_t n, const int_t *colptr, const int_t *rowidx, int_t *P)
+{
+	Graph g;
+	build_graph(n, colptr, rowidx, g);
+
+	std::vector<int_t> order(n);
+	amd_order(g, order.data());
+
+	order_to_perm(n, order.data(), P);
+}
+/*-------------------------------------------------*/
+void order_nd(int_t n, const int_t *colptr, const int_t *rowidx, int_t *P)
+{
+	Graph g;
+	build_graph(n, colptr, rowidx, g);
+
+	std::vector<int_t> gid(n);
+	std::vector<int_t> order(n);
+
+	for(int_t v = 0; v < n; v++) {
+		gid[v] = v;
+	} // v
+
+	bool multithreaded = (n > ND_TASK_SIZE);
+
+#pragma omp parallel if(multithreaded)
+	{
+#pragma omp single
+		nd_recurse(g, gid.data(), order.data());
+	} // omp parallel
+
+	order_to_perm(n, order.data(), P);
+}
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace blk
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_BULK_CSC_ORDER_HPP_
+#define CLA3P_BULK_CSC_ORDER_HPP_
+
+/**
+ * @file
+ */
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace blk {
+namespace csc {
+/*-------------------------------------------------*/
+
+//
+// Orderings of the adjacency graph of (cscA + cscA^T), A(n x n)
+// Diagonal entries are ignored, so stored halves of symmetric matrices are handled as well
+// On exit P(n) holds the new position of each index (compatible with permute)
+//
+
+//
+// Reverse Cuthill-McKee (bandwidth reducing)
+//
+void order_rcm(int_t n, const int_t *colptr, const int_t *rowidx, int_t *P);
+
+//
+// Approximate minimum degree (fill reducing)
+//
+void order_amd(int_t n, const int_t *colptr, const int_t *rowidx, int_t *P);
+
+//
+// Nested dissection with level structure separators (fill reducing)
+// Subgraphs are ordered in parallel
+//
+void order_nd(int_t n, const int_t *colptr, const int_t *rowidx, int_t *P);
+
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace blk
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_BULK_CSC_ORDER_HPP_
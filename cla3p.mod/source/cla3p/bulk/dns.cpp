@@ -19,6 +19,7 @@
 
 // system
 #include <functional>
+#include <limits>
 
 // 3rd
 
@@ -32,6 +33,7 @@
 #include "cla3p/support/utils.hpp"
 #include "cla3p/support/imalloc.hpp"
 #include "cla3p/support/rand.hpp"
+#include "cla3p/bulk/csc.hpp"
 #include "cla3p/checks/basic_checks.hpp"
 #if defined(CLA3P_INTEL_MKL)
 #include "cla3p/proxies/mkl_proxy.hpp"
@@ -201,6 +203,47 @@ template <> void copy(uplo_t uplo, int_t m, int_t n, const complex8_t *a, int_t
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
+template <typename T_Out>
+static inline bool convert_overflows(real_t val)
+{
+	return (std::abs(val) > static_cast<real_t>(std::numeric_limits<T_Out>::max()));
+}
+/*-------------------------------------------------*/
+template <typename T_Out>
+static inline bool convert_overflows(real4_t)
+{
+	return false;
+}
+/*-------------------------------------------------*/
+template <typename T_In, typename T_Out>
+bool convert(uplo_t uplo, int_t m, int_t n, const T_In *a, int_t lda, T_Out *b, int_t ldb)
+{
+	using T_RIn = typename TypeTraits<T_In>::real_type;
+	using T_ROut = typename TypeTraits<T_Out>::real_type;
+
+	bool overflow = false;
+
+	for(int_t j = 0; j < n; j++) {
+		RowRange ir = irange(uplo, m, j);
+		for(int_t i = ir.ibgn; i < ir.iend; i++) {
+			T_RIn re = arith::getRe(entry(lda,a,i,j));
+			T_RIn im = arith::getIm(entry(lda,a,i,j));
+			overflow = overflow || convert_overflows<T_ROut>(re) || convert_overflows<T_ROut>(im);
+			T_Out val = static_cast<T_ROut>(re);
+			arith::setIm(val, static_cast<T_ROut>(im));
+			entry(ldb,b,i,j) = val;
+		} // i
+	} // j
+
+	return !overflow;
+}
+/*-------------------------------------------------*/
+template bool convert(uplo_t, int_t, int_t, const real_t    *, int_t, real4_t   *, int_t);
+template bool convert(uplo_t, int_t, int_t, const real4_t   *, int_t, real_t    *, int_t);
+template bool convert(uplo_t, int_t, int_t, const complex_t *, int_t, complex8_t*, int_t);
+template bool convert(uplo_t, int_t, int_t, const complex8_t*, int_t, complex_t *, int_t);
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
 template <typename T_Scalar>
 static void get_real_no_mkl(uplo_t uplo, int_t m, int_t n, const T_Scalar *a, int_t lda, typename TypeTraits<T_Scalar>::real_type *b, int_t ldb)
 {
@@ -1060,6 +1103,73 @@ instantiate_permute(complex_t);
 instantiate_permute(complex8_t);
 #undef instantiate_permute
 /*-------------------------------------------------*/
+static inline RowRange to_csc_irange(prop_t ptype, uplo_t uplo, int_t m, int_t j)
+{
+	return (ptype == prop_t::Skew ? irange_strict(uplo, m, j) : irange(uplo, m, j));
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void to_csc_colptr(prop_t ptype, uplo_t uplo, int_t m, int_t n, const T_Scalar *a, int_t lda, 
+		typename TypeTraits<T_Scalar>::real_type thres, bool keepdiag, int_t *colptr)
+{
+	keepdiag = (keepdiag && ptype != prop_t::Skew);
+
+	colptr[0] = 0;
+
+#pragma omp parallel for schedule(dynamic,16) if(static_cast<long long int>(m) * n >= csc::MT_NNZ_THRESHOLD)
+	for(int_t j = 0; j < n; j++) {
+		RowRange ir = to_csc_irange(ptype, uplo, m, j);
+		const T_Scalar *aj = ptrmv(lda,a,0,j);
+		int_t cnt = 0;
+		for(int_t i = ir.ibgn; i < ir.iend; i++) {
+			if(std::abs(aj[i]) > thres || (keepdiag && i == j)) cnt++;
+		} // i
+		colptr[j+1] = cnt;
+	} // j
+
+	csc::roll(n, colptr);
+}
+/*-------------------------------------------------*/
+#define instantiate_to_csc_colptr(T_Scl) \
+template void to_csc_colptr(prop_t, uplo_t, int_t, int_t, const T_Scl*, int_t, \
+		typename TypeTraits<T_Scl>::real_type, bool, int_t*)
+instantiate_to_csc_colptr(real_t);
+instantiate_to_csc_colptr(real4_t);
+instantiate_to_csc_colptr(complex_t);
+instantiate_to_csc_colptr(complex8_t);
+#undef instantiate_to_csc_colptr
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void to_csc(prop_t ptype, uplo_t uplo, int_t m, int_t n, const T_Scalar *a, int_t lda, 
+		typename TypeTraits<T_Scalar>::real_type thres, bool keepdiag, 
+		const int_t *colptr, int_t *rowidx, T_Scalar *values)
+{
+	keepdiag = (keepdiag && ptype != prop_t::Skew);
+
+#pragma omp parallel for schedule(dynamic,16) if(static_cast<long long int>(m) * n >= csc::MT_NNZ_THRESHOLD)
+	for(int_t j = 0; j < n; j++) {
+		RowRange ir = to_csc_irange(ptype, uplo, m, j);
+		const T_Scalar *aj = ptrmv(lda,a,0,j);
+		int_t pos = colptr[j];
+		for(int_t i = ir.ibgn; i < ir.iend; i++) {
+			if(std::abs(aj[i]) > thres || (keepdiag && i == j)) {
+				rowidx[pos] = i;
+				values[pos] = aj[i];
+				pos++;
+			}
+		} // i
+	} // j
+}
+/*-------------------------------------------------*/
+#define instantiate_to_csc(T_Scl) \
+template void to_csc(prop_t, uplo_t, int_t, int_t, const T_Scl*, int_t, \
+		typename TypeTraits<T_Scl>::real_type, bool, const int_t*, int_t*, T_Scl*)
+instantiate_to_csc(real_t);
+instantiate_to_csc(real4_t);
+instantiate_to_csc(complex_t);
+instantiate_to_csc(complex8_t);
+#undef instantiate_to_csc
+/*-------------------------------------------------*/
 } // namespace dns
 } // namespace blk
 } // namespace cla3p
@@ -89,6 +89,13 @@ template <typename T_Scalar>
 void copy(uplo_t uplo, int_t m, int_t n, const T_Scalar *a, int_t lda,
 		T_Scalar *b, int_t ldb, T_Scalar coeff = T_Scalar(1));
 
+//
+// Copy with precision conversion (e.g. double to single)
+// Returns false if an entry overflows the output precision
+//
+template <typename T_In, typename T_Out>
+bool convert(uplo_t uplo, int_t m, int_t n, const T_In *a, int_t lda, T_Out *b, int_t ldb);
+
 //
 // Get real part from complex
 //
@@ -209,6 +216,20 @@ template <typename T_Scalar>
 void permute(prop_t ptype, uplo_t uplo, int_t m, int_t n, const T_Scalar *a, int_t lda, 
 		T_Scalar *b, int_t ldb, const int_t *P, const int_t *Q);
 
+//
+// Dense to compressed sparse column conversion, entries with magnitude not exceeding thres are dropped
+// Only the uplo part is referenced (strict part for skew), keepdiag retains diagonal entries regardless of magnitude
+// Columns are emitted sorted, colptr(n + 1) is filled by to_csc_colptr, rowidx & values sized by colptr[n]
+//
+template <typename T_Scalar>
+void to_csc_colptr(prop_t ptype, uplo_t uplo, int_t m, int_t n, const T_Scalar *a, int_t lda, 
+		typename TypeTraits<T_Scalar>::real_type thres, bool keepdiag, int_t *colptr);
+
+template <typename T_Scalar>
+void to_csc(prop_t ptype, uplo_t uplo, int_t m, int_t n, const T_Scalar *a, int_t lda, 
+		typename TypeTraits<T_Scalar>::real_type thres, bool keepdiag, 
+		const int_t *colptr, int_t *rowidx, T_Scalar *values);
+
 /*-------------------------------------------------*/
 } // namespace dns
 } // namespace blk
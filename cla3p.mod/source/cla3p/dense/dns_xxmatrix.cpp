@@ -23,6 +23,7 @@
 
 // cla3p
 #include "cla3p/perms.hpp"
+#include "cla3p/sparse/csc_xxmatrix.hpp"
 
 #include "cla3p/bulk/dns.hpp"
 #include "cla3p/bulk/dns_math.hpp"
@@ -31,6 +32,7 @@
 #include "cla3p/error/exceptions.hpp"
 #include "cla3p/error/literals.hpp"
 #include "cla3p/support/utils.hpp"
+#include "cla3p/support/imalloc.hpp"
 
 #include "cla3p/checks/basic_checks.hpp"
 #include "cla3p/checks/dns_checks.hpp"
@@ -367,6 +369,33 @@ void XxMatrix<T_Scalar>::igeneral()
 }
 /*-------------------------------------------------*/
 template <typename T_Scalar>
+csc::XxMatrix<int_t,T_Scalar> XxMatrix<T_Scalar>::toCsc(T_RScalar tol, droptol_t mode, bool keepDiagonal) const
+{
+	if(empty()) 
+		return csc::XxMatrix<int_t,T_Scalar>();
+
+	if(tol < 0) {
+		throw err::InvalidOp("Drop tolerance must be non negative");
+	}
+
+	T_RScalar thres = (mode == droptol_t::Relative ? tol * normMax() : tol);
+
+	int_t *cptr = i_malloc<int_t>(ncols() + 1);
+
+	blk::dns::to_csc_colptr(prop().type(), prop().uplo(), nrows(), ncols(), this->values(), ld(), 
+			thres, keepDiagonal, cptr);
+
+	int_t nz = cptr[ncols()];
+	int_t    *ridx = i_malloc<int_t>(nz);
+	T_Scalar *vals = i_malloc<T_Scalar>(nz);
+
+	blk::dns::to_csc(prop().type(), prop().uplo(), nrows(), ncols(), this->values(), ld(), 
+			thres, keepDiagonal, cptr, ridx, vals);
+
+	return csc::XxMatrix<int_t,T_Scalar>(nrows(), ncols(), cptr, ridx, vals, true, prop());
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
 XxMatrix<T_Scalar> XxMatrix<T_Scalar>::permuteLeftRight(const prm::PiMatrix& P, const prm::PiMatrix& Q) const
 {
 	XxMatrix<T_Scalar> ret(nrows(), ncols(), prop());
@@ -39,6 +39,7 @@ namespace cla3p {
 /*-------------------------------------------------*/
 
 namespace prm { template <typename T_Int> class PxMatrix; }
+namespace csc { template <typename T_Int, typename T_Scalar> class XxMatrix; }
 
 /*-------------------------------------------------*/
 namespace dns {
@@ -269,6 +270,17 @@ class XxMatrix : public MatrixMeta, public XxContainer<T_Scalar> {
 		 */
 		void igeneral();
 
+		/**
+		 * @brief Converts to a compressed sparse column matrix.
+		 * @details Creates a sparse copy of `*this` with the same property, only the referenced part of the matrix is scanned. @n
+		 *          Entries with magnitude not exceeding the drop threshold are discarded, columns are created with sorted row indices.
+		 * @param[in] tol The drop tolerance (zero drops exact zeros only).
+		 * @param[in] mode The interpretation of tol, Relative scales tol with the largest entry magnitude.
+		 * @param[in] keepDiagonal Keeps diagonal entries regardless of their magnitude.
+		 * @return The compressed sparse column matrix.
+		 */
+		csc::XxMatrix<int_t,T_Scalar> toCsc(T_RScalar tol = 0, droptol_t mode = droptol_t::Absolute, bool keepDiagonal = false) const;
+
 		/**
 		 * @copydoc standard_matrix_docs::permute_leftright()
 		 */
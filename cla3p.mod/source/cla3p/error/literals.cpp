@@ -124,6 +124,26 @@ std::string PardisoError()
 	return "Pardiso error";
 }
 /*-------------------------------------------------*/
+std::string PatternMismatch()
+{ 
+	return "Entries outside the sparsity pattern detected";
+}
+/*-------------------------------------------------*/
+std::string AnalysisMismatch()
+{ 
+	return "Matrix does not match the stored analysis";
+}
+/*-------------------------------------------------*/
+std::string InvalidPartition()
+{ 
+	return "Partition boundaries must start at zero, end at the dimension and be strictly increasing";
+}
+/*-------------------------------------------------*/
+std::string NonPositivePivot()
+{ 
+	return "Non positive pivot detected";
+}
+/*-------------------------------------------------*/
 } // namespace msg
 } // namespace cla3p
 /*-------------------------------------------------*/
@@ -50,6 +50,10 @@ std::string DivisionByZero();
 std::string HermitianInconsistency();
 std::string SkewInconsistency();
 std::string PardisoError();
+std::string PatternMismatch();
+std::string AnalysisMismatch();
+std::string InvalidPartition();
+std::string NonPositivePivot();
 
 /*-------------------------------------------------*/
 } // namespace msg
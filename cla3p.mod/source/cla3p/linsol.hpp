@@ -23,6 +23,8 @@
 #include "cla3p/linsol/lapack_ldlt.hpp"
 #include "cla3p/linsol/lapack_lu.hpp"
 #include "cla3p/linsol/lapack_complete_lu.hpp"
+#include "cla3p/linsol/lapack_mixed_precision.hpp"
+#include "cla3p/linsol/lapack_batch.hpp"
 
 #include "cla3p/linsol/pardiso_base.hpp"
 #include "cla3p/linsol/pardiso_auto.hpp"
@@ -31,4 +33,14 @@
 #include "cla3p/linsol/pardiso_lu.hpp"
 #include "cla3p/linsol/pardiso_symmetric_lu.hpp"
 
+#include "cla3p/linsol/krylov_options.hpp"
+#include "cla3p/linsol/krylov_base.hpp"
+#include "cla3p/linsol/krylov_cg.hpp"
+#include "cla3p/linsol/krylov_minres.hpp"
+#include "cla3p/linsol/krylov_gmres.hpp"
+#include "cla3p/linsol/krylov_bicgstab.hpp"
+#include "cla3p/linsol/incomplete_lu.hpp"
+#include "cla3p/linsol/incomplete_cholesky.hpp"
+#include "cla3p/linsol/algebraic_multigrid.hpp"
+
 #endif // CLA3P_LINSOL_HPP_
@@ -0,0 +1,650 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/linsol/algebraic_multigrid.hpp"
+
+// system
+#include <cmath>
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/linsol/pardiso_auto.hpp"
+#include "cla3p/sparse.hpp"
+#include "cla3p/generic/guard.hpp"
+#include "cla3p/algebra/functional_multmv.hpp"
+#include "cla3p/algebra/functional_multmm.hpp"
+#include "cla3p/bulk/csc.hpp"
+#include "cla3p/bulk/csc_math.hpp"
+#include "cla3p/bulk/csc_amg.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/checks/basic_checks.hpp"
+#include "cla3p/checks/decomp_xx_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static typename TypeTraits<T_Scalar>::real_type vnorm(int_t n, const T_Scalar *x)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	T_RScalar sum = 0;
+
+#pragma omp parallel for reduction(+:sum) if(n >= blk::csc::MT_NNZ_THRESHOLD)
+	for(int_t i = 0; i < n; i++) {
+		sum += std::norm(x[i]);
+	} // i
+
+	return std::sqrt(sum);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+static unsigned long long pattern_fingerprint(const T_Matrix& mat)
+{
+	return blk::csc::pattern_hash(mat.prop().type(), mat.prop().uplo(), mat.nrows(), mat.ncols(), mat.colptr(), mat.rowidx());
+}
+/*-------------------------------------------------*/
+//
+// Largest coarsest level solved with a dense factorization when coarsening stops early
+//
+static const int_t DENSE_COARSE_LIMIT = 2000;
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+AlgebraicMultigrid<T_Matrix>::AlgebraicMultigrid()
+{
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+AlgebraicMultigrid<T_Matrix>::~AlgebraicMultigrid()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+std::string AlgebraicMultigrid<T_Matrix>::name() const
+{
+	return "Smoothed aggregation AMG";
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void AlgebraicMultigrid<T_Matrix>::defaults()
+{
+	m_theta = T_RScalar(0.08);
+	m_maxLevels = 10;
+	m_coarseSize = 300;
+	m_smoother = amg::smoother_t::GaussSeidel;
+	m_preSweeps = 1;
+	m_postSweeps = 1;
+	m_cycle = amg::cycle_t::V;
+	m_coarse = amg::coarse_t::Lapack;
+
+	m_dim = 0;
+	m_nnz = 0;
+	m_fingerprint = 0;
+
+	m_iterations = 0;
+	m_converged = false;
+	m_resNorm = 0;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void AlgebraicMultigrid<T_Matrix>::clearHierarchy()
+{
+	m_dim = 0;
+	m_nnz = 0;
+	m_fingerprint = 0;
+	m_levels.clear();
+	m_lapack.clear();
+	m_pardiso.reset();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void AlgebraicMultigrid<T_Matrix>::clear()
+{
+	krylov::Params<T_Scalar>::clear();
+
+	clearHierarchy();
+	m_history.clear();
+
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void AlgebraicMultigrid<T_Matrix>::setStrengthThreshold(T_RScalar theta)
+{
+	if(theta < 0 || theta > 1) {
+		throw err::InvalidOp("Strength threshold must be in [0,1]");
+	}
+
+	clearHierarchy();
+	m_theta = theta;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void AlgebraicMultigrid<T_Matrix>::setMaxLevels(int_t nlev)
+{
+	if(nlev < 1) {
+		throw err::InvalidOp("Number of levels must be positive");
+	}
+
+	clearHierarchy();
+	m_maxLevels = nlev;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void AlgebraicMultigrid<T_Matrix>::setCoarseSize(int_t n)
+{
+	if(n < 1) {
+		throw err::InvalidOp("Coarse size must be positive");
+	}
+
+	clearHierarchy();
+	m_coarseSize = n;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void AlgebraicMultigrid<T_Matrix>::setSmoother(amg::smoother_t smoother)
+{
+	m_smoother = smoother;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void AlgebraicMultigrid<T_Matrix>::setSweeps(int_t pre, int_t post)
+{
+	if(pre < 0 || post < 0 || pre + post == 0) {
+		throw err::InvalidOp("Invalid number of smoothing sweeps");
+	}
+
+	m_preSweeps = pre;
+	m_postSweeps = post;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void AlgebraicMultigrid<T_Matrix>::setCycle(amg::cycle_t cycle)
+{
+	m_cycle = cycle;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void AlgebraicMultigrid<T_Matrix>::setCoarseSolver(amg::coarse_t coarse)
+{
+	clearHierarchy();
+	m_coarse = coarse;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void AlgebraicMultigrid<T_Matrix>::analysis(const T_Matrix& mat)
+{
+	decomp_generic_check(mat);
+
+	clearHierarchy();
+
+	m_levels.reserve(m_maxLevels);
+	m_levels.emplace_back();
+	m_levels[0].A = (mat.prop().isGeneral() ? mat.copy() : mat.general());
+
+	for(int_t l = 0; ; l++) {
+
+		int_t n = m_levels[l].A.ncols();
+
+		m_levels[l].b.resize(n);
+		m_levels[l].x.resize(n);
+		m_levels[l].r.resize(n);
+		m_levels[l].work.resize(2 * n);
+
+		if(l + 1 == m_maxLevels || !coarsen(l))
+			break;
+
+		numericLevel(l);
+
+	} // l
+
+	const T_Matrix& Ac = m_levels.back().A;
+
+	bool sparseCoarse = (m_coarse == amg::coarse_t::Pardiso);
+
+#if defined(CLA3P_INTEL_MKL)
+	//
+	// Coarsening stopped early (level cap or stalled aggregation), avoid a large dense factorization
+	//
+	sparseCoarse = (sparseCoarse || (Ac.ncols() > m_coarseSize && Ac.ncols() > DENSE_COARSE_LIMIT));
+#endif
+
+	if(sparseCoarse) {
+		m_pardiso.reset(new PardisoAuto<T_Matrix>());
+		m_pardiso->analysis(Ac);
+	} // symbolic
+
+	numericCoarsest();
+
+	m_dim = mat.ncols();
+	m_nnz = mat.nnz();
+	m_fingerprint = pattern_fingerprint(mat);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+bool AlgebraicMultigrid<T_Matrix>::coarsen(int_t l)
+{
+	const T_Matrix& A = m_levels[l].A;
+
+	int_t n = A.ncols();
+
+	if(n <= m_coarseSize)
+		return false;
+
+	//
+	// Aggregates of the strength graph
+	//
+
+	int_t *colptrG = nullptr;
+	int_t *rowidxG = nullptr;
+
+	blk::csc::amg_strength(n, A.colptr(), A.rowidx(), A.values(), m_theta, &colptrG, &rowidxG);
+
+	std::vector<int_t> agg(n);
+	int_t nagg = blk::csc::amg_aggregate(n, colptrG, rowidxG, agg.data());
+
+	i_free(colptrG);
+	i_free(rowidxG);
+
+	if(nagg == 0 || nagg >= n)
+		return false;
+
+	//
+	// Tentative prolongator & smoothing operator
+	//
+
+	int_t *colptrP0 = i_malloc<int_t>(nagg + 1);
+	blk::csc::amg_tentative_colptr(n, nagg, agg.data(), colptrP0);
+
+	int_t    *rowidxP0 = i_malloc<int_t>(colptrP0[nagg]);
+	T_Scalar *valuesP0 = i_malloc<T_Scalar>(colptrP0[nagg]);
+	blk::csc::amg_tentative(n, nagg, agg.data(), colptrP0, rowidxP0, valuesP0);
+
+	std::vector<int_t> colptrI(n + 1);
+	std::vector<int_t> rowidxI(n);
+
+	for(int_t j = 0; j < n; j++) {
+		colptrI[j] = j;
+		rowidxI[j] = j;
+	} // j
+	colptrI[n] = n;
+
+	int_t *colptrS = nullptr;
+	int_t *rowidxS = nullptr;
+
+	blk::csc::add_symbolic(n, A.colptr(), A.rowidx(), colptrI.data(), rowidxI.data(), &colptrS, &rowidxS);
+
+	T_Scalar *valuesS = i_malloc<T_Scalar>(colptrS[n]);
+
+	Level& lev = m_levels[l];
+
+	lev.P0 = T_Matrix(n, nagg, colptrP0, rowidxP0, valuesP0, true);
+	lev.S = T_Matrix(n, n, colptrS, rowidxS, valuesS, true);
+
+	//
+	// Patterns of the smoothed prolongator & the Galerkin product
+	//
+
+	lev.P = ops::symbolicMult(op_t::N, lev.S, op_t::N, lev.P0, lev.planP);
+	lev.AP = ops::symbolicMult(op_t::N, lev.A, op_t::N, lev.P, lev.planAP);
+
+	Level next;
+	next.A = ops::symbolicMult(op_t::C, lev.P, op_t::N, lev.AP, lev.planAc);
+	m_levels.push_back(std::move(next));
+
+	return true;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void AlgebraicMultigrid<T_Matrix>::numericLevel(int_t l)
+{
+	Level& lev = m_levels[l];
+	const T_Matrix& A = lev.A;
+
+	int_t n = A.ncols();
+
+	//
+	// Row access & smoother data
+	//
+
+	if(!lev.At) {
+		lev.At = T_Matrix(n, n, A.nnz());
+	}
+
+	blk::csc::transpose(n, n, A.colptr(), A.rowidx(), A.values(), lev.At.colptr(), lev.At.rowidx(), lev.At.values());
+
+	lev.diag.resize(n);
+	blk::csc::amg_diagonal(n, A.colptr(), A.rowidx(), A.values(), lev.diag.data());
+	lev.rho = blk::csc::amg_rho_bound(n, lev.At.colptr(), lev.At.values(), lev.diag.data());
+
+	int_t nparts = blk::csc::num_column_parts(n, lev.At.colptr());
+	lev.bounds.resize(nparts + 1);
+	blk::csc::partition_columns(n, lev.At.colptr(), nparts, lev.bounds.data());
+
+	//
+	// P = (I - omega * inv(D) * A) * P0, A_next = P^H * A * P
+	//
+
+	T_RScalar omega = T_RScalar(4) / (3 * lev.rho);
+
+	blk::csc::amg_jacobi_operator(n, A.colptr(), A.rowidx(), A.values(), lev.diag.data(), omega,
+			lev.S.colptr(), lev.S.rowidx(), lev.S.values());
+
+	ops::mult(T_Scalar(1), lev.planP, lev.S, lev.P0, T_Scalar(0), lev.P);
+	ops::mult(T_Scalar(1), lev.planAP, lev.A, lev.P, T_Scalar(0), lev.AP);
+	ops::mult(T_Scalar(1), lev.planAc, lev.P, lev.AP, T_Scalar(0), m_levels[l+1].A);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void AlgebraicMultigrid<T_Matrix>::numericCoarsest()
+{
+	const T_Matrix& A = m_levels.back().A;
+
+	if(m_pardiso) {
+		m_pardiso->decompose(A);
+	} else {
+		m_lapack.decompose(T_DnsMatrix(A.toDns()));
+	} // coarse
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void AlgebraicMultigrid<T_Matrix>::copyFinestValues(const T_Matrix& mat)
+{
+	T_Matrix& A = m_levels[0].A;
+
+	if(mat.prop().isGeneral()) {
+		std::copy(mat.values(), mat.values() + A.nnz(), A.values());
+	} else {
+		T_Matrix tmp = mat.general();
+		std::copy(tmp.values(), tmp.values() + A.nnz(), A.values());
+	} // prop
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void AlgebraicMultigrid<T_Matrix>::decompose(const T_Matrix& mat)
+{
+	decomp_generic_check(mat);
+
+	if(m_levels.empty()) {
+		analysis(mat);
+		return;
+	} // first setup
+
+	if(mat.ncols() != m_dim || mat.nnz() != m_nnz || pattern_fingerprint(mat) != m_fingerprint) {
+		throw err::NoConsistency(msg::AnalysisMismatch());
+	}
+
+	copyFinestValues(mat);
+
+	for(int_t l = 0; l + 1 < levels(); l++) {
+		numericLevel(l);
+	} // l
+
+	numericCoarsest();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void AlgebraicMultigrid<T_Matrix>::smooth(const Level& lev, int_t nsweeps, bool post, const T_Scalar *b, T_Scalar *x) const
+{
+	if(!nsweeps)
+		return;
+
+	int_t n = lev.A.ncols();
+	const int_t *rowptr = lev.At.colptr();
+	const int_t *colidx = lev.At.rowidx();
+	const T_Scalar *values = lev.At.values();
+
+	switch(m_smoother) {
+
+		case amg::smoother_t::Jacobi:
+			blk::csc::amg_jacobi(n, rowptr, colidx, values, lev.diag.data(), 
+					T_RScalar(4) / (3 * lev.rho), nsweeps, b, x, lev.work.data());
+			break;
+
+		case amg::smoother_t::GaussSeidel:
+			blk::csc::amg_gauss_seidel(n, rowptr, colidx, values, lev.diag.data(), 
+					post, nsweeps, static_cast<int_t>(lev.bounds.size()) - 1, lev.bounds.data(), b, x, lev.work.data());
+			break;
+
+		case amg::smoother_t::Chebyshev:
+			blk::csc::amg_chebyshev(n, rowptr, colidx, values, lev.diag.data(), 
+					lev.rho / 30, lev.rho, nsweeps, b, x, lev.work.data());
+			break;
+
+	} // smoother
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void AlgebraicMultigrid<T_Matrix>::coarseSolve(const T_Scalar *b, T_Scalar *x) const
+{
+	int_t n = m_levels.back().A.ncols();
+
+	T_Vector X(n, x, false);
+
+	if(m_pardiso) {
+		Guard<T_Vector> grdB = T_Vector::view(n, b);
+		m_pardiso->solve(grdB.get(), X);
+	} else {
+		std::copy(b, b + n, x);
+		m_lapack.solve(X);
+	} // coarse
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void AlgebraicMultigrid<T_Matrix>::cycle(int_t l, const T_Scalar *b, T_Scalar *x) const
+{
+	if(l + 1 == levels()) {
+		coarseSolve(b, x);
+		return;
+	} // coarsest
+
+	const Level& lev = m_levels[l];
+	const Level& next = m_levels[l+1];
+
+	int_t n = lev.A.ncols();
+	int_t nc = next.A.ncols();
+
+	smooth(lev, m_preSweeps, false, b, x);
+
+	//
+	// Coarse grid correction
+	//
+
+	blk::csc::amg_residual(n, lev.At.colptr(), lev.At.rowidx(), lev.At.values(), b, x, lev.r.data());
+
+	T_Vector R(n, lev.r.data(), false);
+	T_Vector X(n, x, false);
+	T_Vector Bc(nc, next.b.data(), false);
+	T_Vector Xc(nc, next.x.data(), false);
+
+	ops::mult(T_Scalar(1), op_t::C, lev.P, R, T_Scalar(0), Bc);
+
+	Xc = 0;
+
+	int_t ncycles = (m_cycle == amg::cycle_t::W && l + 2 < levels() ? 2 : 1);
+
+	for(int_t c = 0; c < ncycles; c++) {
+		cycle(l + 1, next.b.data(), next.x.data());
+	} // c
+
+	ops::mult(T_Scalar(1), op_t::N, lev.P, Xc, T_Scalar(1), X);
+
+	smooth(lev, m_postSweeps, true, b, x);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void AlgebraicMultigrid<T_Matrix>::apply(const T_Vector& r, T_Vector& z) const
+{
+	if(m_levels.empty()) {
+		throw err::InvalidOp(msg::EmptyObject());
+	}
+
+	if(r.size() != m_dim || z.size() != m_dim) {
+		throw err::NoConsistency(msg::InvalidDimensions());
+	}
+
+	const Level& fine = m_levels[0];
+
+	std::copy(r.values(), r.values() + m_dim, fine.b.data());
+	z = 0;
+
+	cycle(0, fine.b.data(), z.values());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+bool AlgebraicMultigrid<T_Matrix>::monitor(int_t iter, T_RScalar resNorm, T_RScalar rhsNorm)
+{
+	m_iterations = iter;
+	m_resNorm = resNorm;
+
+	if(this->history()) {
+		m_history.push_back(resNorm);
+	}
+
+	m_converged = this->isConverged(iter, resNorm, rhsNorm);
+
+	return m_converged;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void AlgebraicMultigrid<T_Matrix>::solve(const dns::XxMatrix<T_Scalar>& rhs, dns::XxMatrix<T_Scalar>& sol)
+{
+	if(!sol)
+		sol = dns::XxMatrix<T_Scalar>(rhs.nrows(), rhs.ncols());
+
+	similarity_check(
+    rhs.prop(), rhs.nrows(), rhs.ncols(),
+    sol.prop(), sol.nrows(), sol.ncols());
+
+	for(int_t j = 0; j < rhs.ncols(); j++) {
+		Guard<T_Vector> grdBj = rhs.rcolumn(j);
+		T_Vector Xj = sol.rcolumn(j);
+		solve(grdBj.get(), Xj);
+	} // j
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void AlgebraicMultigrid<T_Matrix>::solve(const T_Vector& rhs, T_Vector& sol)
+{
+	if(m_levels.empty()) {
+		throw err::InvalidOp("Solver is not set up, call decompose() first");
+	}
+
+	if(rhs.size() != m_dim) {
+		throw err::InvalidOp("Mismatching dimensions for linear solution stage");
+	}
+
+	if(!sol) {
+		sol = T_Vector(rhs.size());
+		sol = 0;
+	} else if(sol.size() != m_dim) {
+		throw err::InvalidOp("Mismatching dimensions for linear solution stage");
+	} else if(!this->initialGuess()) {
+		sol = 0;
+	}
+
+	m_iterations = 0;
+	m_converged = false;
+	m_resNorm = 0;
+	m_history.clear();
+
+	const Level& fine = m_levels[0];
+
+	T_Vector R(m_dim, fine.r.data(), false);
+
+	auto computeResidual = [&]() {
+		std::copy(rhs.values(), rhs.values() + m_dim, R.values());
+		ops::mult(T_Scalar(-1), op_t::N, fine.A, sol, T_Scalar(1), R);
+		return vnorm(m_dim, R.values());
+	};
+
+	T_RScalar bnorm = vnorm(m_dim, rhs.values());
+
+	if(monitor(0, computeResidual(), bnorm))
+		return;
+
+	for(int_t it = 1; it <= this->maxIterations(); it++) {
+
+		cycle(0, rhs.values(), sol.values());
+
+		if(monitor(it, computeResidual(), bnorm))
+			break;
+
+	} // it
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+int_t AlgebraicMultigrid<T_Matrix>::levels() const
+{
+	return static_cast<int_t>(m_levels.size());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+typename AlgebraicMultigrid<T_Matrix>::T_RScalar AlgebraicMultigrid<T_Matrix>::operatorComplexity() const
+{
+	if(m_levels.empty())
+		return 0;
+
+	T_RScalar nnz = 0;
+
+	for(const Level& lev : m_levels) {
+		nnz += static_cast<T_RScalar>(lev.A.nnz());
+	} // lev
+
+	return nnz / static_cast<T_RScalar>(m_levels[0].A.nnz());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+int_t AlgebraicMultigrid<T_Matrix>::iterations() const
+{
+	return m_iterations;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+bool AlgebraicMultigrid<T_Matrix>::converged() const
+{
+	return m_converged;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+typename AlgebraicMultigrid<T_Matrix>::T_RScalar AlgebraicMultigrid<T_Matrix>::residualNorm() const
+{
+	return m_resNorm;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+const std::vector<typename AlgebraicMultigrid<T_Matrix>::T_RScalar>& AlgebraicMultigrid<T_Matrix>::residualHistory() const
+{
+	return m_history;
+}
+/*-------------------------------------------------*/
+template class AlgebraicMultigrid<csc::RdMatrix>;
+template class AlgebraicMultigrid<csc::RfMatrix>;
+template class AlgebraicMultigrid<csc::CdMatrix>;
+template class AlgebraicMultigrid<csc::CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
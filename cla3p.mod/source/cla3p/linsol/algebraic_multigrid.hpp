@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_ALGEBRAIC_MULTIGRID_HPP_
+#define CLA3P_ALGEBRAIC_MULTIGRID_HPP_
+
+/**
+ * @file
+ */
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <type_traits>
+
+#include "cla3p/types.hpp"
+#include "cla3p/linsol/krylov_options.hpp"
+#include "cla3p/linsol/lapack_auto.hpp"
+#include "cla3p/algebra/functional_multmm.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+/*-------------------------------------------------*/
+
+namespace dns { template <typename T_Scalar> class XxVector; }
+namespace dns { template <typename T_Scalar> class XxMatrix; }
+namespace dns { template <typename T_Scalar> class CxMatrix; }
+
+template <typename T_Matrix> class PardisoAuto;
+
+/*-------------------------------------------------*/
+namespace amg {
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup cla3p_module_index_special_enums
+ * @enum smoother_t
+ * @brief The multigrid smoother.
+ */
+enum class smoother_t {
+	Jacobi      = 0, /**< Damped Jacobi */
+	GaussSeidel    , /**< Hybrid Gauss-Seidel, forward for pre and backward for post smoothing */
+	Chebyshev        /**< Chebyshev polynomial, sweeps define the polynomial degree */
+};
+
+/**
+ * @ingroup cla3p_module_index_special_enums
+ * @enum cycle_t
+ * @brief The multigrid cycle.
+ */
+enum class cycle_t {
+	V = 0, /**< One coarse grid correction per level */
+	W      /**< Two coarse grid corrections per level */
+};
+
+/**
+ * @ingroup cla3p_module_index_special_enums
+ * @enum coarse_t
+ * @brief The multigrid coarsest level solver.
+ */
+enum class coarse_t {
+	Lapack  = 0, /**< Dense factorization */
+	Pardiso      /**< Sparse factorization */
+};
+
+/*-------------------------------------------------*/
+} // namespace amg
+/*-------------------------------------------------*/
+
+/**
+ * @nosubgrouping
+ * @brief The smoothed aggregation algebraic multigrid solver for sparse matrices.
+ *
+ * Builds a hierarchy of coarse operators <b>A<sub>l+1</sub> = P<sub>l</sub><sup>H</sup> * A<sub>l</sub> * P<sub>l</sub></b>,
+ * where the prolongators P<sub>l</sub> are Jacobi smoothed piecewise constant interpolations over aggregates of strongly connected unknowns. @n
+ * The hierarchy is used standalone, as a stationary iteration with solve(), or as a preconditioner (one cycle per application). @n
+ * Aggregates and the patterns of all hierarchy operators are kept after setup, so matrices with the same pattern and
+ * different values are processed with a numeric setup only.
+ */
+template <typename T_Matrix>
+class AlgebraicMultigrid : 
+	public krylov::Preconditioner<typename T_Matrix::value_type>, 
+	public krylov::Params<typename T_Matrix::value_type> {
+
+	private:
+		using T_Scalar = typename T_Matrix::value_type;
+		using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+		using T_Vector = dns::XxVector<T_Scalar>;
+		using T_DnsMatrix = typename std::conditional<TypeTraits<T_Scalar>::is_real(), 
+					dns::XxMatrix<T_Scalar>, dns::CxMatrix<T_Scalar>>::type;
+
+	public:
+
+		// no copy
+		AlgebraicMultigrid(const AlgebraicMultigrid&) = delete;
+		AlgebraicMultigrid& operator=(const AlgebraicMultigrid&) = delete;
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty solver object.
+		 */
+		AlgebraicMultigrid();
+
+		/**
+		 * @brief Destroys the solver.
+		 *
+		 * Clears all internal data and destroys the solver.
+		 */
+		~AlgebraicMultigrid();
+
+		std::string name() const;
+
+		/**
+		 * @brief Clears the solver internal data.
+		 *
+		 * Clears the hierarchy and resets all settings.
+		 */
+		void clear();
+
+		/**
+		 * @brief Strength of connection threshold.
+		 * @param[in] theta Unknowns i,j are strongly connected if |a<sub>ij</sub>| >= theta * sqrt(|a<sub>ii</sub> * a<sub>jj</sub>|) (default 0.08).
+		 */
+		void setStrengthThreshold(T_RScalar theta);
+
+		/**
+		 * @brief Maximum number of levels.
+		 * @param[in] nlev The maximum hierarchy depth, including the finest level (default 10).
+		 */
+		void setMaxLevels(int_t nlev);
+
+		/**
+		 * @brief Coarsest level size.
+		 * @param[in] n Levels up to this size are not coarsened further (default 300).
+		 */
+		void setCoarseSize(int_t n);
+
+		/**
+		 * @brief The smoother.
+		 * @param[in] smoother The smoother type (default amg::smoother_t::GaussSeidel).
+		 */
+		void setSmoother(amg::smoother_t smoother);
+
+		/**
+		 * @brief Smoothing sweeps.
+		 * @param[in] pre The number of pre smoothing sweeps (default 1).
+		 * @param[in] post The number of post smoothing sweeps (default 1).
+		 */
+		void setSweeps(int_t pre, int_t post);
+
+		/**
+		 * @brief The cycle.
+		 * @param[in] cycle The cycle type (default amg::cycle_t::V).
+		 */
+		void setCycle(amg::cycle_t cycle);
+
+		/**
+		 * @brief The coarsest level solver.
+		 * @param[in] coarse The solver type (default amg::coarse_t::Lapack).
+		 *
+		 * If coarsening stops above the coarse size (level cap reached or aggregation stalled)
+		 * and the coarsest level is too large for a dense factorization, 
+		 * the sparse solver is used instead of amg::coarse_t::Lapack (Intel MKL builds).
+		 */
+		void setCoarseSolver(amg::coarse_t coarse);
+
+		/**
+		 * @brief Builds the hierarchy.
+		 * @param[in] mat The system matrix, non general matrices are expanded to general form.
+		 *
+		 * Computes the aggregates, the patterns and the values of all hierarchy operators.
+		 */
+		void analysis(const T_Matrix& mat);
+
+		/**
+		 * @brief Sets up the hierarchy for a matrix.
+		 * @param[in] mat The system matrix.
+		 *
+		 * The hierarchy is built automatically on the first call. @n
+		 * Subsequent calls expect a matrix with the analyzed pattern and only update the operator values, 
+		 * err::NoConsistency is thrown otherwise.
+		 */
+		void decompose(const T_Matrix& mat);
+
+		/**
+		 * @brief Applies one cycle as a preconditioner.
+		 * @details Performs the operation <b>z := inv(M) * r</b>, starting from a zero initial guess.
+		 * @param[in] r The input vector.
+		 * @param[out] z The preconditioned vector, of the same size as r.
+		 */
+		void apply(const T_Vector& r, T_Vector& z) const override;
+
+		/**
+		 * @brief Performs matrix solution with repeated cycles.
+		 * @param[in] rhs The right hand side matrix.
+		 * @param[in,out] sol The matrix containing the solution (and the initial guess if enabled).
+		 *
+		 * Columns are solved one after the other, convergence information refers to the last column.
+		 */
+		void solve(const dns::XxMatrix<T_Scalar>& rhs, dns::XxMatrix<T_Scalar>& sol);
+
+		/**
+		 * @brief Performs vector solution with repeated cycles.
+		 * @param[in] rhs The right hand side vector.
+		 * @param[in,out] sol The vector containing the solution (and the initial guess if enabled).
+		 */
+		void solve(const T_Vector& rhs, T_Vector& sol);
+
+		/**
+		 * @brief Hierarchy depth.
+		 * @return The number of levels, including the finest level.
+		 */
+		int_t levels() const;
+
+		/**
+		 * @brief Operator complexity.
+		 * @return The total number of non zeros of all level operators relative to the finest level.
+		 */
+		T_RScalar operatorComplexity() const;
+
+		/**
+		 * @brief Cycles performed.
+		 * @return The number of cycles performed in the last solution.
+		 */
+		int_t iterations() const;
+
+		/**
+		 * @brief Convergence flag.
+		 * @return Whether the stopping criterion was met in the last solution.
+		 */
+		bool converged() const;
+
+		/**
+		 * @brief Final residual norm.
+		 * @return The residual norm after the last cycle.
+		 */
+		T_RScalar residualNorm() const;
+
+		/**
+		 * @brief Convergence history.
+		 * @return The residual norm per cycle, starting with the initial residual (if recording is enabled).
+		 */
+		const std::vector<T_RScalar>& residualHistory() const;
+
+	private:
+		struct Level {
+			T_Matrix A;  // level operator (general)
+			T_Matrix At; // transpose of A, row access for the smoothers
+			T_Matrix S;  // Jacobi smoothing operator
+			T_Matrix P0; // tentative prolongator
+			T_Matrix P;  // smoothed prolongator
+			T_Matrix AP; // A * P
+			ops::SparseProductPlan planP;  // S * P0
+			ops::SparseProductPlan planAP; // A * P
+			ops::SparseProductPlan planAc; // P^H * AP
+			std::vector<T_Scalar> diag;
+			std::vector<int_t> bounds;
+			T_RScalar rho;
+			mutable std::vector<T_Scalar> b;
+			mutable std::vector<T_Scalar> x;
+			mutable std::vector<T_Scalar> r;
+			mutable std::vector<T_Scalar> work;
+		};
+
+		T_RScalar m_theta;
+		int_t m_maxLevels;
+		int_t m_coarseSize;
+		amg::smoother_t m_smoother;
+		int_t m_preSweeps;
+		int_t m_postSweeps;
+		amg::cycle_t m_cycle;
+		amg::coarse_t m_coarse;
+
+		int_t m_dim;
+		int_t m_nnz;
+		unsigned long long m_fingerprint;
+		std::vector<Level> m_levels;
+		LapackAuto<T_DnsMatrix> m_lapack;
+		std::unique_ptr<PardisoAuto<T_Matrix>> m_pardiso;
+
+		int_t m_iterations;
+		bool m_converged;
+		T_RScalar m_resNorm;
+		std::vector<T_RScalar> m_history;
+
+		void defaults();
+		void clearHierarchy();
+		void copyFinestValues(const T_Matrix& mat);
+		bool coarsen(int_t l);
+		void numericLevel(int_t l);
+		void numericCoarsest();
+		void smooth(const Level& lev, int_t nsweeps, bool post, const T_Scalar *b, T_Scalar *x) const;
+		void coarseSolve(const T_Scalar *b, T_Scalar *x) const;
+		void cycle(int_t l, const T_Scalar *b, T_Scalar *x) const;
+		bool monitor(int_t iter, T_RScalar resNorm, T_RScalar rhsNorm);
+};
+
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_ALGEBRAIC_MULTIGRID_HPP_
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/linsol/incomplete_cholesky.hpp"
+
+// system
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+#include "cla3p/bulk/csc.hpp"
+#include "cla3p/bulk/csc_math.hpp"
+#include "cla3p/bulk/csc_ilu.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/checks/decomp_xx_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+static unsigned long long pattern_fingerprint(const T_Matrix& mat)
+{
+	return blk::csc::pattern_hash(mat.prop().type(), mat.prop().uplo(), mat.nrows(), mat.ncols(), mat.colptr(), mat.rowidx());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+IncompleteCholesky<T_Matrix>::IncompleteCholesky()
+{
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+IncompleteCholesky<T_Matrix>::~IncompleteCholesky()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+std::string IncompleteCholesky<T_Matrix>::name() const
+{
+	return "Incomplete Cholesky (IC(0))";
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void IncompleteCholesky<T_Matrix>::defaults()
+{
+	m_dim = 0;
+	m_nnz = 0;
+	m_fingerprint = 0;
+	m_decomposed = false;
+	m_nlevels = 0;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void IncompleteCholesky<T_Matrix>::clear()
+{
+	m_levptr.clear();
+	m_order.clear();
+
+	m_upper.clear();
+	m_adjointSchedule.clear();
+	m_upperSchedule.clear();
+
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void IncompleteCholesky<T_Matrix>::analysis(const T_Matrix& mat)
+{
+	decomp_generic_check(mat);
+
+	bool hermitian = (mat.prop().isHermitian() || (TypeTraits<T_Scalar>::is_real() && mat.prop().isSymmetric()));
+
+	if(!hermitian) {
+		throw err::InvalidOp(mat.prop().name() + " not supported for " + name());
+	}
+
+	clear();
+
+	int_t n = mat.ncols();
+	int_t nz = mat.nnz();
+
+	//
+	// Pattern of the upper part of A plus the diagonal
+	//
+
+	std::vector<int_t> colptrT;
+	std::vector<int_t> rowidxT;
+
+	const int_t *colptrA = mat.colptr();
+	const int_t *rowidxA = mat.rowidx();
+
+	if(mat.prop().isLower()) {
+		colptrT.resize(n + 1);
+		rowidxT.resize(nz);
+		blk::csc::transpose(n, n, mat.colptr(), mat.rowidx(), colptrT.data(), rowidxT.data());
+		colptrA = colptrT.data();
+		rowidxA = rowidxT.data();
+	} // lower
+
+	std::vector<int_t> colptrI(n + 1);
+	std::vector<int_t> rowidxI(n);
+
+	for(int_t j = 0; j < n; j++) {
+		colptrI[j] = j;
+		rowidxI[j] = j;
+	} // j
+	colptrI[n] = n;
+
+	int_t *colptrU = nullptr;
+	int_t *rowidxU = nullptr;
+
+	blk::csc::add_symbolic(n, colptrA, rowidxA, colptrI.data(), rowidxI.data(), &colptrU, &rowidxU);
+
+	T_Scalar *valuesU = i_malloc<T_Scalar>(colptrU[n]);
+
+	m_upper = T_Matrix(n, n, colptrU, rowidxU, valuesU, true, Property::TriangularUpper());
+
+	//
+	// Column j depends on the columns k with U(k,j) != 0, same as the rows of U^T
+	//
+
+	std::vector<int_t> rowptr(n + 1);
+	std::vector<int_t> colidx(colptrU[n]);
+	std::vector<int_t> valpos(colptrU[n]);
+	std::vector<int_t> diagpos(n);
+
+	m_levptr.resize(n + 1);
+	m_order.resize(n);
+
+	m_nlevels = blk::csc::tri_levels(uplo_t::Upper, op_t::T, n, colptrU, rowidxU,
+			rowptr.data(), colidx.data(), valpos.data(), diagpos.data(), m_levptr.data(), m_order.data());
+
+	m_adjointSchedule.analysis(op_t::C, m_upper);
+	m_upperSchedule.analysis(op_t::N, m_upper);
+
+	m_dim = n;
+	m_nnz = nz;
+	m_fingerprint = pattern_fingerprint(mat);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void IncompleteCholesky<T_Matrix>::decompose(const T_Matrix& mat)
+{
+	decomp_generic_check(mat);
+
+	if(m_levptr.empty()) {
+		analysis(mat);
+	} else if(mat.ncols() != m_dim || mat.nnz() != m_nnz || pattern_fingerprint(mat) != m_fingerprint) {
+		throw err::NoConsistency(msg::AnalysisMismatch());
+	} // analysis
+
+	m_decomposed = false;
+
+	int_t n = m_dim;
+
+	std::vector<int_t> colptrT;
+	std::vector<int_t> rowidxT;
+	std::vector<T_Scalar> valuesT;
+
+	const int_t *colptrA = mat.colptr();
+	const int_t *rowidxA = mat.rowidx();
+	const T_Scalar *valuesA = mat.values();
+
+	if(mat.prop().isLower()) {
+		colptrT.resize(n + 1);
+		rowidxT.resize(m_nnz);
+		valuesT.resize(m_nnz);
+		blk::csc::conjugate_transpose(n, n, mat.colptr(), mat.rowidx(), mat.values(), colptrT.data(), rowidxT.data(), valuesT.data());
+		colptrA = colptrT.data();
+		rowidxA = rowidxT.data();
+		valuesA = valuesT.data();
+	} // lower
+
+	blk::csc::ic_numeric(n, colptrA, rowidxA, valuesA,
+			m_upper.colptr(), m_upper.rowidx(), m_upper.values(),
+			m_nlevels, m_levptr.data(), m_order.data());
+
+	m_decomposed = true;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void IncompleteCholesky<T_Matrix>::apply(const T_Vector& r, T_Vector& z) const
+{
+	if(m_upperSchedule.empty()) {
+		throw err::InvalidOp(msg::EmptyObject());
+	}
+
+	if(!m_decomposed) {
+		throw err::InvalidOp(name() + ": Decomposition not performed");
+	}
+
+	if(r.size() != m_dim || z.size() != m_dim) {
+		throw err::NoConsistency(msg::InvalidDimensions());
+	}
+
+	if(z.values() != r.values()) {
+		std::copy(r.values(), r.values() + m_dim, z.values());
+	}
+
+	m_adjointSchedule.solve(m_upper, z);
+	m_upperSchedule.solve(m_upper, z);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+const T_Matrix& IncompleteCholesky<T_Matrix>::upper() const
+{
+	return m_upper;
+}
+/*-------------------------------------------------*/
+template class IncompleteCholesky<csc::RdMatrix>;
+template class IncompleteCholesky<csc::RfMatrix>;
+template class IncompleteCholesky<csc::CdMatrix>;
+template class IncompleteCholesky<csc::CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_INCOMPLETE_CHOLESKY_HPP_
+#define CLA3P_INCOMPLETE_CHOLESKY_HPP_
+
+/**
+ * @file
+ */
+
+#include <string>
+#include <vector>
+
+#include "cla3p/types.hpp"
+#include "cla3p/sparse/csc_level_schedule.hpp"
+#include "cla3p/linsol/krylov_options.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+/*-------------------------------------------------*/
+
+/**
+ * @nosubgrouping
+ * @brief The incomplete Cholesky preconditioner for symmetric (real) or hermitian sparse matrices.
+ *
+ * Computes the zero fill factor of <b>A ~ U<sup>H</sup> * U</b>, with U upper triangular. @n
+ * The pattern of the factor is computed once in the analysis phase and is reused for subsequent
+ * factorizations of matrices with the same pattern. @n
+ * Columns are factorized and the triangular solves of the preconditioner application are performed
+ * in parallel, in dependency levels.
+ */
+template <typename T_Matrix>
+class IncompleteCholesky : public krylov::Preconditioner<typename T_Matrix::value_type> {
+
+	private:
+		using T_Scalar = typename T_Matrix::value_type;
+		using T_Vector = dns::XxVector<T_Scalar>;
+
+	public:
+
+		// no copy
+		IncompleteCholesky(const IncompleteCholesky&) = delete;
+		IncompleteCholesky& operator=(const IncompleteCholesky&) = delete;
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty preconditioner object.
+		 */
+		IncompleteCholesky();
+
+		/**
+		 * @brief Destroys the preconditioner.
+		 *
+		 * Clears all internal data and destroys the preconditioner.
+		 */
+		~IncompleteCholesky();
+
+		std::string name() const;
+
+		/**
+		 * @brief Clears the preconditioner internal data.
+		 */
+		void clear();
+
+		/**
+		 * @brief Performs the symbolic factorization.
+		 * @param[in] mat The matrix to be analyzed, only its sparsity pattern is used.
+		 */
+		void analysis(const T_Matrix& mat);
+
+		/**
+		 * @brief Performs the numeric factorization.
+		 * @param[in] mat The matrix to be factorized.
+		 *
+		 * The analysis is performed automatically on the first call. @n
+		 * Subsequent calls expect a matrix with the analyzed pattern, err::NoConsistency is thrown otherwise.
+		 */
+		void decompose(const T_Matrix& mat);
+
+		/**
+		 * @brief Applies the preconditioner.
+		 * @details Performs the operation <b>z := inv(U) * inv(U<sup>H</sup>) * r</b>.
+		 * @param[in] r The input vector.
+		 * @param[out] z The preconditioned vector, of the same size as r.
+		 */
+		void apply(const T_Vector& r, T_Vector& z) const override;
+
+		/**
+		 * @brief The upper triangular factor.
+		 */
+		const T_Matrix& upper() const;
+
+	private:
+		int_t m_dim;
+		int_t m_nnz;
+		unsigned long long m_fingerprint;
+		bool m_decomposed;
+		int_t m_nlevels;
+		std::vector<int_t> m_levptr;
+		std::vector<int_t> m_order;
+
+		T_Matrix m_upper;
+		csc::LevelSchedule<int_t,T_Scalar> m_adjointSchedule;
+		csc::LevelSchedule<int_t,T_Scalar> m_upperSchedule;
+
+		void defaults();
+};
+
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_INCOMPLETE_CHOLESKY_HPP_
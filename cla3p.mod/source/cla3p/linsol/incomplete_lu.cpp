@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/linsol/incomplete_lu.hpp"
+
+// system
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+#include "cla3p/bulk/csc.hpp"
+#include "cla3p/bulk/csc_math.hpp"
+#include "cla3p/bulk/csc_ilu.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/checks/decomp_xx_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+static unsigned long long pattern_fingerprint(const T_Matrix& mat)
+{
+	return blk::csc::pattern_hash(mat.prop().type(), mat.prop().uplo(), mat.nrows(), mat.ncols(), mat.colptr(), mat.rowidx());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+IncompleteLU<T_Matrix>::IncompleteLU()
+{
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+IncompleteLU<T_Matrix>::~IncompleteLU()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+std::string IncompleteLU<T_Matrix>::name() const
+{
+	if(m_threshold) 
+		return "Incomplete LU (ILUT)";
+
+	return "Incomplete LU (ILU(" + std::to_string(m_level) + "))";
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void IncompleteLU<T_Matrix>::defaults()
+{
+	m_level = 0;
+	m_threshold = false;
+	m_dropTol = 0;
+	m_maxFill = -1;
+
+	m_dim = 0;
+	m_nnz = 0;
+	m_fingerprint = 0;
+	m_decomposed = false;
+	m_nlevels = 0;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void IncompleteLU<T_Matrix>::clearFactors()
+{
+	m_dim = 0;
+	m_nnz = 0;
+	m_fingerprint = 0;
+	m_decomposed = false;
+	m_nlevels = 0;
+	m_levptr.clear();
+	m_order.clear();
+
+	m_lower.clear();
+	m_upper.clear();
+	m_lowerSchedule.clear();
+	m_upperSchedule.clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void IncompleteLU<T_Matrix>::clear()
+{
+	clearFactors();
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void IncompleteLU<T_Matrix>::setFillLevel(int_t k)
+{
+	if(k < 0) {
+		throw err::InvalidOp("Fill level must be non negative");
+	}
+
+	clearFactors();
+
+	m_level = k;
+	m_threshold = false;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void IncompleteLU<T_Matrix>::setDropTolerance(T_RScalar tol, int_t maxFill)
+{
+	if(tol < 0) {
+		throw err::InvalidOp("Drop tolerance must be non negative");
+	}
+
+	clearFactors();
+
+	m_dropTol = tol;
+	m_maxFill = maxFill;
+	m_threshold = true;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void IncompleteLU<T_Matrix>::analysis(const T_Matrix& mat)
+{
+	decomp_generic_check(mat);
+
+	clearFactors();
+
+	m_dim = mat.ncols();
+	m_nnz = mat.nnz();
+	m_fingerprint = pattern_fingerprint(mat);
+
+	if(m_threshold)
+		return;
+
+	T_Matrix tmp;
+	if(!mat.prop().isGeneral()) tmp = mat.general();
+	const T_Matrix& A = (mat.prop().isGeneral() ? mat : tmp);
+
+	int_t n = m_dim;
+
+	int_t *colptrL = nullptr;
+	int_t *rowidxL = nullptr;
+	int_t *colptrU = nullptr;
+	int_t *rowidxU = nullptr;
+
+	blk::csc::ilu_symbolic(n, A.colptr(), A.rowidx(), m_level, &colptrL, &rowidxL, &colptrU, &rowidxU);
+
+	T_Scalar *valuesL = i_malloc<T_Scalar>(colptrL[n]);
+	T_Scalar *valuesU = i_malloc<T_Scalar>(colptrU[n]);
+
+	m_lower = T_Matrix(n, n, colptrL, rowidxL, valuesL, true, Property::TriangularLower());
+	m_upper = T_Matrix(n, n, colptrU, rowidxU, valuesU, true, Property::TriangularUpper());
+
+	factorLevels();
+	solveSchedules();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void IncompleteLU<T_Matrix>::factorLevels()
+{
+	//
+	// Column j depends on the columns k with U(k,j) != 0, same as the rows of U^T
+	//
+
+	int_t n = m_dim;
+	int_t nz = m_upper.nnz();
+
+	std::vector<int_t> rowptr(n + 1);
+	std::vector<int_t> colidx(nz);
+	std::vector<int_t> valpos(nz);
+	std::vector<int_t> diagpos(n);
+
+	m_levptr.resize(n + 1);
+	m_order.resize(n);
+
+	m_nlevels = blk::csc::tri_levels(uplo_t::Upper, op_t::T, n, m_upper.colptr(), m_upper.rowidx(),
+			rowptr.data(), colidx.data(), valpos.data(), diagpos.data(), m_levptr.data(), m_order.data());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void IncompleteLU<T_Matrix>::solveSchedules()
+{
+	m_lowerSchedule.analysis(op_t::N, m_lower);
+	m_upperSchedule.analysis(op_t::N, m_upper);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void IncompleteLU<T_Matrix>::decompose(const T_Matrix& mat)
+{
+	decomp_generic_check(mat);
+
+	if(m_threshold || m_levptr.empty()) {
+		analysis(mat);
+	} else if(mat.ncols() != m_dim || mat.nnz() != m_nnz || pattern_fingerprint(mat) != m_fingerprint) {
+		throw err::NoConsistency(msg::AnalysisMismatch());
+	} // analysis
+
+	m_decomposed = false;
+
+	T_Matrix tmp;
+	if(!mat.prop().isGeneral()) tmp = mat.general();
+	const T_Matrix& A = (mat.prop().isGeneral() ? mat : tmp);
+
+	int_t n = m_dim;
+
+	if(m_threshold) {
+
+		int_t *colptrL = nullptr;
+		int_t *rowidxL = nullptr;
+		int_t *colptrU = nullptr;
+		int_t *rowidxU = nullptr;
+		T_Scalar *valuesL = nullptr;
+		T_Scalar *valuesU = nullptr;
+
+		blk::csc::ilut(n, A.colptr(), A.rowidx(), A.values(), m_dropTol, m_maxFill,
+				&colptrL, &rowidxL, &valuesL, &colptrU, &rowidxU, &valuesU);
+
+		m_lower = T_Matrix(n, n, colptrL, rowidxL, valuesL, true, Property::TriangularLower());
+		m_upper = T_Matrix(n, n, colptrU, rowidxU, valuesU, true, Property::TriangularUpper());
+
+		solveSchedules();
+
+	} else {
+
+		blk::csc::ilu_numeric(n, A.colptr(), A.rowidx(), A.values(),
+				m_lower.colptr(), m_lower.rowidx(), m_lower.values(),
+				m_upper.colptr(), m_upper.rowidx(), m_upper.values(),
+				m_nlevels, m_levptr.data(), m_order.data());
+
+	} // variant
+
+	m_decomposed = true;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void IncompleteLU<T_Matrix>::apply(const T_Vector& r, T_Vector& z) const
+{
+	if(m_lowerSchedule.empty()) {
+		throw err::InvalidOp(msg::EmptyObject());
+	}
+
+	if(!m_decomposed) {
+		throw err::InvalidOp(name() + ": Decomposition not performed");
+	}
+
+	if(r.size() != m_dim || z.size() != m_dim) {
+		throw err::NoConsistency(msg::InvalidDimensions());
+	}
+
+	if(z.values() != r.values()) {
+		std::copy(r.values(), r.values() + m_dim, z.values());
+	}
+
+	m_lowerSchedule.solve(m_lower, z);
+	m_upperSchedule.solve(m_upper, z);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+const T_Matrix& IncompleteLU<T_Matrix>::lower() const
+{
+	return m_lower;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+const T_Matrix& IncompleteLU<T_Matrix>::upper() const
+{
+	return m_upper;
+}
+/*-------------------------------------------------*/
+template class IncompleteLU<csc::RdMatrix>;
+template class IncompleteLU<csc::RfMatrix>;
+template class IncompleteLU<csc::CdMatrix>;
+template class IncompleteLU<csc::CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
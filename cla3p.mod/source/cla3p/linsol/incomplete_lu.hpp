@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_INCOMPLETE_LU_HPP_
+#define CLA3P_INCOMPLETE_LU_HPP_
+
+/**
+ * @file
+ */
+
+#include <string>
+#include <vector>
+
+#include "cla3p/types.hpp"
+#include "cla3p/sparse/csc_level_schedule.hpp"
+#include "cla3p/linsol/krylov_options.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+/*-------------------------------------------------*/
+
+/**
+ * @nosubgrouping
+ * @brief The incomplete LU preconditioner for sparse matrices.
+ *
+ * Computes the factors of <b>A ~ L * U</b>, with L unit lower and U upper triangular. @n
+ * By default the level of fill variant ILU(k) is used (k = 0), the pattern of the factors is computed once
+ * in the analysis phase and is reused for subsequent factorizations of matrices with the same pattern. @n
+ * The threshold variant ILUT is enabled with setDropTolerance(), its pattern depends on the values
+ * and is recomputed in every factorization. @n
+ * Columns are factorized and the triangular solves of the preconditioner application are performed
+ * in parallel, in dependency levels.
+ */
+template <typename T_Matrix>
+class IncompleteLU : public krylov::Preconditioner<typename T_Matrix::value_type> {
+
+	private:
+		using T_Scalar = typename T_Matrix::value_type;
+		using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+		using T_Vector = dns::XxVector<T_Scalar>;
+
+	public:
+
+		// no copy
+		IncompleteLU(const IncompleteLU&) = delete;
+		IncompleteLU& operator=(const IncompleteLU&) = delete;
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty preconditioner object.
+		 */
+		IncompleteLU();
+
+		/**
+		 * @brief Destroys the preconditioner.
+		 *
+		 * Clears all internal data and destroys the preconditioner.
+		 */
+		~IncompleteLU();
+
+		std::string name() const;
+
+		/**
+		 * @brief Clears the preconditioner internal data.
+		 *
+		 * Clears the preconditioner internal data and resets all settings.
+		 */
+		void clear();
+
+		/**
+		 * @brief Level of fill.
+		 * @param[in] k The maximum fill level of the ILU(k) pattern (default 0), disables the threshold variant.
+		 */
+		void setFillLevel(int_t k);
+
+		/**
+		 * @brief Dropping parameters, enables the threshold variant ILUT.
+		 * @param[in] tol Entries smaller than tol times the norm of the corresponding column of A are dropped.
+		 * @param[in] maxFill The maximum number of off diagonal entries in each column of L and U (negative for no limit).
+		 */
+		void setDropTolerance(T_RScalar tol, int_t maxFill = -1);
+
+		/**
+		 * @brief Performs the symbolic factorization.
+		 * @param[in] mat The matrix to be analyzed.
+		 *
+		 * Only the sparsity pattern of mat is used, non general matrices are expanded to general form. @n
+		 * No action is taken for the threshold variant.
+		 */
+		void analysis(const T_Matrix& mat);
+
+		/**
+		 * @brief Performs the numeric factorization.
+		 * @param[in] mat The matrix to be factorized.
+		 *
+		 * The analysis is performed automatically on the first call. @n
+		 * Subsequent calls expect a matrix with the analyzed pattern, err::NoConsistency is thrown otherwise.
+		 */
+		void decompose(const T_Matrix& mat);
+
+		/**
+		 * @brief Applies the preconditioner.
+		 * @details Performs the operation <b>z := inv(U) * inv(L) * r</b>.
+		 * @param[in] r The input vector.
+		 * @param[out] z The preconditioned vector, of the same size as r.
+		 */
+		void apply(const T_Vector& r, T_Vector& z) const override;
+
+		/**
+		 * @brief The unit lower triangular factor.
+		 */
+		const T_Matrix& lower() const;
+
+		/**
+		 * @brief The upper triangular factor.
+		 */
+		const T_Matrix& upper() const;
+
+	private:
+		int_t m_level;
+		bool m_threshold;
+		T_RScalar m_dropTol;
+		int_t m_maxFill;
+
+		int_t m_dim;
+		int_t m_nnz;
+		unsigned long long m_fingerprint;
+		bool m_decomposed;
+		int_t m_nlevels;
+		std::vector<int_t> m_levptr;
+		std::vector<int_t> m_order;
+
+		T_Matrix m_lower;
+		T_Matrix m_upper;
+		csc::LevelSchedule<int_t,T_Scalar> m_lowerSchedule;
+		csc::LevelSchedule<int_t,T_Scalar> m_upperSchedule;
+
+		void defaults();
+		void clearFactors();
+		void factorLevels();
+		void solveSchedules();
+};
+
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_INCOMPLETE_LU_HPP_
@@ -0,0 +1,794 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/linsol/krylov_base.hpp"
+
+// system
+#include <cmath>
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+#include "cla3p/algebra/functional_multmv.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+#include "cla3p/checks/basic_checks.hpp"
+#include "cla3p/checks/decomp_xx_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+/*-------------------------------------------------*/
+static inline int_t krylov_mt_min_dim()
+{
+	return 16384;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static T_Scalar vdot(int_t n, const T_Scalar *x, const T_Scalar *y)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	T_RScalar re = 0;
+	T_RScalar im = 0;
+
+#pragma omp parallel for reduction(+:re,im) if(n >= krylov_mt_min_dim())
+	for(int_t i = 0; i < n; i++) {
+		T_Scalar xy = arith::conj(x[i]) * y[i];
+		re += arith::getRe(xy);
+		im += arith::getIm(xy);
+	} // i
+
+	T_Scalar ret = re;
+	arith::setIm(ret, im);
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static typename TypeTraits<T_Scalar>::real_type vnorm(int_t n, const T_Scalar *x)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	T_RScalar ret = 0;
+
+#pragma omp parallel for reduction(+:ret) if(n >= krylov_mt_min_dim())
+	for(int_t i = 0; i < n; i++) {
+		ret += std::norm(x[i]);
+	} // i
+
+	return std::sqrt(ret);
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static void vscal(int_t n, T_Scalar a, T_Scalar *x)
+{
+#pragma omp parallel for if(n >= krylov_mt_min_dim())
+	for(int_t i = 0; i < n; i++) {
+		x[i] *= a;
+	} // i
+}
+/*-------------------------------------------------*/
+//
+// y := y + a * x
+//
+template <typename T_Scalar>
+static void vaxpy(int_t n, T_Scalar a, const T_Scalar *x, T_Scalar *y)
+{
+#pragma omp parallel for if(n >= krylov_mt_min_dim())
+	for(int_t i = 0; i < n; i++) {
+		y[i] += a * x[i];
+	} // i
+}
+/*-------------------------------------------------*/
+//
+// y := y + a * x, returns norm(y)
+//
+template <typename T_Scalar>
+static typename TypeTraits<T_Scalar>::real_type vaxpy_norm(int_t n, T_Scalar a, const T_Scalar *x, T_Scalar *y)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	T_RScalar ret = 0;
+
+#pragma omp parallel for reduction(+:ret) if(n >= krylov_mt_min_dim())
+	for(int_t i = 0; i < n; i++) {
+		y[i] += a * x[i];
+		ret += std::norm(y[i]);
+	} // i
+
+	return std::sqrt(ret);
+}
+/*-------------------------------------------------*/
+//
+// y := x + b * y
+//
+template <typename T_Scalar>
+static void vxpby(int_t n, const T_Scalar *x, T_Scalar b, T_Scalar *y)
+{
+#pragma omp parallel for if(n >= krylov_mt_min_dim())
+	for(int_t i = 0; i < n; i++) {
+		y[i] = x[i] + b * y[i];
+	} // i
+}
+/*-------------------------------------------------*/
+//
+// CG step: x := x + alpha * p, r := r - alpha * q, returns norm(r)
+//
+template <typename T_Scalar>
+static typename TypeTraits<T_Scalar>::real_type cg_update(int_t n, T_Scalar alpha, 
+		const T_Scalar *p, const T_Scalar *q, T_Scalar *x, T_Scalar *r)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	T_RScalar ret = 0;
+
+#pragma omp parallel for reduction(+:ret) if(n >= krylov_mt_min_dim())
+	for(int_t i = 0; i < n; i++) {
+		x[i] += alpha * p[i];
+		r[i] -= alpha * q[i];
+		ret += std::norm(r[i]);
+	} // i
+
+	return std::sqrt(ret);
+}
+/*-------------------------------------------------*/
+//
+// Lanczos step: vn := vn - a * v - b * vo
+//
+template <typename T_Scalar>
+static void lanczos_update(int_t n, T_Scalar a, T_Scalar b, const T_Scalar *v, const T_Scalar *vo, T_Scalar *vn)
+{
+#pragma omp parallel for if(n >= krylov_mt_min_dim())
+	for(int_t i = 0; i < n; i++) {
+		vn[i] -= a * v[i] + b * vo[i];
+	} // i
+}
+/*-------------------------------------------------*/
+//
+// MINRES step: wn := (z - a3 * wo - a2 * w) / a1, x := x + c * wn
+//
+template <typename T_Scalar>
+static void minres_update(int_t n, T_Scalar a1, T_Scalar a2, T_Scalar a3, T_Scalar c,
+		const T_Scalar *z, const T_Scalar *wo, const T_Scalar *w, T_Scalar *wn, T_Scalar *x)
+{
+	T_Scalar inva1 = T_Scalar(1) / a1;
+
+#pragma omp parallel for if(n >= krylov_mt_min_dim())
+	for(int_t i = 0; i < n; i++) {
+		wn[i] = (z[i] - a3 * wo[i] - a2 * w[i]) * inva1;
+		x[i] += c * wn[i];
+	} // i
+}
+/*-------------------------------------------------*/
+//
+// BiCGSTAB direction: p := r + beta * (p - omega * v)
+//
+template <typename T_Scalar>
+static void bicgstab_direction(int_t n, T_Scalar beta, T_Scalar omega, const T_Scalar *r, const T_Scalar *v, T_Scalar *p)
+{
+#pragma omp parallel for if(n >= krylov_mt_min_dim())
+	for(int_t i = 0; i < n; i++) {
+		p[i] = r[i] + beta * (p[i] - omega * v[i]);
+	} // i
+}
+/*-------------------------------------------------*/
+//
+// BiCGSTAB step: x := x + alpha * ph + omega * sh, r := r - omega * t, returns norm(r)
+//
+template <typename T_Scalar>
+static typename TypeTraits<T_Scalar>::real_type bicgstab_update(int_t n, T_Scalar alpha, T_Scalar omega, 
+		const T_Scalar *ph, const T_Scalar *sh, const T_Scalar *t, T_Scalar *x, T_Scalar *r)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	T_RScalar ret = 0;
+
+#pragma omp parallel for reduction(+:ret) if(n >= krylov_mt_min_dim())
+	for(int_t i = 0; i < n; i++) {
+		x[i] += alpha * ph[i] + omega * sh[i];
+		r[i] -= omega * t[i];
+		ret += std::norm(r[i]);
+	} // i
+
+	return std::sqrt(ret);
+}
+/*-------------------------------------------------*/
+//
+// Complex Givens rotation zeroing b in (a,b), c is real
+//
+template <typename T_Scalar>
+static void givens(T_Scalar a, T_Scalar b, T_Scalar& c, T_Scalar& s)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	T_RScalar absa = std::abs(a);
+
+	if(absa == 0) {
+		c = 0;
+		s = 1;
+	} else {
+		T_RScalar r = std::hypot(absa, std::abs(b));
+		c = absa / r;
+		s = (a / absa) * arith::conj(b) / r;
+	}
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static void rotate(T_Scalar c, T_Scalar s, T_Scalar& x, T_Scalar& y)
+{
+	T_Scalar tmp = c * x + s * y;
+	y = c * y - arith::conj(s) * x;
+	x = tmp;
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+KrylovBase<T_Matrix>::KrylovBase(krylov::method_t method)
+	: m_method(method)
+{
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+KrylovBase<T_Matrix>::~KrylovBase()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+std::string KrylovBase<T_Matrix>::name() const
+{
+	switch(m_method) {
+		case krylov::method_t::CG       : return "Krylov CG";
+		case krylov::method_t::MINRES   : return "Krylov MINRES";
+		case krylov::method_t::GMRES    : return "Krylov GMRES";
+		case krylov::method_t::BiCGSTAB : return "Krylov BiCGSTAB";
+	} // method
+
+	return "Krylov";
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void KrylovBase<T_Matrix>::defaults()
+{
+	m_matrix = nullptr;
+	m_prec = nullptr;
+	m_restart = 30;
+
+	m_iterations = 0;
+	m_converged = false;
+	m_resNorm = 0;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void KrylovBase<T_Matrix>::clear()
+{
+	krylov::Params<T_Scalar>::clear();
+
+	m_buffer.clear();
+	m_history.clear();
+
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void KrylovBase<T_Matrix>::setRestartLength(int_t m)
+{
+	if(m < 1) {
+		throw err::InvalidOp("Restart length must be positive");
+	}
+
+	m_restart = m;
+
+	if(m_matrix) {
+		m_buffer.resize(workspaceSize());
+	}
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void KrylovBase<T_Matrix>::setPreconditioner(const krylov::Preconditioner<T_Scalar> *prec)
+{
+	m_prec = prec;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+int_t KrylovBase<T_Matrix>::dim() const
+{
+	return (m_matrix ? m_matrix->ncols() : 0);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+std::size_t KrylovBase<T_Matrix>::workspaceSize() const
+{
+	std::size_t n = dim();
+	std::size_t m = m_restart;
+
+	switch(m_method) {
+		case krylov::method_t::CG       : return 4 * n;
+		case krylov::method_t::MINRES   : return 8 * n;
+		case krylov::method_t::GMRES    : return (m + 3) * n + (m + 1) * m + (m + 1) + 2 * m;
+		case krylov::method_t::BiCGSTAB : return 7 * n;
+	} // method
+
+	return 0;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void KrylovBase<T_Matrix>::decompose(const T_Matrix& mat)
+{
+	decomp_generic_check(mat);
+
+	bool spd = (m_method == krylov::method_t::CG || m_method == krylov::method_t::MINRES);
+	bool hermitian = (mat.prop().isHermitian() || (TypeTraits<T_Scalar>::is_real() && mat.prop().isSymmetric()));
+
+	if(spd && !hermitian) {
+		throw err::InvalidOp(mat.prop().name() + " not supported for " + name());
+	}
+
+	m_matrix = &mat;
+	m_buffer.resize(workspaceSize());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+int_t KrylovBase<T_Matrix>::iterations() const
+{
+	return m_iterations;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+bool KrylovBase<T_Matrix>::converged() const
+{
+	return m_converged;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+typename KrylovBase<T_Matrix>::T_RScalar KrylovBase<T_Matrix>::residualNorm() const
+{
+	return m_resNorm;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+const std::vector<typename KrylovBase<T_Matrix>::T_RScalar>& KrylovBase<T_Matrix>::residualHistory() const
+{
+	return m_history;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+bool KrylovBase<T_Matrix>::monitor(int_t iter, T_RScalar resNorm, T_RScalar rhsNorm)
+{
+	m_iterations = iter;
+	m_resNorm = resNorm;
+
+	if(this->history()) {
+		m_history.push_back(resNorm);
+	}
+
+	m_converged = this->isConverged(iter, resNorm, rhsNorm);
+
+	return m_converged;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void KrylovBase<T_Matrix>::applyOperator(T_Scalar *x, T_Scalar *y) const
+{
+	T_Vector X(dim(), x, false);
+	T_Vector Y(dim(), y, false);
+	ops::mult(T_Scalar(1), op_t::N, *m_matrix, X, T_Scalar(0), Y);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void KrylovBase<T_Matrix>::applyPreconditioner(const T_Scalar *r, T_Scalar *z) const
+{
+	if(m_prec) {
+		T_Vector R(dim(), const_cast<T_Scalar*>(r), false);
+		T_Vector Z(dim(), z, false);
+		m_prec->apply(R, Z);
+	} else {
+		std::copy(r, r + dim(), z);
+	}
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+typename KrylovBase<T_Matrix>::T_RScalar 
+KrylovBase<T_Matrix>::computeResidual(const T_Scalar *b, T_Scalar *x, T_Scalar *r, bool nonzeroX) const
+{
+	std::copy(b, b + dim(), r);
+
+	if(nonzeroX) {
+		T_Vector X(dim(), x, false);
+		T_Vector R(dim(), r, false);
+		ops::mult(T_Scalar(-1), op_t::N, *m_matrix, X, T_Scalar(1), R);
+	}
+
+	return vnorm(dim(), r);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void KrylovBase<T_Matrix>::solve(const dns::XxMatrix<T_Scalar>& rhs, dns::XxMatrix<T_Scalar>& sol)
+{
+	if(!sol)
+		sol = dns::XxMatrix<T_Scalar>(rhs.nrows(), rhs.ncols());
+
+	similarity_check(
+    rhs.prop(), rhs.nrows(), rhs.ncols(),
+    sol.prop(), sol.nrows(), sol.ncols());
+
+	for(int_t j = 0; j < rhs.ncols(); j++) {
+		Guard<T_Vector> grdBj = rhs.rcolumn(j);
+		T_Vector Xj = sol.rcolumn(j);
+		solve(grdBj.get(), Xj);
+	} // j
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void KrylovBase<T_Matrix>::solve(const T_Vector& rhs, T_Vector& sol)
+{
+	if(!m_matrix) {
+		throw err::InvalidOp("Solver is not set up, call decompose() first");
+	}
+
+	if(rhs.size() != dim()) {
+		throw err::InvalidOp("Mismatching dimensions for linear solution stage");
+	}
+
+	if(!sol) {
+		sol = T_Vector(rhs.size());
+		sol = 0;
+	} else if(sol.size() != dim()) {
+		throw err::InvalidOp("Mismatching dimensions for linear solution stage");
+	} else if(!this->initialGuess()) {
+		sol = 0;
+	}
+
+	m_iterations = 0;
+	m_converged = false;
+	m_resNorm = 0;
+	m_history.clear();
+
+	m_buffer.resize(workspaceSize());
+	m_buffer.rewind();
+
+	switch(m_method) {
+		case krylov::method_t::CG       : solveCG      (rhs.values(), sol.values()); break;
+		case krylov::method_t::MINRES   : solveMINRES  (rhs.values(), sol.values()); break;
+		case krylov::method_t::GMRES    : solveGMRES   (rhs.values(), sol.values()); break;
+		case krylov::method_t::BiCGSTAB : solveBiCGSTAB(rhs.values(), sol.values()); break;
+	} // method
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void KrylovBase<T_Matrix>::solveCG(const T_Scalar *b, T_Scalar *x)
+{
+	int_t n = dim();
+
+	T_Scalar *r = m_buffer.request(n);
+	T_Scalar *p = m_buffer.request(n);
+	T_Scalar *q = m_buffer.request(n);
+	T_Scalar *z = (m_prec ? m_buffer.request(n) : r);
+
+	T_RScalar bnorm = vnorm(n, b);
+	T_RScalar rnorm = computeResidual(b, x, r, this->initialGuess());
+
+	if(monitor(0, rnorm, bnorm))
+		return;
+
+	applyPreconditioner(r, z);
+	std::copy(z, z + n, p);
+
+	T_RScalar rho = (m_prec ? arith::getRe(vdot(n, r, z)) : rnorm * rnorm);
+
+	for(int_t it = 1; it <= this->maxIterations(); it++) {
+
+		applyOperator(p, q);
+
+		T_RScalar pq = arith::getRe(vdot(n, p, q));
+		if(pq == 0) break; // breakdown
+
+		T_RScalar alpha = rho / pq;
+		rnorm = cg_update(n, T_Scalar(alpha), p, q, x, r);
+
+		if(monitor(it, rnorm, bnorm)) 
+			break;
+
+		if(m_prec) 
+			applyPreconditioner(r, z);
+
+		T_RScalar rhoNew = (m_prec ? arith::getRe(vdot(n, r, z)) : rnorm * rnorm);
+		T_RScalar beta = rhoNew / rho;
+		rho = rhoNew;
+
+		vxpby(n, z, T_Scalar(beta), p);
+
+	} // it
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void KrylovBase<T_Matrix>::solveMINRES(const T_Scalar *b, T_Scalar *x)
+{
+	int_t n = dim();
+
+	T_Scalar *vo = m_buffer.request(n);
+	T_Scalar *v  = m_buffer.request(n);
+	T_Scalar *vn = m_buffer.request(n);
+	T_Scalar *z  = m_buffer.request(n);
+	T_Scalar *zn = m_buffer.request(n);
+	T_Scalar *wo = m_buffer.request(n);
+	T_Scalar *w  = m_buffer.request(n);
+	T_Scalar *wn = m_buffer.request(n);
+
+	std::fill(vo, vo + n, T_Scalar(0));
+	std::fill(wo, wo + n, T_Scalar(0));
+	std::fill(w , w  + n, T_Scalar(0));
+
+	//
+	// Preconditioned variant, the monitored norm is the inv(M)-norm of the residual
+	//
+	T_RScalar rnorm = computeResidual(b, x, v, this->initialGuess());
+	T_RScalar bnorm = (this->initialGuess() ? vnorm(n, b) : rnorm);
+
+	applyPreconditioner(v, z);
+	T_RScalar gamma = (m_prec ? std::sqrt(std::max(T_RScalar(0), arith::getRe(vdot(n, z, v)))) : rnorm);
+
+	if(m_prec) {
+		if(this->initialGuess()) {
+			applyPreconditioner(b, zn);
+			bnorm = std::sqrt(std::max(T_RScalar(0), arith::getRe(vdot(n, zn, b))));
+		} else {
+			bnorm = gamma;
+		}
+	}
+
+	if(monitor(0, gamma, bnorm) || gamma == 0)
+		return;
+
+	T_RScalar gammaOld = 1;
+	T_RScalar eta = gamma;
+	T_RScalar cOld = 1, c = 1;
+	T_RScalar sOld = 0, s = 0;
+
+	for(int_t it = 1; it <= this->maxIterations(); it++) {
+
+		vscal(n, T_Scalar(1 / gamma), z);
+
+		applyOperator(z, vn);
+		T_RScalar delta = arith::getRe(vdot(n, z, vn));
+
+		lanczos_update(n, T_Scalar(delta / gamma), T_Scalar(gamma / gammaOld), v, vo, vn);
+
+		applyPreconditioner(vn, zn);
+		T_RScalar gammaNew = std::sqrt(std::max(T_RScalar(0), arith::getRe(vdot(n, zn, vn))));
+
+		T_RScalar a0 = c * delta - cOld * s * gamma;
+		T_RScalar a1 = std::hypot(a0, gammaNew);
+		T_RScalar a2 = s * delta + cOld * c * gamma;
+		T_RScalar a3 = sOld * gamma;
+
+		if(a1 == 0) break; // breakdown
+
+		T_RScalar cNew = a0 / a1;
+		T_RScalar sNew = gammaNew / a1;
+
+		minres_update(n, T_Scalar(a1), T_Scalar(a2), T_Scalar(a3), T_Scalar(cNew * eta), z, wo, w, wn, x);
+
+		eta = -sNew * eta;
+
+		std::swap(vo, v); std::swap(v, vn);
+		std::swap(wo, w); std::swap(w, wn);
+		std::swap(z, zn);
+
+		gammaOld = gamma; gamma = gammaNew;
+		cOld = c; c = cNew;
+		sOld = s; s = sNew;
+
+		if(monitor(it, std::abs(eta), bnorm) || gamma == 0) 
+			break;
+
+	} // it
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void KrylovBase<T_Matrix>::solveGMRES(const T_Scalar *b, T_Scalar *x)
+{
+	int_t n = dim();
+	int_t m = m_restart;
+	int_t ldh = m + 1;
+
+	T_Scalar *V  = m_buffer.request((m + 1) * n);
+	T_Scalar *z  = m_buffer.request(n);
+	T_Scalar *u  = m_buffer.request(n);
+	T_Scalar *H  = m_buffer.request((m + 1) * m);
+	T_Scalar *g  = m_buffer.request(m + 1);
+	T_Scalar *cs = m_buffer.request(m);
+	T_Scalar *sn = m_buffer.request(m);
+
+	T_RScalar bnorm = vnorm(n, b);
+
+	int_t it = 0;
+	bool done = false;
+
+	while(!done) {
+
+		//
+		// Right preconditioning keeps the monitored norm equal to the true residual norm
+		//
+		T_RScalar beta = computeResidual(b, x, V, this->initialGuess() || it > 0);
+
+		if(it == 0 && monitor(0, beta, bnorm)) break;
+		if(it >= this->maxIterations() || beta == 0) break;
+
+		vscal(n, T_Scalar(1 / beta), V);
+		std::fill(g, g + m + 1, T_Scalar(0));
+		g[0] = beta;
+
+		int_t kk = 0;
+
+		for(int_t k = 0; k < m && it < this->maxIterations(); k++) {
+
+			it++;
+
+			T_Scalar *vk = V + k * n;
+			T_Scalar *w = V + (k + 1) * n;
+			T_Scalar *hk = H + k * ldh;
+
+			if(m_prec) {
+				applyPreconditioner(vk, z);
+				applyOperator(z, w);
+			} else {
+				applyOperator(vk, w);
+			}
+
+			for(int_t i = 0; i <= k; i++) {
+				hk[i] = vdot(n, V + i * n, w);
+				vaxpy(n, -hk[i], V + i * n, w);
+			} // i
+
+			T_RScalar hnorm = vnorm(n, w);
+			hk[k+1] = hnorm;
+
+			if(hnorm != 0) {
+				vscal(n, T_Scalar(1 / hnorm), w);
+			}
+
+			for(int_t i = 0; i < k; i++) {
+				rotate(cs[i], sn[i], hk[i], hk[i+1]);
+			} // i
+
+			givens(hk[k], hk[k+1], cs[k], sn[k]);
+			rotate(cs[k], sn[k], hk[k], hk[k+1]);
+			rotate(cs[k], sn[k], g[k], g[k+1]);
+
+			kk = k + 1;
+
+			if(monitor(it, std::abs(g[k+1]), bnorm) || hnorm == 0) {
+				done = true;
+				break;
+			}
+
+		} // k
+
+		//
+		// Least squares update x := x + inv(M) * V * y, with H * y = g upper triangular
+		//
+		for(int_t i = kk - 1; i >= 0; i--) {
+			for(int_t l = i + 1; l < kk; l++) {
+				g[i] -= H[i + l * ldh] * g[l];
+			} // l
+			g[i] = (H[i + i * ldh] == T_Scalar(0) ? T_Scalar(0) : g[i] / H[i + i * ldh]);
+		} // i
+
+		std::fill(u, u + n, T_Scalar(0));
+		for(int_t i = 0; i < kk; i++) {
+			vaxpy(n, g[i], V + i * n, u);
+		} // i
+
+		if(m_prec) {
+			applyPreconditioner(u, z);
+			vaxpy(n, T_Scalar(1), z, x);
+		} else {
+			vaxpy(n, T_Scalar(1), u, x);
+		}
+
+		if(it >= this->maxIterations()) break;
+
+	} // restarts
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void KrylovBase<T_Matrix>::solveBiCGSTAB(const T_Scalar *b, T_Scalar *x)
+{
+	int_t n = dim();
+
+	T_Scalar *r  = m_buffer.request(n);
+	T_Scalar *rh = m_buffer.request(n);
+	T_Scalar *p  = m_buffer.request(n);
+	T_Scalar *v  = m_buffer.request(n);
+	T_Scalar *t  = m_buffer.request(n);
+	T_Scalar *ph = (m_prec ? m_buffer.request(n) : p);
+	T_Scalar *sh = (m_prec ? m_buffer.request(n) : r);
+
+	T_RScalar bnorm = vnorm(n, b);
+	T_RScalar rnorm = computeResidual(b, x, r, this->initialGuess());
+
+	if(monitor(0, rnorm, bnorm))
+		return;
+
+	std::copy(r, r + n, rh);
+
+	T_Scalar rho = 1;
+	T_Scalar alpha = 1;
+	T_Scalar omega = 1;
+
+	for(int_t it = 1; it <= this->maxIterations(); it++) {
+
+		T_Scalar rhoNew = vdot(n, rh, r);
+		if(rhoNew == T_Scalar(0)) break; // breakdown
+
+		if(it == 1) {
+			std::copy(r, r + n, p);
+		} else {
+			bicgstab_direction(n, (rhoNew / rho) * (alpha / omega), omega, r, v, p);
+		}
+
+		if(m_prec) 
+			applyPreconditioner(p, ph);
+
+		applyOperator(ph, v);
+
+		T_Scalar rv = vdot(n, rh, v);
+		if(rv == T_Scalar(0)) break; // breakdown
+
+		alpha = rhoNew / rv;
+		rho = rhoNew;
+
+		//
+		// Half step, r holds s := r - alpha * v
+		//
+		T_RScalar snorm = vaxpy_norm(n, -alpha, v, r);
+
+		if(this->isConverged(it, snorm, bnorm)) {
+			vaxpy(n, alpha, ph, x);
+			monitor(it, snorm, bnorm);
+			break;
+		}
+
+		if(m_prec)
+			applyPreconditioner(r, sh);
+
+		applyOperator(sh, t);
+
+		T_RScalar tt = vnorm(n, t);
+		omega = (tt == 0 ? T_Scalar(0) : vdot(n, t, r) / (tt * tt));
+
+		rnorm = bicgstab_update(n, alpha, omega, ph, sh, t, x, r);
+
+		if(monitor(it, rnorm, bnorm) || omega == T_Scalar(0)) 
+			break;
+
+	} // it
+}
+/*-------------------------------------------------*/
+template class KrylovBase<csc::RdMatrix>;
+template class KrylovBase<csc::RfMatrix>;
+template class KrylovBase<csc::CdMatrix>;
+template class KrylovBase<csc::CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
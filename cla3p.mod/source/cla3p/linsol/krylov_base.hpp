@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_KRYLOV_BASE_HPP_
+#define CLA3P_KRYLOV_BASE_HPP_
+
+/**
+ * @file
+ */
+
+#include <string>
+#include <vector>
+
+#include "cla3p/types.hpp"
+#include "cla3p/support/heap_buffer.hpp"
+#include "cla3p/linsol/krylov_options.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+/*-------------------------------------------------*/
+
+namespace dns { template <typename T_Scalar> class XxVector; }
+namespace dns { template <typename T_Scalar> class XxMatrix; }
+
+/**
+ * @nosubgrouping
+ * @brief The Krylov iterative linear solver base for sparse matrices.
+ *
+ * The system matrix is referenced, not copied or factorized, and must remain valid while the solver is in use. @n
+ * Workspace is allocated once per matrix dimension and reused across solutions.
+ */
+template <typename T_Matrix>
+class KrylovBase : public krylov::Params<typename T_Matrix::value_type> {
+
+	private:
+		using T_Scalar = typename T_Matrix::value_type;
+		using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+		using T_Vector = dns::XxVector<T_Scalar>;
+
+	protected:
+		KrylovBase(krylov::method_t method);
+		~KrylovBase();
+
+		void setRestartLength(int_t m);
+
+	public:
+		std::string name() const;
+
+		/**
+		 * @brief Clears the solver internal data.
+		 *
+		 * Clears the solver internal data and resets all settings.
+		 */
+		void clear();
+
+		/**
+		 * @brief Sets up the solver for a matrix.
+		 * @param[in] mat The system matrix, referenced by the solver.
+		 *
+		 * No factorization is performed, the matrix is bound to the solver and the workspace is sized. @n
+		 * CG and MINRES require a symmetric (real) or hermitian matrix.
+		 */
+		void decompose(const T_Matrix& mat);
+
+		/**
+		 * @brief Sets the preconditioner.
+		 * @param[in] prec The preconditioner, referenced by the solver (nullptr disables preconditioning).
+		 */
+		void setPreconditioner(const krylov::Preconditioner<T_Scalar> *prec);
+
+		/**
+		 * @brief Performs matrix solution.
+		 * @param[in] rhs The right hand side matrix.
+		 * @param[in,out] sol The matrix containing the solution (and the initial guess if enabled).
+		 *
+		 * Columns are solved one after the other, convergence information refers to the last column.
+		 */
+		void solve(const dns::XxMatrix<T_Scalar>& rhs, dns::XxMatrix<T_Scalar>& sol);
+
+		/**
+		 * @brief Performs vector solution.
+		 * @param[in] rhs The right hand side vector.
+		 * @param[in,out] sol The vector containing the solution (and the initial guess if enabled).
+		 */
+		void solve(const T_Vector& rhs, T_Vector& sol);
+
+		/**
+		 * @brief Iterations performed.
+		 * @return The number of iterations performed in the last solution.
+		 */
+		int_t iterations() const;
+
+		/**
+		 * @brief Convergence flag.
+		 * @return Whether the stopping criterion was met in the last solution.
+		 */
+		bool converged() const;
+
+		/**
+		 * @brief Final residual norm.
+		 * @return The residual norm monitored in the last iteration (preconditioned norm for MINRES).
+		 */
+		T_RScalar residualNorm() const;
+
+		/**
+		 * @brief Convergence history.
+		 * @return The monitored residual norm per iteration, starting with the initial residual (if recording is enabled).
+		 */
+		const std::vector<T_RScalar>& residualHistory() const;
+
+	private:
+		const krylov::method_t m_method;
+		const T_Matrix *m_matrix;
+		const krylov::Preconditioner<T_Scalar> *m_prec;
+		HeapBuffer<T_Scalar> m_buffer;
+		int_t m_restart;
+
+		int_t m_iterations;
+		bool m_converged;
+		T_RScalar m_resNorm;
+		std::vector<T_RScalar> m_history;
+
+		void defaults();
+		int_t dim() const;
+		std::size_t workspaceSize() const;
+
+		bool monitor(int_t iter, T_RScalar resNorm, T_RScalar rhsNorm);
+
+		void applyOperator(T_Scalar *x, T_Scalar *y) const;
+		void applyPreconditioner(const T_Scalar *r, T_Scalar *z) const;
+		T_RScalar computeResidual(const T_Scalar *b, T_Scalar *x, T_Scalar *r, bool nonzeroX) const;
+
+		void solveCG(const T_Scalar *b, T_Scalar *x);
+		void solveMINRES(const T_Scalar *b, T_Scalar *x);
+		void solveGMRES(const T_Scalar *b, T_Scalar *x);
+		void solveBiCGSTAB(const T_Scalar *b, T_Scalar *x);
+};
+
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_KRYLOV_BASE_HPP_
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_KRYLOV_BICGSTAB_HPP_
+#define CLA3P_KRYLOV_BICGSTAB_HPP_
+
+/**
+ * @file
+ */
+
+#include "cla3p/linsol/krylov_base.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+/*-------------------------------------------------*/
+
+/**
+ * @nosubgrouping
+ * @brief The right preconditioned stabilized bi-conjugate gradient solver for general sparse matrices.
+ */
+template <typename T_Matrix>
+class KrylovBiCGSTAB : public KrylovBase<T_Matrix> {
+
+	public:
+
+		// no copy
+		KrylovBiCGSTAB(const KrylovBiCGSTAB&) = delete;
+		KrylovBiCGSTAB& operator=(const KrylovBiCGSTAB&) = delete;
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty solver object.
+		 */
+		KrylovBiCGSTAB() : KrylovBase<T_Matrix>(krylov::method_t::BiCGSTAB) {}
+
+		/**
+		 * @brief Destroys the solver.
+		 *
+		 * Clears all internal data and destroys the solver.
+		 */
+		~KrylovBiCGSTAB() = default;
+
+};
+
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_KRYLOV_BICGSTAB_HPP_
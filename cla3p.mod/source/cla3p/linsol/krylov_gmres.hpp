@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_KRYLOV_GMRES_HPP_
+#define CLA3P_KRYLOV_GMRES_HPP_
+
+/**
+ * @file
+ */
+
+#include "cla3p/linsol/krylov_base.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+/*-------------------------------------------------*/
+
+/**
+ * @nosubgrouping
+ * @brief The restarted right preconditioned GMRES solver for general sparse matrices.
+ */
+template <typename T_Matrix>
+class KrylovGMRES : public KrylovBase<T_Matrix> {
+
+	public:
+
+		// no copy
+		KrylovGMRES(const KrylovGMRES&) = delete;
+		KrylovGMRES& operator=(const KrylovGMRES&) = delete;
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty solver object.
+		 */
+		KrylovGMRES() : KrylovBase<T_Matrix>(krylov::method_t::GMRES) {}
+
+		/**
+		 * @brief Destroys the solver.
+		 *
+		 * Clears all internal data and destroys the solver.
+		 */
+		~KrylovGMRES() = default;
+
+		/**
+		 * @brief Restart length.
+		 * @param[in] m The Krylov subspace dimension before restarting (default 30).
+		 */
+		void setRestart(int_t m) { KrylovBase<T_Matrix>::setRestartLength(m); }
+
+};
+
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_KRYLOV_GMRES_HPP_
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/linsol/krylov_options.hpp"
+
+// system
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+#include "cla3p/error/exceptions.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace krylov {
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+Params<T_Scalar>::Params()
+{
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+Params<T_Scalar>::~Params()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void Params<T_Scalar>::defaults()
+{
+	m_maxit = 1000;
+	m_rtol = std::sqrt(std::numeric_limits<T_RScalar>::epsilon());
+	m_atol = 0;
+	m_criterion = nullptr;
+	m_initialGuess = false;
+	m_history = false;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void Params<T_Scalar>::clear()
+{
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void Params<T_Scalar>::setMaxIterations(int_t maxit)
+{
+	if(maxit < 0) {
+		throw err::InvalidOp("Maximum number of iterations must be non negative");
+	}
+	m_maxit = maxit;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void Params<T_Scalar>::setRelativeTolerance(T_RScalar rtol)
+{
+	if(rtol < 0) {
+		throw err::InvalidOp("Tolerance must be non negative");
+	}
+	m_rtol = rtol;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void Params<T_Scalar>::setAbsoluteTolerance(T_RScalar atol)
+{
+	if(atol < 0) {
+		throw err::InvalidOp("Tolerance must be non negative");
+	}
+	m_atol = atol;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void Params<T_Scalar>::setStoppingCriterion(const criterion_type& crit)
+{
+	m_criterion = crit;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void Params<T_Scalar>::setInitialGuess(bool flg)
+{
+	m_initialGuess = flg;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void Params<T_Scalar>::setHistory(bool flg)
+{
+	m_history = flg;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+int_t Params<T_Scalar>::maxIterations() const
+{
+	return m_maxit;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+bool Params<T_Scalar>::initialGuess() const
+{
+	return m_initialGuess;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+bool Params<T_Scalar>::history() const
+{
+	return m_history;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+bool Params<T_Scalar>::isConverged(int_t iter, T_RScalar resNorm, T_RScalar rhsNorm) const
+{
+	if(m_criterion) 
+		return m_criterion(iter, resNorm, rhsNorm);
+
+	return (resNorm <= std::max(m_rtol * rhsNorm, m_atol));
+}
+/*-------------------------------------------------*/
+template class Params<real_t>;
+template class Params<real4_t>;
+template class Params<complex_t>;
+template class Params<complex8_t>;
+/*-------------------------------------------------*/
+} // namespace krylov
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_KRYLOV_OPTIONS_HPP_
+#define CLA3P_KRYLOV_OPTIONS_HPP_
+
+/**
+ * @file
+ */
+
+#include <functional>
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+/*-------------------------------------------------*/
+
+namespace dns { template <typename T_Scalar> class XxVector; }
+
+/*-------------------------------------------------*/
+namespace krylov {
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup cla3p_module_index_special_enums
+ * @enum method_t
+ * @brief The Krylov subspace method.
+ */
+enum class method_t {
+	CG       = 0, /**< Conjugate gradients (symmetric/hermitian positive definite) */
+	MINRES      , /**< Minimal residual (symmetric/hermitian indefinite) */
+	GMRES       , /**< Restarted generalized minimal residual (general) */
+	BiCGSTAB      /**< Stabilized bi-conjugate gradients (general) */
+};
+
+/*-------------------------------------------------*/
+
+/**
+ * @nosubgrouping
+ * @brief The abstract preconditioner interface for Krylov solvers.
+ *
+ * Derived classes implement the application of the inverse of the preconditioning matrix M. @n
+ * CG and MINRES require M to be symmetric/hermitian positive definite.
+ */
+template <typename T_Scalar>
+class Preconditioner {
+
+	public:
+		virtual ~Preconditioner() = default;
+
+		/**
+		 * @brief Applies the preconditioner.
+		 * @details Performs the operation <b>z := inv(M) * r</b>.
+		 * @param[in] r The input vector.
+		 * @param[out] z The preconditioned vector, of the same size as r.
+		 */
+		virtual void apply(const dns::XxVector<T_Scalar>& r, dns::XxVector<T_Scalar>& z) const = 0;
+};
+
+/*-------------------------------------------------*/
+
+/**
+ * @nosubgrouping
+ * @brief The Krylov solver parameters.
+ */
+template <typename T_Scalar>
+class Params {
+
+	private:
+		using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	public:
+
+		/**
+		 * @brief The stopping criterion type.
+		 * @details Called with the iteration count, the current residual norm and the right hand side norm. @n
+		 *          Returns true if the iteration should stop as converged.
+		 */
+		using criterion_type = std::function<bool(int_t, T_RScalar, T_RScalar)>;
+
+		/**
+		 * @brief Maximum number of iterations.
+		 * @param[in] maxit The iteration limit (default 1000).
+		 */
+		void setMaxIterations(int_t maxit);
+
+		/**
+		 * @brief Relative residual tolerance.
+		 * @param[in] rtol The tolerance relative to the right hand side norm (default: square root of the machine precision).
+		 */
+		void setRelativeTolerance(T_RScalar rtol);
+
+		/**
+		 * @brief Absolute residual tolerance.
+		 * @param[in] atol The absolute tolerance (default 0).
+		 *
+		 * The default criterion stops when the residual norm does not exceed max(rtol * |b|, atol).
+		 */
+		void setAbsoluteTolerance(T_RScalar atol);
+
+		/**
+		 * @brief Custom stopping criterion.
+		 * @param[in] crit The criterion replacing the default tolerance test, an empty function restores the default.
+		 */
+		void setStoppingCriterion(const criterion_type& crit);
+
+		/**
+		 * @brief Initial guess usage.
+		 * @param[in] flg If set, the solution vector contents on entry are used as the initial guess (default off).
+		 */
+		void setInitialGuess(bool flg);
+
+		/**
+		 * @brief Convergence history recording.
+		 * @param[in] flg Enables/disables recording of the residual norm per iteration (default off).
+		 */
+		void setHistory(bool flg);
+
+	protected:
+		Params();
+		~Params();
+
+		void clear();
+
+		int_t maxIterations() const;
+		bool initialGuess() const;
+		bool history() const;
+		bool isConverged(int_t iter, T_RScalar resNorm, T_RScalar rhsNorm) const;
+
+	private:
+		int_t m_maxit;
+		T_RScalar m_rtol;
+		T_RScalar m_atol;
+		criterion_type m_criterion;
+		bool m_initialGuess;
+		bool m_history;
+
+		void defaults();
+};
+
+/*-------------------------------------------------*/
+} // namespace krylov
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_KRYLOV_OPTIONS_HPP_
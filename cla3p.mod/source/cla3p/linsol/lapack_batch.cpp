@@ -0,0 +1,722 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+// this file inc
+#include "cla3p/linsol/lapack_batch.hpp"
+
+// system
+#include <cmath>
+#include <algorithm>
+#include <sstream>
+
+// 3rd
+
+// cla3p
+#include "cla3p/support/utils.hpp"
+#include "cla3p/proxies/lapack_proxy.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/checks/lapack_checks.hpp"
+
+#if defined(CLA3P_INTEL_MKL)
+#include "cla3p/proxies/mkl_proxy.hpp"
+#endif
+
+/*-------------------------------------------------*/
+namespace cla3p {
+/*-------------------------------------------------*/
+//
+// Matrices per vectorized kernel call, also the OpenMP work unit
+//
+constexpr int_t BATCH_LANES = 64;
+/*-------------------------------------------------*/
+static inline std::size_t ioff(int_t i, int_t j, int_t n, int_t bs)
+{
+	return (static_cast<std::size_t>(i) + static_cast<std::size_t>(j) * n) * bs;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static inline typename TypeTraits<T_Scalar>::real_type abs1(const T_Scalar& x)
+{
+	return std::abs(arith::getRe(x)) + std::abs(arith::getIm(x));
+}
+/*-------------------------------------------------*/
+//
+// Interleaved kernels
+// Entry (i,j) of lane l is a[ioff(i,j,n,bs) + l], for lanes 0 <= l < nl
+//
+template <typename T_Scalar>
+static void getrf_interleaved(int_t n, int_t bs, int_t nl, T_Scalar *a, int_t *ipiv, int_t *info)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	int_t piv[BATCH_LANES];
+	T_RScalar amax[BATCH_LANES];
+	T_Scalar inv[BATCH_LANES];
+
+	for(int_t k = 0; k < n; k++) {
+
+		T_Scalar *akk = a + ioff(k, k, n, bs);
+
+#pragma omp simd
+		for(int_t l = 0; l < nl; l++) {
+			piv[l] = k;
+			amax[l] = abs1(akk[l]);
+		} // l
+
+		for(int_t i = k + 1; i < n; i++) {
+			const T_Scalar *aik = a + ioff(i, k, n, bs);
+#pragma omp simd
+			for(int_t l = 0; l < nl; l++) {
+				T_RScalar v = abs1(aik[l]);
+				bool gt = (v > amax[l]);
+				amax[l] = (gt ? v : amax[l]);
+				piv[l] = (gt ? i : piv[l]);
+			} // l
+		} // i
+
+		int_t *ipk = ipiv + static_cast<std::size_t>(k) * bs;
+		for(int_t l = 0; l < nl; l++) {
+			ipk[l] = piv[l];
+		} // l
+
+		for(int_t j = 0; j < n; j++) {
+			T_Scalar *akj = a + ioff(k, j, n, bs);
+#pragma omp simd
+			for(int_t l = 0; l < nl; l++) {
+				std::size_t d = static_cast<std::size_t>(piv[l] - k) * bs;
+				T_Scalar tmp = akj[l];
+				akj[l] = akj[l + d];
+				akj[l + d] = tmp;
+			} // l
+		} // j
+
+#pragma omp simd
+		for(int_t l = 0; l < nl; l++) {
+			bool zero = (akk[l] == T_Scalar(0));
+			info[l] = ((zero && !info[l]) ? k + 1 : info[l]);
+			inv[l] = (zero ? T_Scalar(0) : T_Scalar(1) / akk[l]);
+		} // l
+
+		for(int_t i = k + 1; i < n; i++) {
+			T_Scalar *aik = a + ioff(i, k, n, bs);
+#pragma omp simd
+			for(int_t l = 0; l < nl; l++) {
+				aik[l] *= inv[l];
+			} // l
+		} // i
+
+		for(int_t j = k + 1; j < n; j++) {
+			const T_Scalar *akj = a + ioff(k, j, n, bs);
+			for(int_t i = k + 1; i < n; i++) {
+				const T_Scalar *aik = a + ioff(i, k, n, bs);
+				T_Scalar *aij = a + ioff(i, j, n, bs);
+#pragma omp simd
+				for(int_t l = 0; l < nl; l++) {
+					aij[l] -= aik[l] * akj[l];
+				} // l
+			} // i
+		} // j
+
+	} // k
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static void potrf_interleaved(int_t n, int_t bs, int_t nl, T_Scalar *a, int_t *info)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	T_RScalar inv[BATCH_LANES];
+
+	for(int_t k = 0; k < n; k++) {
+
+		T_Scalar *akk = a + ioff(k, k, n, bs);
+
+#pragma omp simd
+		for(int_t l = 0; l < nl; l++) {
+			T_RScalar d = arith::getRe(akk[l]);
+			bool bad = !(d > 0);
+			info[l] = ((bad && !info[l]) ? k + 1 : info[l]);
+			T_RScalar s = (bad ? T_RScalar(1) : std::sqrt(d));
+			akk[l] = s;
+			inv[l] = T_RScalar(1) / s;
+		} // l
+
+		for(int_t i = k + 1; i < n; i++) {
+			T_Scalar *aik = a + ioff(i, k, n, bs);
+#pragma omp simd
+			for(int_t l = 0; l < nl; l++) {
+				aik[l] *= inv[l];
+			} // l
+		} // i
+
+		for(int_t j = k + 1; j < n; j++) {
+			const T_Scalar *ajk = a + ioff(j, k, n, bs);
+			for(int_t i = j; i < n; i++) {
+				const T_Scalar *aik = a + ioff(i, k, n, bs);
+				T_Scalar *aij = a + ioff(i, j, n, bs);
+#pragma omp simd
+				for(int_t l = 0; l < nl; l++) {
+					aij[l] -= aik[l] * arith::conj(ajk[l]);
+				} // l
+			} // i
+		} // j
+
+	} // k
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static void ldltnp_interleaved(bool herm, int_t n, int_t bs, int_t nl, T_Scalar *a, int_t *info)
+{
+	T_Scalar inv[BATCH_LANES];
+	T_Scalar c[BATCH_LANES];
+
+	for(int_t k = 0; k < n; k++) {
+
+		T_Scalar *akk = a + ioff(k, k, n, bs);
+
+#pragma omp simd
+		for(int_t l = 0; l < nl; l++) {
+			T_Scalar d = (herm ? T_Scalar(arith::getRe(akk[l])) : akk[l]);
+			bool zero = (d == T_Scalar(0));
+			info[l] = ((zero && !info[l]) ? k + 1 : info[l]);
+			akk[l] = d;
+			inv[l] = (zero ? T_Scalar(0) : T_Scalar(1) / d);
+		} // l
+
+		for(int_t j = k + 1; j < n; j++) {
+
+			const T_Scalar *ajk = a + ioff(j, k, n, bs);
+#pragma omp simd
+			for(int_t l = 0; l < nl; l++) {
+				c[l] = inv[l] * (herm ? arith::conj(ajk[l]) : ajk[l]);
+			} // l
+
+			for(int_t i = j; i < n; i++) {
+				const T_Scalar *aik = a + ioff(i, k, n, bs);
+				T_Scalar *aij = a + ioff(i, j, n, bs);
+#pragma omp simd
+				for(int_t l = 0; l < nl; l++) {
+					aij[l] -= aik[l] * c[l];
+				} // l
+			} // i
+
+		} // j
+
+		for(int_t i = k + 1; i < n; i++) {
+			T_Scalar *aik = a + ioff(i, k, n, bs);
+#pragma omp simd
+			for(int_t l = 0; l < nl; l++) {
+				aik[l] *= inv[l];
+			} // l
+		} // i
+
+	} // k
+}
+/*-------------------------------------------------*/
+//
+// Right hand side b has entry (i) of lane l in b[i * bs + l]
+//
+template <typename T_Scalar>
+static void getrs_interleaved(int_t n, int_t bs, int_t nl, const T_Scalar *a, const int_t *ipiv, T_Scalar *b)
+{
+	for(int_t k = 0; k < n; k++) {
+		const int_t *ipk = ipiv + static_cast<std::size_t>(k) * bs;
+		T_Scalar *bk = b + static_cast<std::size_t>(k) * bs;
+#pragma omp simd
+		for(int_t l = 0; l < nl; l++) {
+			std::size_t d = static_cast<std::size_t>(ipk[l] - k) * bs;
+			T_Scalar tmp = bk[l];
+			bk[l] = bk[l + d];
+			bk[l + d] = tmp;
+		} // l
+	} // k
+
+	for(int_t j = 0; j < n; j++) {
+		const T_Scalar *bj = b + static_cast<std::size_t>(j) * bs;
+		for(int_t i = j + 1; i < n; i++) {
+			const T_Scalar *aij = a + ioff(i, j, n, bs);
+			T_Scalar *bi = b + static_cast<std::size_t>(i) * bs;
+#pragma omp simd
+			for(int_t l = 0; l < nl; l++) {
+				bi[l] -= aij[l] * bj[l];
+			} // l
+		} // i
+	} // j
+
+	for(int_t j = n - 1; j >= 0; j--) {
+		const T_Scalar *ajj = a + ioff(j, j, n, bs);
+		T_Scalar *bj = b + static_cast<std::size_t>(j) * bs;
+#pragma omp simd
+		for(int_t l = 0; l < nl; l++) {
+			bj[l] /= ajj[l];
+		} // l
+		for(int_t i = 0; i < j; i++) {
+			const T_Scalar *aij = a + ioff(i, j, n, bs);
+			T_Scalar *bi = b + static_cast<std::size_t>(i) * bs;
+#pragma omp simd
+			for(int_t l = 0; l < nl; l++) {
+				bi[l] -= aij[l] * bj[l];
+			} // l
+		} // i
+	} // j
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static void potrs_interleaved(int_t n, int_t bs, int_t nl, const T_Scalar *a, T_Scalar *b)
+{
+	for(int_t j = 0; j < n; j++) {
+		const T_Scalar *ajj = a + ioff(j, j, n, bs);
+		T_Scalar *bj = b + static_cast<std::size_t>(j) * bs;
+#pragma omp simd
+		for(int_t l = 0; l < nl; l++) {
+			bj[l] /= ajj[l];
+		} // l
+		for(int_t i = j + 1; i < n; i++) {
+			const T_Scalar *aij = a + ioff(i, j, n, bs);
+			T_Scalar *bi = b + static_cast<std::size_t>(i) * bs;
+#pragma omp simd
+			for(int_t l = 0; l < nl; l++) {
+				bi[l] -= aij[l] * bj[l];
+			} // l
+		} // i
+	} // j
+
+	for(int_t j = n - 1; j >= 0; j--) {
+		T_Scalar *bj = b + static_cast<std::size_t>(j) * bs;
+		for(int_t i = j + 1; i < n; i++) {
+			const T_Scalar *aij = a + ioff(i, j, n, bs);
+			const T_Scalar *bi = b + static_cast<std::size_t>(i) * bs;
+#pragma omp simd
+			for(int_t l = 0; l < nl; l++) {
+				bj[l] -= arith::conj(aij[l]) * bi[l];
+			} // l
+		} // i
+		const T_Scalar *ajj = a + ioff(j, j, n, bs);
+#pragma omp simd
+		for(int_t l = 0; l < nl; l++) {
+			bj[l] /= ajj[l];
+		} // l
+	} // j
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static void ldltnps_interleaved(bool herm, int_t n, int_t bs, int_t nl, const T_Scalar *a, T_Scalar *b)
+{
+	for(int_t j = 0; j < n; j++) {
+		const T_Scalar *bj = b + static_cast<std::size_t>(j) * bs;
+		for(int_t i = j + 1; i < n; i++) {
+			const T_Scalar *aij = a + ioff(i, j, n, bs);
+			T_Scalar *bi = b + static_cast<std::size_t>(i) * bs;
+#pragma omp simd
+			for(int_t l = 0; l < nl; l++) {
+				bi[l] -= aij[l] * bj[l];
+			} // l
+		} // i
+	} // j
+
+	for(int_t j = 0; j < n; j++) {
+		const T_Scalar *ajj = a + ioff(j, j, n, bs);
+		T_Scalar *bj = b + static_cast<std::size_t>(j) * bs;
+#pragma omp simd
+		for(int_t l = 0; l < nl; l++) {
+			bj[l] /= ajj[l];
+		} // l
+	} // j
+
+	for(int_t j = n - 1; j >= 0; j--) {
+		T_Scalar *bj = b + static_cast<std::size_t>(j) * bs;
+		for(int_t i = j + 1; i < n; i++) {
+			const T_Scalar *aij = a + ioff(i, j, n, bs);
+			const T_Scalar *bi = b + static_cast<std::size_t>(i) * bs;
+#pragma omp simd
+			for(int_t l = 0; l < nl; l++) {
+				bj[l] -= (herm ? arith::conj(aij[l]) : aij[l]) * bi[l];
+			} // l
+		} // i
+	} // j
+}
+/*-------------------------------------------------*/
+//
+// Copies the interleaved right hand sides of the listed matrices to (save) or from (restore) a packed buffer
+//
+template <typename T_Scalar>
+static void copy_lanes(bool save, int_t n, int_t bs, int_t nrhs, const std::vector<int_t>& lanes, T_Scalar *b, T_Scalar *buf)
+{
+	std::size_t pos = 0;
+
+	for(int_t lane : lanes) {
+		for(int_t r = 0; r < nrhs; r++) {
+			for(int_t i = 0; i < n; i++) {
+				T_Scalar& bi = b[ioff(i, r, n, bs) + lane];
+				if(save) buf[pos++] = bi;
+				else     bi = buf[pos++];
+			} // i
+		} // r
+	} // lane
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+LapackBatch<T_Scalar>::LapackBatch(decomp_t decompType, batch::layout_t layout)
+	: m_decompType(decompType), m_layout(layout)
+{
+	bool supported_decomp = (
+			decompType == decomp_t::Auto || 
+			decompType == decomp_t::LLT  || 
+			decompType == decomp_t::LDLT || 
+			decompType == decomp_t::LU );
+
+	if(!supported_decomp)
+		throw err::InvalidOp("Unsupported decomposition type for batched solution");
+
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+LapackBatch<T_Scalar>::~LapackBatch()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+std::string LapackBatch<T_Scalar>::name() const
+{
+	std::ostringstream ss;
+	ss << "Lapack Batch " << m_decompType;
+	return ss.str();
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void LapackBatch<T_Scalar>::defaults()
+{
+	m_dim = 0;
+	m_batchSize = 0;
+	m_prop = Property();
+	m_dtype = m_decompType;
+	m_factor = nullptr;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void LapackBatch<T_Scalar>::clear()
+{
+	m_buffer.clear();
+	m_ipiv.clear();
+	m_info.clear();
+
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+int_t LapackBatch<T_Scalar>::dim() const
+{
+	return m_dim;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+int_t LapackBatch<T_Scalar>::batchSize() const
+{
+	return m_batchSize;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+const std::vector<int_t>& LapackBatch<T_Scalar>::info() const
+{
+	return m_info;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+int_t LapackBatch<T_Scalar>::failures() const
+{
+	return static_cast<int_t>(std::count_if(m_info.begin(), m_info.end(), [](int_t i) { return i != 0; }));
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void LapackBatch<T_Scalar>::checkInput(int_t n, int_t batchSize, const T_Scalar *a, const Property& pr)
+{
+	if(n <= 0 || batchSize <= 0 || !a)
+		throw err::InvalidOp("Input batch is empty");
+
+	decomp_t dtype = determineDecompType(m_decompType, pr);
+
+	bool supported_prop = false;
+
+	if(dtype == decomp_t::LU) {
+		supported_prop = pr.isGeneral();
+	} else if(dtype == decomp_t::LLT) {
+		supported_prop = pr.isLower() && (pr.isHermitian() || (TypeTraits<T_Scalar>::is_real() && pr.isSymmetric()));
+	} else if(dtype == decomp_t::LDLT) {
+		supported_prop = pr.isLower() && (pr.isHermitian() || pr.isSymmetric());
+	} // dtype
+
+	if(!supported_prop) {
+		std::ostringstream ss;
+		ss << "Matrices with property " << pr.name() << " not supported for batched " << dtype << " decomposition";
+		throw err::InvalidOp(ss.str());
+	} // valid prop
+
+	clear();
+
+	m_dim = n;
+	m_batchSize = batchSize;
+	m_prop = pr;
+	m_dtype = dtype;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void LapackBatch<T_Scalar>::decompose(int_t n, int_t batchSize, const T_Scalar *a, const Property& pr)
+{
+	checkInput(n, batchSize, a, pr);
+
+	std::size_t nz = static_cast<std::size_t>(n) * n * batchSize;
+	m_buffer.resize(nz);
+	std::copy(a, a + nz, m_buffer.data());
+
+	m_factor = m_buffer.data();
+
+	if(m_layout == batch::layout_t::Interleaved)
+		decomposeInterleaved();
+	else
+		decomposeStrided();
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void LapackBatch<T_Scalar>::idecompose(int_t n, int_t batchSize, T_Scalar *a, const Property& pr)
+{
+	checkInput(n, batchSize, a, pr);
+
+	m_factor = a;
+
+	if(m_layout == batch::layout_t::Interleaved)
+		decomposeInterleaved();
+	else
+		decomposeStrided();
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void LapackBatch<T_Scalar>::decomposeInterleaved()
+{
+	const int_t n = m_dim;
+	const int_t bs = m_batchSize;
+	const int_t nchunks = (bs + BATCH_LANES - 1) / BATCH_LANES;
+	const bool herm = m_prop.isHermitian();
+
+	m_info.assign(bs, 0);
+
+	if(m_dtype == decomp_t::LU)
+		m_ipiv.resize(static_cast<std::size_t>(n) * bs);
+
+#pragma omp parallel for schedule(static) if(nchunks > 1)
+	for(int_t c = 0; c < nchunks; c++) {
+
+		int_t l0 = c * BATCH_LANES;
+		int_t nl = std::min(BATCH_LANES, bs - l0);
+
+		if(m_dtype == decomp_t::LU)
+			getrf_interleaved(n, bs, nl, m_factor + l0, m_ipiv.data() + l0, m_info.data() + l0);
+		else if(m_dtype == decomp_t::LLT)
+			potrf_interleaved(n, bs, nl, m_factor + l0, m_info.data() + l0);
+		else
+			ldltnp_interleaved(herm, n, bs, nl, m_factor + l0, m_info.data() + l0);
+
+	} // c
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void LapackBatch<T_Scalar>::decomposeStrided()
+{
+	const int_t n = m_dim;
+	const int_t bs = m_batchSize;
+	const std::size_t nn = static_cast<std::size_t>(n) * n;
+	const char uplo = m_prop.cuplo();
+	const bool herm = m_prop.isHermitian();
+
+	m_info.assign(bs, 0);
+
+	if(m_dtype == decomp_t::LU || m_dtype == decomp_t::LDLT)
+		m_ipiv.resize(static_cast<std::size_t>(n) * bs);
+
+#if defined(CLA3P_INTEL_MKL)
+	if(m_dtype == decomp_t::LU) {
+		mkl::getrf_batch_strided(n, n, m_factor, n, n * n, m_ipiv.data(), n, bs, m_info.data());
+		return;
+	} // mkl batch
+#endif
+
+#pragma omp parallel for schedule(static)
+	for(int_t k = 0; k < bs; k++) {
+
+		T_Scalar *ak = m_factor + k * nn;
+
+		if(m_dtype == decomp_t::LLT) {
+			m_info[k] = lapack::potrf(uplo, n, ak, n);
+			continue;
+		} // no pivots
+
+		int_t *ipk = m_ipiv.data() + static_cast<std::size_t>(k) * n;
+
+		if(m_dtype == decomp_t::LU)
+			m_info[k] = lapack::getrf(n, n, ak, n, ipk);
+		else if(herm)
+			m_info[k] = lapack::hetrf(uplo, n, ak, n, ipk);
+		else
+			m_info[k] = lapack::sytrf(uplo, n, ak, n, ipk);
+
+	} // k
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void LapackBatch<T_Scalar>::solve(T_Scalar *b, int_t nrhs) const
+{
+	if(!m_factor)
+		throw err::InvalidOp("Decomposition stage is not performed");
+
+	if(!b || nrhs <= 0)
+		throw err::InvalidOp("Right hand side is empty");
+
+	if(m_layout == batch::layout_t::Interleaved)
+		solveInterleaved(b, nrhs);
+	else
+		solveStrided(b, nrhs);
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void LapackBatch<T_Scalar>::solveInterleaved(T_Scalar *b, int_t nrhs) const
+{
+	const int_t n = m_dim;
+	const int_t bs = m_batchSize;
+	const int_t nchunks = (bs + BATCH_LANES - 1) / BATCH_LANES;
+	const bool herm = m_prop.isHermitian();
+
+#pragma omp parallel for schedule(static) if(nchunks > 1)
+	for(int_t c = 0; c < nchunks; c++) {
+
+		int_t l0 = c * BATCH_LANES;
+		int_t nl = std::min(BATCH_LANES, bs - l0);
+
+		//
+		// Lanes are solved together, keep the right hand sides of failed lanes aside
+		//
+		std::vector<int_t> failed;
+		for(int_t l = 0; l < nl; l++) {
+			if(m_info[l0 + l]) failed.push_back(l0 + l);
+		} // l
+
+		std::vector<T_Scalar> saved(failed.size() * n * nrhs);
+		copy_lanes(true, n, bs, nrhs, failed, b, saved.data());
+
+		for(int_t r = 0; r < nrhs; r++) {
+
+			T_Scalar *br = b + ioff(0, r, n, bs) + l0;
+
+			if(m_dtype == decomp_t::LU)
+				getrs_interleaved(n, bs, nl, m_factor + l0, m_ipiv.data() + l0, br);
+			else if(m_dtype == decomp_t::LLT)
+				potrs_interleaved(n, bs, nl, m_factor + l0, br);
+			else
+				ldltnps_interleaved(herm, n, bs, nl, m_factor + l0, br);
+
+		} // r
+
+		copy_lanes(false, n, bs, nrhs, failed, b, saved.data());
+
+	} // c
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void LapackBatch<T_Scalar>::solveStrided(T_Scalar *b, int_t nrhs) const
+{
+	const int_t n = m_dim;
+	const int_t bs = m_batchSize;
+	const std::size_t nn = static_cast<std::size_t>(n) * n;
+	const std::size_t nb = static_cast<std::size_t>(n) * nrhs;
+	const char uplo = m_prop.cuplo();
+	const bool herm = m_prop.isHermitian();
+
+	std::vector<int_t> info(bs, 0);
+
+#if defined(CLA3P_INTEL_MKL)
+	if(m_dtype == decomp_t::LU) {
+
+		//
+		// The batched routine solves all systems, keep the right hand sides of failed matrices aside
+		//
+		std::vector<int_t> failed;
+		for(int_t k = 0; k < bs; k++) {
+			if(m_info[k]) failed.push_back(k);
+		} // k
+
+		std::vector<T_Scalar> saved(failed.size() * nb);
+		for(std::size_t f = 0; f < failed.size(); f++) {
+			std::copy_n(b + failed[f] * nb, nb, saved.data() + f * nb);
+		} // f
+
+		mkl::getrs_batch_strided('N', n, nrhs, m_factor, n, n * n, m_ipiv.data(), n, b, n, n * nrhs, bs, info.data());
+
+		for(std::size_t f = 0; f < failed.size(); f++) {
+			std::copy_n(saved.data() + f * nb, nb, b + failed[f] * nb);
+			info[failed[f]] = 0;
+		} // f
+
+		for(int_t k = 0; k < bs; k++) {
+			lapack_info_check(info[k]);
+		} // k
+
+		return;
+
+	} // mkl batch
+#endif
+
+#pragma omp parallel for schedule(static)
+	for(int_t k = 0; k < bs; k++) {
+
+		if(m_info[k])
+			continue;
+
+		const T_Scalar *ak = m_factor + k * nn;
+		T_Scalar *bk = b + k * nb;
+
+		if(m_dtype == decomp_t::LLT) {
+			info[k] = lapack::potrs(uplo, n, nrhs, ak, n, bk, n);
+			continue;
+		} // no pivots
+
+		const int_t *ipk = m_ipiv.data() + static_cast<std::size_t>(k) * n;
+
+		if(m_dtype == decomp_t::LU)
+			info[k] = lapack::getrs('N', n, nrhs, ak, n, ipk, bk, n);
+		else if(herm)
+			info[k] = lapack::hetrs(uplo, n, nrhs, ak, n, ipk, bk, n);
+		else
+			info[k] = lapack::sytrs(uplo, n, nrhs, ak, n, ipk, bk, n);
+
+	} // k
+
+	for(int_t k = 0; k < bs; k++) {
+		lapack_info_check(info[k]);
+	} // k
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template class LapackBatch<real_t>;
+template class LapackBatch<real4_t>;
+template class LapackBatch<complex_t>;
+template class LapackBatch<complex8_t>;
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef CLA3P_LAPACK_BATCH_HPP_
+#define CLA3P_LAPACK_BATCH_HPP_
+
+/**
+ * @file
+ */
+
+#include <string>
+#include <vector>
+
+#include "cla3p/types.hpp"
+#include "cla3p/support/heap_buffer.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+/*-------------------------------------------------*/
+
+/*-------------------------------------------------*/
+namespace batch {
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup cla3p_module_index_special_enums
+ * @enum layout_t
+ * @brief The storage layout of a batch of equally sized dense matrices.
+ */
+enum class layout_t {
+	Interleaved = 0, /**< Entry (i,j) of matrix k is stored in position (i + j * n) * batchSize + k */
+	Strided          /**< Matrix k is stored column major in position k * n * n, with leading dimension n */
+};
+
+/*-------------------------------------------------*/
+} // namespace batch
+/*-------------------------------------------------*/
+
+/**
+ * @nosubgrouping
+ * @brief The linear solver for batches of small independent dense matrices.
+ *
+ * All matrices in the batch share the dimension and the property. @n
+ * Interleaved batches are processed with kernels that handle one matrix per vector lane, 
+ * strided batches with one Lapack call per matrix (batched Intel MKL routines for LU). @n
+ * Symmetric/Hermitian matrices are stored in the lower part. @n
+ * In interleaved layout, LDLt is performed without pivoting and is suitable for definite and quasi definite matrices. @n
+ * Failures are reported per matrix by info() and do not abort the batch, 
+ * the right hand sides of matrices with failed decomposition are left unchanged by solve().
+ */
+template <typename T_Scalar>
+class LapackBatch {
+
+	private:
+		using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	public:
+
+		// no copy
+		LapackBatch(const LapackBatch&) = delete;
+		LapackBatch& operator=(const LapackBatch&) = delete;
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty solver object.
+		 *
+		 * @param[in] decompType The decomposition type, LLt, LDLt, LU or Auto (default).
+		 * @param[in] layout The storage layout of the matrices and the right hand sides.
+		 */
+		explicit LapackBatch(decomp_t decompType = decomp_t::Auto, batch::layout_t layout = batch::layout_t::Interleaved);
+
+		/**
+		 * @brief Destroys the solver.
+		 *
+		 * Clears all internal data and destroys the solver.
+		 */
+		~LapackBatch();
+
+		std::string name() const;
+
+		/**
+		 * @brief Clears the solver internal data.
+		 */
+		void clear();
+
+		/**
+		 * @brief Performs batch decomposition.
+		 * @param[in] n The dimension of the matrices.
+		 * @param[in] batchSize The number of matrices.
+		 * @param[in] a The matrix values, in the solver layout.
+		 * @param[in] pr The property of the matrices.
+		 */
+		void decompose(int_t n, int_t batchSize, const T_Scalar *a, const Property& pr = Property::General());
+
+		/**
+		 * @brief Performs in-place batch decomposition.
+		 * @param[in] n The dimension of the matrices.
+		 * @param[in] batchSize The number of matrices.
+		 * @param[in,out] a The matrix values, in the solver layout, overwritten with the factors. 
+		 *                  Must remain valid while the solver is in use.
+		 * @param[in] pr The property of the matrices.
+		 */
+		void idecompose(int_t n, int_t batchSize, T_Scalar *a, const Property& pr = Property::General());
+
+		/**
+		 * @brief Performs in-place batch solution.
+		 * @param[in,out] b On input, the right hand sides, on exit overwritten with the solutions. @n
+		 *                  In interleaved layout, entry (i,r) of system k is stored in position (i + r * n) * batchSize + k. @n
+		 *                  In strided layout, the right hand sides of system k are stored column major in position k * n * nrhs.
+		 * @param[in] nrhs The number of right hand sides per system.
+		 *
+		 * The right hand sides of matrices with failed decomposition (nonzero info()) are left unchanged.
+		 */
+		void solve(T_Scalar *b, int_t nrhs = 1) const;
+
+		/**
+		 * @brief The dimension of the matrices.
+		 */
+		int_t dim() const;
+
+		/**
+		 * @brief The number of matrices.
+		 */
+		int_t batchSize() const;
+
+		/**
+		 * @brief Decomposition status per matrix.
+		 * @return Zero for successful decompositions, otherwise the Lapack style info of the failed decomposition.
+		 */
+		const std::vector<int_t>& info() const;
+
+		/**
+		 * @brief Failed decompositions.
+		 * @return The number of matrices with nonzero info.
+		 */
+		int_t failures() const;
+
+	private:
+		const decomp_t m_decompType;
+		const batch::layout_t m_layout;
+
+		int_t m_dim;
+		int_t m_batchSize;
+		Property m_prop;
+		decomp_t m_dtype;
+		T_Scalar *m_factor;
+		HeapBuffer<T_Scalar> m_buffer;
+		std::vector<int_t> m_ipiv;
+		std::vector<int_t> m_info;
+
+		void defaults();
+		void checkInput(int_t n, int_t batchSize, const T_Scalar *a, const Property& pr);
+		void decomposeInterleaved();
+		void decomposeStrided();
+		void solveInterleaved(T_Scalar *b, int_t nrhs) const;
+		void solveStrided(T_Scalar *b, int_t nrhs) const;
+};
+
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_LAPACK_BATCH_HPP_
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+// this file inc
+#include "cla3p/linsol/lapack_mixed_precision.hpp"
+
+// system
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/bulk/dns.hpp"
+#include "cla3p/algebra/functional_multmm.hpp"
+#include "cla3p/algebra/functional_update.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/checks/solve_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LapackMixedPrecision<T_Matrix>::LapackMixedPrecision(decomp_t decompType)
+	: m_decompType(decompType), m_low(decompType), m_high(decompType)
+{
+	if(decompType == decomp_t::CompleteLU)
+		throw err::InvalidOp("Complete LU is not supported in mixed precision");
+
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LapackMixedPrecision<T_Matrix>::~LapackMixedPrecision()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+std::string LapackMixedPrecision<T_Matrix>::name() const
+{
+	std::ostringstream ss;
+	ss << "Lapack Mixed Precision " << m_decompType;
+	return ss.str();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LapackMixedPrecision<T_Matrix>::defaults()
+{
+	m_maxRefinements = 30;
+	m_anorm = 0;
+	m_fallback = false;
+	m_iterations = 0;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LapackMixedPrecision<T_Matrix>::clearFactors()
+{
+	m_matrix.clear();
+	m_low.clear();
+	m_high.clear();
+	m_anorm = 0;
+	m_fallback = false;
+	m_iterations = 0;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LapackMixedPrecision<T_Matrix>::clear()
+{
+	clearFactors();
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LapackMixedPrecision<T_Matrix>::setMaxRefinements(int_t maxit)
+{
+	if(maxit < 0)
+		throw err::InvalidOp("Maximum number of refinements must be non negative");
+
+	m_maxRefinements = maxit;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+int_t LapackMixedPrecision<T_Matrix>::iterations() const
+{
+	return m_iterations;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+bool LapackMixedPrecision<T_Matrix>::fallback() const
+{
+	return m_fallback;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LapackMixedPrecision<T_Matrix>::decompose(const T_Matrix& mat)
+{
+	T_Matrix tmp = mat.copy();
+	idecompose(tmp);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LapackMixedPrecision<T_Matrix>::idecompose(T_Matrix& mat)
+{
+	clearFactors();
+
+	m_matrix = mat.move();
+
+	if(!decomposeLow())
+		decomposeHigh();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+bool LapackMixedPrecision<T_Matrix>::decomposeLow()
+{
+	T_LowMatrix low(m_matrix.nrows(), m_matrix.ncols(), m_matrix.prop());
+
+	bool representable = blk::dns::convert(m_matrix.prop().uplo(), 
+			m_matrix.nrows(), m_matrix.ncols(), 
+			m_matrix.values(), m_matrix.ld(), 
+			low.values(), low.ld());
+
+	if(!representable)
+		return false;
+
+	try {
+		m_low.idecompose(low);
+	} catch(err::Exception&) {
+		m_low.clear();
+		return false;
+	}
+
+	m_anorm = m_matrix.normInf();
+
+	return true;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LapackMixedPrecision<T_Matrix>::decomposeHigh()
+{
+	m_low.clear();
+	m_fallback = true;
+	m_high.idecompose(m_matrix);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+bool LapackMixedPrecision<T_Matrix>::lowSolve(const T_Matrix& rhs, T_Matrix& sol, T_LowMatrix& work) const
+{
+	bool representable = blk::dns::convert(uplo_t::Full, 
+			rhs.nrows(), rhs.ncols(), 
+			rhs.values(), rhs.ld(), 
+			work.values(), work.ld());
+
+	if(!representable)
+		return false;
+
+	m_low.solve(work);
+
+	blk::dns::convert(uplo_t::Full, 
+			work.nrows(), work.ncols(), 
+			work.values(), work.ld(), 
+			sol.values(), sol.ld());
+
+	return true;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+bool LapackMixedPrecision<T_Matrix>::refine(T_Matrix& rhs)
+{
+	const int_t n = m_matrix.ncols();
+	const int_t nrhs = rhs.ncols();
+
+	// per column stopping criterion from LAPACK xSGESV/xSPOSV
+	const T_RScalar cte = m_anorm * std::numeric_limits<T_RScalar>::epsilon() * std::sqrt(static_cast<T_RScalar>(n));
+
+	T_Matrix x(n, nrhs);
+	T_Matrix r(n, nrhs);
+	T_LowMatrix work(n, nrhs);
+
+	if(!lowSolve(rhs, x, work))
+		return false;
+
+	T_RScalar rprev = std::numeric_limits<T_RScalar>::max();
+
+	for(int_t it = 0; it <= m_maxRefinements; it++) {
+
+		blk::dns::copy(uplo_t::Full, n, nrhs, rhs.values(), rhs.ld(), r.values(), r.ld());
+		ops::mult(T_Scalar(-1), op_t::N, m_matrix, op_t::N, x, T_Scalar(1), r);
+
+		bool converged = true;
+		T_RScalar rmax = 0;
+
+		for(int_t j = 0; j < nrhs; j++) {
+			T_RScalar rnorm = blk::dns::norm_max(prop_t::General, uplo_t::Full, n, 1, r.values() + j * r.ld(), r.ld());
+			T_RScalar xnorm = blk::dns::norm_max(prop_t::General, uplo_t::Full, n, 1, x.values() + j * x.ld(), x.ld());
+			converged = converged && (rnorm <= xnorm * cte);
+			rmax = std::max(rmax, rnorm);
+		} // j
+
+		if(converged) {
+			blk::dns::copy(uplo_t::Full, n, nrhs, x.values(), x.ld(), rhs.values(), rhs.ld());
+			return true;
+		}
+
+		// stagnation, also catches non finite residuals
+		if(it == m_maxRefinements || !(rmax <= rprev / 2))
+			return false;
+
+		rprev = rmax;
+
+		if(!lowSolve(r, r, work))
+			return false;
+
+		ops::update(T_Scalar(1), r, x);
+
+		m_iterations = it + 1;
+
+	} // it
+
+	return false;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LapackMixedPrecision<T_Matrix>::solve(T_Matrix& rhs)
+{
+	if(!m_matrix && !m_fallback)
+		throw err::InvalidOp("Decomposition stage is not performed");
+
+	m_iterations = 0;
+
+	if(!m_fallback) {
+
+		default_solve_input_check(m_matrix.ncols(), rhs);
+
+		if(refine(rhs))
+			return;
+
+		decomposeHigh();
+
+	} // mixed
+
+	m_high.solve(rhs);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LapackMixedPrecision<T_Matrix>::solve(T_Vector& rhs)
+{
+	T_Matrix tmp(rhs.size(), 1, rhs.values(), rhs.size(), false);
+	solve(tmp);
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template class LapackMixedPrecision<dns::RdMatrix>;
+template class LapackMixedPrecision<dns::CdMatrix>;
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef CLA3P_LAPACK_MIXED_PRECISION_HPP_
+#define CLA3P_LAPACK_MIXED_PRECISION_HPP_
+
+/**
+ * @file
+ */
+
+#include <string>
+#include <type_traits>
+
+#include "cla3p/types.hpp"
+#include "cla3p/linsol/lapack_base.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+/*-------------------------------------------------*/
+
+namespace dns { template <typename T_Scalar> class XxVector; }
+namespace dns { template <typename T_Scalar> class XxMatrix; }
+namespace dns { template <typename T_Scalar> class CxMatrix; }
+
+/**
+ * @nosubgrouping
+ * @brief The mixed precision linear solver for dense double precision matrices.
+ *
+ * The matrix is factorized in single precision and the solution is refined in double precision,
+ * using the residual <b>r = b - A * x</b> and the single precision factor for the corrections. @n
+ * If the single precision copy overflows, the single precision factorization fails, or the refinement stagnates,
+ * the solver falls back to a double precision factorization, which is used for all subsequent solutions.
+ */
+template <typename T_Matrix>
+class LapackMixedPrecision {
+
+	private:
+		using T_Scalar = typename T_Matrix::value_type;
+		using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+		using T_Vector = dns::XxVector<T_Scalar>;
+		using T_LowScalar = typename std::conditional<TypeTraits<T_Scalar>::is_real(), real4_t, complex8_t>::type;
+		using T_LowMatrix = typename std::conditional<TypeTraits<T_Scalar>::is_real(), 
+					dns::XxMatrix<T_LowScalar>, dns::CxMatrix<T_LowScalar>>::type;
+
+	public:
+
+		// no copy
+		LapackMixedPrecision(const LapackMixedPrecision&) = delete;
+		LapackMixedPrecision& operator=(const LapackMixedPrecision&) = delete;
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty solver object.
+		 *
+		 * @param[in] decompType The decomposition type, LLt, LDLt, LU or Auto (default).
+		 */
+		explicit LapackMixedPrecision(decomp_t decompType = decomp_t::Auto);
+
+		/**
+		 * @brief Destroys the solver.
+		 *
+		 * Clears all internal data and destroys the solver.
+		 */
+		~LapackMixedPrecision();
+
+		std::string name() const;
+
+		/**
+		 * @brief Clears the solver internal data.
+		 *
+		 * Clears the solver internal data and resets all settings
+		 */
+		void clear();
+
+		/**
+		 * @brief Maximum number of refinement steps.
+		 * @param[in] maxit The maximum number of corrections per solution before falling back to double precision (default 30).
+		 */
+		void setMaxRefinements(int_t maxit);
+
+		/**
+		 * @brief Performs matrix decomposition.
+		 * @param[in] mat The matrix to be decomposed.
+		 */
+		void decompose(const T_Matrix& mat);
+
+		/**
+		 * @brief Performs matrix decomposition, taking ownership of the matrix.
+		 * @param[in] mat The matrix to be decomposed, destroyed after the operation.
+		 */
+		void idecompose(T_Matrix& mat);
+
+		/**
+		 * @brief Performs in-place matrix solution.
+		 * @param[in,out] rhs On input, the right hand side matrix, on exit is overwritten with the solution.
+		 */
+		void solve(T_Matrix& rhs);
+
+		/**
+		 * @brief Performs in-place vector solution.
+		 * @param[in,out] rhs On input, the right hand side vector, on exit is overwritten with the solution.
+		 */
+		void solve(T_Vector& rhs);
+
+		/**
+		 * @brief Refinement steps performed.
+		 * @return The number of corrections applied in the last solution.
+		 */
+		int_t iterations() const;
+
+		/**
+		 * @brief Fallback flag.
+		 * @return Whether the double precision factorization is in use.
+		 */
+		bool fallback() const;
+
+	private:
+		template <typename T_Mat>
+		class Factorization : public LapackBase<T_Mat> {
+			public:
+				explicit Factorization(decomp_t decompType) : LapackBase<T_Mat>(decompType) {}
+		};
+
+		const decomp_t m_decompType;
+		int_t m_maxRefinements;
+
+		T_Matrix m_matrix;
+		T_RScalar m_anorm;
+		Factorization<T_LowMatrix> m_low;
+		Factorization<T_Matrix> m_high;
+
+		bool m_fallback;
+		int_t m_iterations;
+
+		void defaults();
+		void clearFactors();
+		bool decomposeLow();
+		void decomposeHigh();
+		bool lowSolve(const T_Matrix& rhs, T_Matrix& sol, T_LowMatrix& work) const;
+		bool refine(T_Matrix& rhs);
+};
+
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_LAPACK_MIXED_PRECISION_HPP_
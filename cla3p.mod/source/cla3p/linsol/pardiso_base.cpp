@@ -20,6 +20,7 @@
 // system
 #include <sstream>
 #include <algorithm>
+#include <cstdlib>
 
 // 3rd
 
@@ -76,34 +77,130 @@ void PardisoBase<T_Matrix>::defaults()
 
 	m_mtype = mtype_t::Undefined;
 	m_maxfct = 1;
+	m_mnum = 1;
 	m_msglvl = 0;
 
 	m_dim = 0;
+	m_nnz = 0;
 	m_colptr = nullptr;
 	m_rowidx = nullptr;
 	m_values = nullptr;
+	m_analyzed = false;
+	m_colptrAnalyzed.clear();
+	m_rowidxAnalyzed.clear();
+	m_factorValues.assign(1, nullptr);
+	m_schurValues.assign(1, std::vector<T_Scalar>());
+	m_schurDim = 0;
+	m_partialMask.clear();
+	m_oocVolume = 0;
 }
 /*-------------------------------------------------*/
 template <typename T_Matrix>
 void PardisoBase<T_Matrix>::clear()
 {
+	//
+	// Release before the parameters are reset, out-of-core scratch files are removed with the current settings
+	//
+	callDriver(phase_t::ClearAll);
+
 	pardiso::GlobalParams::clear();
 	pardiso::AnalysisParams::clear();
 	pardiso::DecompParams::clear();
+	pardiso::OutOfCoreParams::clear();
 	pardiso::SolveParams::clear();
 
 	m_permBuffer.clear();
 	m_permMatrix.clear();
 
-	callDriver(phase_t::ClearAll);
-
 	defaults();
 }
 /*-------------------------------------------------*/
 template <typename T_Matrix>
 void PardisoBase<T_Matrix>::clearNumeric()
 {
-	callDriver(phase_t::ClearNumeric);
+	for(int_t k = 0; k < m_maxfct; k++) {
+		if(m_factorValues[k]) {
+			m_mnum = k + 1;
+			m_factorValues[k] = nullptr;
+			callDriver(phase_t::ClearNumeric);
+		} // decomposed
+	} // k
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void PardisoBase<T_Matrix>::setMaxFactors(int_t n)
+{
+	if(n < 1)
+		throw err::InvalidOp("Number of factors must be positive");
+
+	if(n == m_maxfct)
+		return;
+
+	if(m_mtype != mtype_t::Undefined) {
+		callDriver(phase_t::ClearAll);
+		m_mtype = mtype_t::Undefined;
+		m_analyzed = false;
+	} // release analysis for the previous number of factors
+
+	m_maxfct = n;
+	m_factorValues.assign(n, nullptr);
+	m_schurValues.assign(n, std::vector<T_Scalar>());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+int_t PardisoBase<T_Matrix>::maxFactors() const
+{
+	return m_maxfct;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void PardisoBase<T_Matrix>::checkSlot(int_t slot) const
+{
+	if(slot < 0 || slot >= m_maxfct)
+		throw err::OutOfBounds("Factor slot " + std::to_string(slot) + " out of range [0," + std::to_string(m_maxfct) + ")");
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void PardisoBase<T_Matrix>::selectFactor(int_t slot)
+{
+	checkSlot(slot);
+
+	if(!m_factorValues[slot])
+		throw err::Exception(msg::PardisoError() + ": Decomposition not performed for factor slot " + std::to_string(slot));
+
+	m_mnum = slot + 1;
+	m_values = m_factorValues[slot];
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void PardisoBase<T_Matrix>::discardFactors()
+{
+	std::fill(m_factorValues.begin(), m_factorValues.end(), nullptr);
+
+	for(std::vector<T_Scalar>& schur : m_schurValues) {
+		std::vector<T_Scalar>().swap(schur);
+	} // slots
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void PardisoBase<T_Matrix>::factorize(int_t slot)
+{
+	m_mnum = slot + 1;
+	m_factorValues[slot] = nullptr;
+
+	T_Scalar *schur = nullptr;
+
+	if(m_schurDim) {
+		m_schurValues[slot].resize(static_cast<std::size_t>(m_schurDim) * static_cast<std::size_t>(m_schurDim));
+		schur = m_schurValues[slot].data();
+	} // Schur complement is returned in x
+
+	callDriver(phase_t::Numeric, 0, nullptr, schur);
+
+	m_factorValues[slot] = m_values;
+
+	if(outOfCore())
+		m_oocVolume += factorMemory();
 }
 /*-------------------------------------------------*/
 template <typename T_Matrix>
@@ -153,8 +250,25 @@ void PardisoBase<T_Matrix>::prepareForAnalysis(const T_Matrix& mat)
 template <typename T_Matrix>
 void PardisoBase<T_Matrix>::analysis(const T_Matrix& mat)
 {
+	m_analyzed = false;
+	m_mnum = 1;
+	m_oocVolume = 0;
+	discardFactors();
+
 	prepareForAnalysis(mat);
+
+	//
+	// Keep a copy of the analyzed pattern, refactorization and reuse checks must not depend on mat
+	//
+	m_nnz = mat.nnz();
+	m_colptrAnalyzed.assign(mat.colptr(), mat.colptr() + m_dim + 1);
+	m_rowidxAnalyzed.assign(mat.rowidx(), mat.rowidx() + m_nnz);
+	m_colptr = m_colptrAnalyzed.data();
+	m_rowidx = m_rowidxAnalyzed.data();
+
 	callDriver(phase_t::Analysis);
+
+	m_analyzed = true;
 }
 /*-------------------------------------------------*/
 template <typename T_Matrix>
@@ -173,6 +287,76 @@ void PardisoBase<T_Matrix>::updateIparmDecomposition()
 			m_iparm[9] = 0;
 
 	} // iparm09
+
+	updateFactorStorage();
+}
+/*-------------------------------------------------*/
+static void setEnvironmentVariable(const std::string& name, const std::string& value)
+{
+#if defined(_WIN32)
+	_putenv_s(name.c_str(), value.c_str());
+#else
+	setenv(name.c_str(), value.c_str(), 1);
+#endif
+}
+/*-------------------------------------------------*/
+static void unsetEnvironmentVariable(const std::string& name)
+{
+#if defined(_WIN32)
+	_putenv_s(name.c_str(), "");
+#else
+	unsetenv(name.c_str());
+#endif
+}
+/*-------------------------------------------------*/
+/*
+ * Sets environment variables for the lifetime of the object, previous values are restored on destruction
+ */
+class ScopedEnvironment {
+
+	public:
+		ScopedEnvironment() = default;
+		ScopedEnvironment(const ScopedEnvironment&) = delete;
+		ScopedEnvironment& operator=(const ScopedEnvironment&) = delete;
+
+		~ScopedEnvironment()
+		{
+			for(std::size_t i = m_saved.size(); i-- > 0; ) {
+				if(m_saved[i].existed)
+					setEnvironmentVariable(m_saved[i].name, m_saved[i].value);
+				else
+					unsetEnvironmentVariable(m_saved[i].name);
+			} // i
+		}
+
+		void set(const std::string& name, const std::string& value)
+		{
+			const char *prev = std::getenv(name.c_str());
+			m_saved.push_back({name, prev != nullptr, (prev ? prev : "")});
+			setEnvironmentVariable(name, value);
+		}
+
+	private:
+		struct Saved {
+			std::string name;
+			bool existed;
+			std::string value;
+		};
+		std::vector<Saved> m_saved;
+};
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void PardisoBase<T_Matrix>::updateFactorStorage()
+{
+	bool ooc = false;
+
+	if(factorStorage() == pardiso::ooc_t::OutOfCore) {
+		ooc = true;
+	} else if(factorStorage() == pardiso::ooc_t::Auto) {
+		ooc = (memoryBudget() > 0 && inCoreMemory() > 1024LL * memoryBudget());
+	} // storage mode
+
+	m_iparm[59] = (ooc ? 2 : 0);
 }
 /*-------------------------------------------------*/
 template <typename T_Matrix>
@@ -193,10 +377,49 @@ void PardisoBase<T_Matrix>::prepareForDecomposition(const T_Matrix& mat)
 }
 /*-------------------------------------------------*/
 template <typename T_Matrix>
-void PardisoBase<T_Matrix>::decompose(const T_Matrix& mat)
+bool PardisoBase<T_Matrix>::analysisReusable(const T_Matrix& mat)
 {
+	if(m_mtype == mtype_t::Undefined || !m_analyzed)
+		return false;
+
+	if(m_dim != mat.ncols() || m_nnz != mat.nnz() || m_mtype != deduceMtype(mat))
+		return false;
+
+	return (
+			std::equal(m_colptrAnalyzed.begin(), m_colptrAnalyzed.end(), mat.colptr()) && 
+			std::equal(m_rowidxAnalyzed.begin(), m_rowidxAnalyzed.end(), mat.rowidx()));
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void PardisoBase<T_Matrix>::decompose(const T_Matrix& mat, int_t slot)
+{
+	decomp_generic_check(mat);
+	checkSlot(slot);
+
+	if(!analysisReusable(mat)) {
+		analysis(mat);
+	} // new pattern
+
 	prepareForDecomposition(mat);
-	callDriver(phase_t::Numeric);
+	factorize(slot);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void PardisoBase<T_Matrix>::refactorize(const T_Scalar *values, int_t slot)
+{
+	if(m_mtype == mtype_t::Undefined || !m_analyzed) {
+		throw err::Exception(msg::PardisoError() + ": Analysis not performed");
+	} // error
+
+	if(!values) {
+		throw err::InvalidOp("Refactorization values not provided");
+	} // error
+
+	checkSlot(slot);
+
+	m_values = values;
+	updateIparmDecomposition();
+	factorize(slot);
 }
 /*-------------------------------------------------*/
 template <typename T_Matrix>
@@ -235,8 +458,10 @@ static void applyConjugationIfNeeded(bool conjop, const T_Matrix& A)
 }
 /*-------------------------------------------------*/
 template <typename T_Matrix>
-void PardisoBase<T_Matrix>::solve(const dns::XxMatrix<T_Scalar>& rhs, dns::XxMatrix<T_Scalar>& sol)
+void PardisoBase<T_Matrix>::solveDriver(phase_t phase, const dns::XxMatrix<T_Scalar>& rhs, dns::XxMatrix<T_Scalar>& sol, int_t slot)
 {
+	selectFactor(slot);
+
 	if(!sol)
 		sol = dns::XxMatrix<T_Scalar>(rhs.nrows(), rhs.ncols());
 
@@ -247,7 +472,12 @@ void PardisoBase<T_Matrix>::solve(const dns::XxMatrix<T_Scalar>& rhs, dns::XxMat
 
 		try {
 			prepareForSolution(rhs, sol);
-			callDriver(phase_t::Solve, rhs.ncols(), const_cast<T_Scalar*>(rhs.values()), sol.values());
+			callDriver(phase, rhs.ncols(), const_cast<T_Scalar*>(rhs.values()), sol.values());
+
+			if(outOfCore()) {
+				int_t sweeps = (phase == phase_t::Solve ? 2 : (phase == phase_t::DiagonalSolve ? 0 : 1));
+				m_oocVolume += static_cast<long long int>(sweeps) * factorMemory();
+			} // ooc traffic
 		} catch (...) {
 			applyConjugationIfNeeded(conjop, rhs);
 			throw;
@@ -261,21 +491,112 @@ void PardisoBase<T_Matrix>::solve(const dns::XxMatrix<T_Scalar>& rhs, dns::XxMat
 		for(int_t j = 0; j < rhs.ncols(); j++) {
 			Guard<dns::XxVector<T_Scalar>> grdBj = rhs.rcolumn(j);
 			dns::XxVector<T_Scalar> Xj = sol.rcolumn(j);
-			solve(grdBj.get(), Xj);
+			solveDriver(phase, grdBj.get(), Xj, slot);
 		} // j
 
 	} // ld checks
 }
 /*-------------------------------------------------*/
 template <typename T_Matrix>
-void PardisoBase<T_Matrix>::solve(const dns::XxVector<T_Scalar>& rhs, dns::XxVector<T_Scalar>& sol)
+void PardisoBase<T_Matrix>::solveDriver(phase_t phase, const dns::XxVector<T_Scalar>& rhs, dns::XxVector<T_Scalar>& sol, int_t slot)
 {
 	if(!sol)
 		sol = dns::XxVector<T_Scalar>(rhs.size());
 
 	Guard<dns::XxMatrix<T_Scalar>> grdRhs = dns::XxMatrix<T_Scalar>::view(rhs.size(), 1, rhs.values(), rhs.size());
 	dns::XxMatrix<T_Scalar> tmpSol(sol.size(), 1, sol.values(), sol.size(), false);
-	solve(grdRhs.get(), tmpSol);
+	solveDriver(phase, grdRhs.get(), tmpSol, slot);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void PardisoBase<T_Matrix>::solve(const dns::XxMatrix<T_Scalar>& rhs, dns::XxMatrix<T_Scalar>& sol, int_t slot)
+{
+	solveDriver(phase_t::Solve, rhs, sol, slot);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void PardisoBase<T_Matrix>::solve(const dns::XxVector<T_Scalar>& rhs, dns::XxVector<T_Scalar>& sol, int_t slot)
+{
+	solveDriver(phase_t::Solve, rhs, sol, slot);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void PardisoBase<T_Matrix>::solve(const T_Matrix& rhs, dns::XxMatrix<T_Scalar>& sol, int_t slot)
+{
+	default_solve_input_check(m_dim, rhs);
+
+	bool sparseRhs = (m_iparm[30] == static_cast<int_t>(pardiso::partial_t::SparseRhsSelectedSolution) || 
+	                  m_iparm[30] == static_cast<int_t>(pardiso::partial_t::SparseRhs));
+
+	if(sparseRhs) {
+
+		for(int_t irow = 0; irow < rhs.nnz(); irow++) {
+			int_t i = rhs.rowidx()[irow];
+			if(!m_partialMask[i])
+				throw err::NoConsistency("Right hand side non zero at row " + std::to_string(i) + " outside the partial solution index set");
+		} // irow
+
+	} // sparse rhs
+
+	dns::XxMatrix<T_Scalar> denseRhs = rhs.toDns();
+	solveDriver(phase_t::Solve, denseRhs, sol, slot);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void PardisoBase<T_Matrix>::forwardSolve(const dns::XxMatrix<T_Scalar>& rhs, dns::XxMatrix<T_Scalar>& sol, int_t slot)
+{
+	solveDriver(phase_t::ForwardSolve, rhs, sol, slot);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void PardisoBase<T_Matrix>::forwardSolve(const dns::XxVector<T_Scalar>& rhs, dns::XxVector<T_Scalar>& sol, int_t slot)
+{
+	solveDriver(phase_t::ForwardSolve, rhs, sol, slot);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void PardisoBase<T_Matrix>::diagonalSolve(const dns::XxMatrix<T_Scalar>& rhs, dns::XxMatrix<T_Scalar>& sol, int_t slot)
+{
+	solveDriver(phase_t::DiagonalSolve, rhs, sol, slot);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void PardisoBase<T_Matrix>::diagonalSolve(const dns::XxVector<T_Scalar>& rhs, dns::XxVector<T_Scalar>& sol, int_t slot)
+{
+	solveDriver(phase_t::DiagonalSolve, rhs, sol, slot);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void PardisoBase<T_Matrix>::backwardSolve(const dns::XxMatrix<T_Scalar>& rhs, dns::XxMatrix<T_Scalar>& sol, int_t slot)
+{
+	solveDriver(phase_t::BackwardSolve, rhs, sol, slot);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void PardisoBase<T_Matrix>::backwardSolve(const dns::XxVector<T_Scalar>& rhs, dns::XxVector<T_Scalar>& sol, int_t slot)
+{
+	solveDriver(phase_t::BackwardSolve, rhs, sol, slot);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+dns::XxMatrix<typename T_Matrix::value_type> PardisoBase<T_Matrix>::schurComplement(int_t slot) const
+{
+	checkSlot(slot);
+
+	if(!m_schurDim)
+		throw err::InvalidOp("Schur complement index set not provided");
+
+	if(!m_factorValues[slot])
+		throw err::Exception(msg::PardisoError() + ": Decomposition not performed for factor slot " + std::to_string(slot));
+
+	//
+	// Pardiso returns the row major Schur complement of the (row compressed) transpose,
+	// that is the column major Schur complement of the input matrix
+	//
+	dns::XxMatrix<T_Scalar> ret(m_schurDim, m_schurDim);
+	std::copy(m_schurValues[slot].begin(), m_schurValues[slot].end(), ret.values());
+
+	return ret;
 }
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
@@ -318,8 +639,6 @@ template <typename T_Matrix>
 void PardisoBase<T_Matrix>::updateMatrixInfo(const T_Matrix& mat)
 {
 	m_dim = mat.ncols();
-	m_colptr = mat.colptr();
-	m_rowidx = mat.rowidx();
 	m_values = mat.values();
 }
 /*-------------------------------------------------*/
@@ -338,7 +657,41 @@ void PardisoBase<T_Matrix>::configureFillReducer()
 {
 	resizePerm(m_dim);
 
-	if(userDefinedPermutation()) {
+	m_schurDim = 0;
+	m_partialMask.clear();
+
+	if(schurComplementMode() || partialSolveMode()) {
+
+		const std::vector<int_t>& indices = maskIndices();
+
+		if(schurComplementMode() && static_cast<int_t>(indices.size()) >= m_dim)
+			throw err::NoConsistency("Schur complement index set must be a proper subset of the matrix indices");
+
+		int_t *mask = m_permMatrix.values();
+		std::fill(mask, mask + m_dim, 0);
+
+		for(int_t idx : indices) {
+
+			if(idx < 0 || idx >= m_dim)
+				throw err::OutOfBounds(msg::IndexOutOfBounds(m_dim, idx));
+
+			if(mask[idx])
+				throw err::NoConsistency("Duplicate index " + std::to_string(idx) + " in Pardiso index set");
+
+			mask[idx] = 1;
+
+		} // idx
+
+		//
+		// Pardiso overwrites perm with the ordering in the analysis phase, keep the mask for sparse rhs checks
+		//
+		if(schurComplementMode()) {
+			m_schurDim = static_cast<int_t>(indices.size());
+		} else {
+			m_partialMask.assign(mask, mask + m_dim);
+		}
+
+	} else if(userDefinedPermutation()) {
 
 		if(m_dim != userPermMatrix().size())
 			throw err::NoConsistency("User defined permutation matrix dimension mismatch");
@@ -399,10 +752,26 @@ template <typename T_Matrix>
 void PardisoBase<T_Matrix>::callDriver(phase_t phase, int_t nrhs, T_Scalar *b, T_Scalar *x)
 {
 #if defined(CLA3P_INTEL_MKL)
+	//
+	// Pardiso reads the out-of-core settings from the environment (or a pardiso_ooc.cfg file)
+	// They are set for the duration of the call only, so they do not leak to other solvers
+	//
+	ScopedEnvironment env;
+
+	if(m_iparm[59]) {
+
+		if(memoryBudget() > 0)
+			env.set("MKL_PARDISO_OOC_MAX_CORE_SIZE", std::to_string(memoryBudget()));
+
+		if(!scratchPath().empty())
+			env.set("MKL_PARDISO_OOC_PATH", scratchPath());
+
+	} // ooc
+
 	int_t error = mkl::pardisoDriver(
     m_pt,
     m_maxfct,
-    1,
+    m_mnum,
     static_cast<int_t>(m_mtype),
     static_cast<int_t>(phase),
     static_cast<int_t>(m_dim),
@@ -530,6 +899,30 @@ int_t PardisoBase<T_Matrix>::factorMemory() const
 }
 /*-------------------------------------------------*/
 template <typename T_Matrix>
+int_t PardisoBase<T_Matrix>::inCoreMemory() const
+{
+	return std::max(m_iparm[14], m_iparm[15] + m_iparm[16]);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+int_t PardisoBase<T_Matrix>::outOfCoreMemory() const
+{
+	return m_iparm[62];
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+bool PardisoBase<T_Matrix>::outOfCore() const
+{
+	return (m_iparm[59] == 2);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+long long int PardisoBase<T_Matrix>::outOfCoreVolume() const
+{
+	return m_oocVolume;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
 int_t PardisoBase<T_Matrix>::inertiaPositive() const
 {
 	return m_iparm[21];
@@ -22,6 +22,7 @@
  */
 
 #include <string>
+#include <vector>
 
 #include "cla3p/types.hpp"
 #include "cla3p/perms.hpp"
@@ -44,6 +45,7 @@ class PardisoBase :
 	public pardiso::GlobalParams,
 	public pardiso::AnalysisParams,
 	public pardiso::DecompParams,
+	public pardiso::OutOfCoreParams,
 	public pardiso::SolveParams {
 
 	private:
@@ -94,47 +96,153 @@ class PardisoBase :
 		/**
 		 * @brief Clears the solver numeric factor data.
 		 *
-		 * Clears memory allocated for the factor storage.
+		 * Clears memory allocated for the factor storage of all factor slots.
 		 */
 		void clearNumeric();
 
+		/**
+		 * @brief Sets the number of numerical factorizations.
+		 * @param[in] n The number of factor slots (n > 0).
+		 *
+		 * The solver can hold `n` numerical factorizations of matrices with the same sparsity pattern, 
+		 * indexed in [0, n). All slots share the fill-reducing ordering & symbolic decomposition.
+		 * Changing the number of slots releases all existing analysis & factor data.
+		 *
+		 * Set before analysis. Default value is 1.
+		 */
+		void setMaxFactors(int_t n);
+
+		/**
+		 * @brief The number of numerical factorizations.
+		 * @return The number of factor slots.
+		 */
+		int_t maxFactors() const;
+
 		/**
 		 * @brief Performs matrix analysis & symbolic decomposition.
 		 * @param[in] mat The matrix to be analyzed.
 		 *
 		 * Performs matrix analysis & symbolic decomposition.
 		 * Uses settings from the pardiso::GlobalParams & pardiso::AnalysisParams classes.
+		 *
+		 * Analysis is always recomputed, use it after changing analysis settings.
+		 * Matrices with the sparsity pattern of the analyzed matrix can be passed directly to decompose().
 		 */
 		void analysis(const T_Matrix& mat);
 
 		/**
 		 * @brief Performs matrix decomposition.
 		 * @param[in] mat The matrix to be decomposed.
+		 * @param[in] slot The factor slot that receives the decomposition, in [0, maxFactors()).
 		 *
 		 * Performs matrix numerical decomposition.
-		 * Uses settings from the pardiso::GlobalParams & pardiso::DecompParams classes.
+		 * Uses settings from the pardiso::GlobalParams, pardiso::DecompParams & pardiso::OutOfCoreParams classes.
+		 *
+		 * The symbolic decomposition is reused if `mat` has the same dimensions, property & sparsity pattern 
+		 * as the analyzed matrix (it does not need to be the same object).
+		 * Otherwise, or if no analysis is performed, analysis is performed automatically 
+		 * and the factors of all other slots are discarded.
+		 */
+		void decompose(const T_Matrix& mat, int_t slot = 0);
+
+		/**
+		 * @brief Performs matrix decomposition with new values.
+		 * @param[in] values The new matrix values.
+		 * @param[in] slot The factor slot that receives the decomposition, in [0, maxFactors()).
+		 *
+		 * Performs matrix numerical decomposition of the most recently analyzed pattern, 
+		 * using `values` as matrix values. 
+		 * The array `values` must follow the storage order of that matrix (size nnz) 
+		 * and remain valid while the slot is used in solve().
+		 * The sparsity pattern is kept by the solver since the analysis phase, 
+		 * the analyzed matrix does not need to remain valid.
 		 */
-		void decompose(const T_Matrix& mat);
+		void refactorize(const T_Scalar *values, int_t slot = 0);
 
 		/**
 		 * @brief Performs matrix solution.
 		 * @param[in] rhs The right hand side matrix.
 		 * @param[out] sol The matrix containing with the solution.
+		 * @param[in] slot The factor slot used for the solution, in [0, maxFactors()).
 		 *
 		 * Calculates the solution `sol` using the decomposed matrix.
 		 * Uses settings from the pardiso::GlobalParams & pardiso::SolveParams classes.
 		 */
-		void solve(const dns::XxMatrix<T_Scalar>& rhs, dns::XxMatrix<T_Scalar>& sol);
+		void solve(const dns::XxMatrix<T_Scalar>& rhs, dns::XxMatrix<T_Scalar>& sol, int_t slot = 0);
 
 		/**
 		 * @brief Performs vector solution.
 		 * @param[in] rhs The right hand side vector.
 		 * @param[out] sol The vector containing with the solution.
+		 * @param[in] slot The factor slot used for the solution, in [0, maxFactors()).
 		 *
 		 * Calculates the solution `sol` using the decomposed matrix.
 		 * Uses settings from the pardiso::GlobalParams & pardiso::SolveParams classes.
 		 */
-		void solve(const dns::XxVector<T_Scalar>& rhs, dns::XxVector<T_Scalar>& sol);
+		void solve(const dns::XxVector<T_Scalar>& rhs, dns::XxVector<T_Scalar>& sol, int_t slot = 0);
+
+		/**
+		 * @brief Performs sparse matrix solution.
+		 * @param[in] rhs The (general) sparse right hand side matrix.
+		 * @param[out] sol The matrix containing with the solution.
+		 * @param[in] slot The factor slot used for the solution, in [0, maxFactors()).
+		 *
+		 * Calculates the solution `sol` using the decomposed matrix.
+		 * Uses settings from the pardiso::GlobalParams & pardiso::SolveParams classes. @n
+		 * Combined with a partial solution index set (see setPartialSolve()) that contains the non zero rows of `rhs`, 
+		 * Pardiso exploits the sparsity of the right hand sides and/or computes only the selected solution components.
+		 * With a sparse right hand side partial solution mode, non zeros outside the index set are rejected.
+		 */
+		void solve(const T_Matrix& rhs, dns::XxMatrix<T_Scalar>& sol, int_t slot = 0);
+
+		/**
+		 * @brief Performs the forward substitution of the matrix solution.
+		 * @param[in] rhs The right hand side matrix.
+		 * @param[out] sol The matrix containing the result of the forward substitution.
+		 * @param[in] slot The factor slot used for the solution, in [0, maxFactors()).
+		 *
+		 * Performs the first half of solve(), without iterative refinement.
+		 * The forward & backward substitutions (with the diagonal solution in between for LDLt decompositions)
+		 * applied in sequence yield the result of solve(). @n
+		 * With a Schur complement set, the entries of `sol` at the Schur indices contain the 
+		 * right hand side of the reduced (Schur complement) system.
+		 */
+		void forwardSolve(const dns::XxMatrix<T_Scalar>& rhs, dns::XxMatrix<T_Scalar>& sol, int_t slot = 0);
+
+		/**
+		 * @copydoc forwardSolve(const dns::XxMatrix<T_Scalar>&, dns::XxMatrix<T_Scalar>&, int_t)
+		 */
+		void forwardSolve(const dns::XxVector<T_Scalar>& rhs, dns::XxVector<T_Scalar>& sol, int_t slot = 0);
+
+		/**
+		 * @brief Performs the backward substitution of the matrix solution.
+		 * @param[in] rhs The right hand side matrix.
+		 * @param[out] sol The matrix containing the result of the backward substitution.
+		 * @param[in] slot The factor slot used for the solution, in [0, maxFactors()).
+		 *
+		 * Performs the last half of solve(), without iterative refinement. @n
+		 * With a Schur complement set, the entries of `rhs` at the Schur indices must contain 
+		 * the solution of the reduced (Schur complement) system.
+		 */
+		void backwardSolve(const dns::XxMatrix<T_Scalar>& rhs, dns::XxMatrix<T_Scalar>& sol, int_t slot = 0);
+
+		/**
+		 * @copydoc backwardSolve(const dns::XxMatrix<T_Scalar>&, dns::XxMatrix<T_Scalar>&, int_t)
+		 */
+		void backwardSolve(const dns::XxVector<T_Scalar>& rhs, dns::XxVector<T_Scalar>& sol, int_t slot = 0);
+
+		/**
+		 * @brief The Schur complement matrix.
+		 * @param[in] slot The factor slot, in [0, maxFactors()).
+		 * @return The dense Schur complement of the decomposed matrix.
+		 *
+		 * Returns S = A<sub>SS</sub> - A<sub>SI</sub> A<sub>II</sub><sup>-1</sup> A<sub>IS</sub>, 
+		 * where S is the index set passed to setSchurComplement() in ascending order and I the remaining indices.
+		 * The full matrix is stored for all matrix properties.
+		 *
+		 * Available after decomposition.
+		 */
+		dns::XxMatrix<T_Scalar> schurComplement(int_t slot = 0) const;
 
 		/**
 		 * @brief Message level information.
@@ -152,6 +260,7 @@ class PardisoBase :
 		 * You can access the fill-reducing ordering calculated in the analysis phase.
 		 * Useful for testing reordering algorithms, adapting the code to special applications problems, 
 		 * or for using the permutation vector more than once for matrices with identical sparsity structures.
+		 * Not available with a Schur complement set.
 		 *
 		 * Set before analysis.
 		 */
@@ -210,10 +319,49 @@ class PardisoBase :
 		 */
 		int_t factorMemory() const;
 
+		/**
+		 * @brief In-core memory estimate.
+		 * @return The memory (Kb) needed for in-core decomposition and solution.
+		 *
+		 * The maximum of peakAnalysisMemory() and permanentAnalysisMemory() + factorMemory(), 
+		 * used for the automatic factor storage selection.
+		 *
+		 * Available after analysis.
+		 */
+		int_t inCoreMemory() const;
+
+		/**
+		 * @brief Minimum out-of-core memory.
+		 * @return The minimum memory (Kb) needed for out-of-core decomposition and solution.
+		 *
+		 * Available after analysis.
+		 */
+		int_t outOfCoreMemory() const;
+
+		/**
+		 * @brief Out-of-core factor storage.
+		 * @return Whether the factors of the most recent decomposition are stored on disk.
+		 *
+		 * Available after decomposition.
+		 */
+		bool outOfCore() const;
+
+		/**
+		 * @brief Out-of-core I/O volume estimate.
+		 * @return The estimated disk traffic (Kb) since the last analysis.
+		 *
+		 * Pardiso does not report disk traffic, the estimate assumes that the factors (factorMemory()) are
+		 * written once in each out-of-core decomposition and read once in each substitution sweep of the solution phases.
+		 */
+		long long int outOfCoreVolume() const;
+
 	protected:
 		int_t inertiaPositive() const;
 		int_t inertiaNegative() const;
 
+		void diagonalSolve(const dns::XxMatrix<T_Scalar>& rhs, dns::XxMatrix<T_Scalar>& sol, int_t slot);
+		void diagonalSolve(const dns::XxVector<T_Scalar>& rhs, dns::XxVector<T_Scalar>& sol, int_t slot);
+
 	private:
 		static constexpr std::size_t PT_DIM = 64;
 		static constexpr std::size_t IPARM_DIM = 64;
@@ -223,12 +371,22 @@ class PardisoBase :
 
 		mtype_t m_mtype;
 		int_t m_maxfct;
+		int_t m_mnum;
 		int_t m_msglvl;	
 
 		int_t m_dim;
+		int_t m_nnz;
 		const int_t *m_colptr;
 		const int_t *m_rowidx;
 		const T_Scalar *m_values;
+		bool m_analyzed;
+		std::vector<int_t> m_colptrAnalyzed;
+		std::vector<int_t> m_rowidxAnalyzed;
+		std::vector<const T_Scalar*> m_factorValues;
+		std::vector<std::vector<T_Scalar>> m_schurValues;
+		int_t m_schurDim;
+		long long int m_oocVolume;
+		std::vector<char> m_partialMask;
 		prm::PiMatrix m_permBuffer;
 		prm::PiMatrix m_permMatrix;
 
@@ -244,9 +402,17 @@ class PardisoBase :
 
 		mtype_t deduceMtype(const T_Matrix&);
 		void updateMatrixInfo(const T_Matrix&);
+		bool analysisReusable(const T_Matrix&);
+		void checkSlot(int_t slot) const;
+		void selectFactor(int_t slot);
+		void discardFactors();
+		void factorize(int_t slot);
+		void solveDriver(phase_t, const dns::XxMatrix<T_Scalar>&, dns::XxMatrix<T_Scalar>&, int_t slot);
+		void solveDriver(phase_t, const dns::XxVector<T_Scalar>&, dns::XxVector<T_Scalar>&, int_t slot);
 
 		void updateIparmAnalysis();
 		void updateIparmDecomposition();
+		void updateFactorStorage();
 		void updateIparmSolve();
 
 		void resizePerm(int_t size);
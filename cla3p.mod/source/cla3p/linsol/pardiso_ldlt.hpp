@@ -141,6 +141,30 @@ class PardisoLDLt : public PardisoBase<T_Matrix> {
 		{
 			return PardisoBase<T_Matrix>::inertiaNegative();
 		}
+
+		/**
+		 * @brief Performs the diagonal solution of the matrix solution.
+		 * @param[in] rhs The right hand side matrix.
+		 * @param[out] sol The matrix containing the result of the diagonal solution.
+		 * @param[in] slot The factor slot used for the solution, in [0, maxFactors()).
+		 *
+		 * Applies the inverse of the (block) diagonal factor, 
+		 * between forwardSolve() and backwardSolve().
+		 */
+		void diagonalSolve(const dns::XxMatrix<typename T_Matrix::value_type>& rhs, 
+				dns::XxMatrix<typename T_Matrix::value_type>& sol, int_t slot = 0)
+		{
+			PardisoBase<T_Matrix>::diagonalSolve(rhs, sol, slot);
+		}
+
+		/**
+		 * @copydoc diagonalSolve(const dns::XxMatrix<typename T_Matrix::value_type>&, dns::XxMatrix<typename T_Matrix::value_type>&, int_t)
+		 */
+		void diagonalSolve(const dns::XxVector<typename T_Matrix::value_type>& rhs, 
+				dns::XxVector<typename T_Matrix::value_type>& sol, int_t slot = 0)
+		{
+			PardisoBase<T_Matrix>::diagonalSolve(rhs, sol, slot);
+		}
 };
 
 /*-------------------------------------------------*/
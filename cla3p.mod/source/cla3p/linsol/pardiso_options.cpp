@@ -22,6 +22,7 @@
 // 3rd
 
 // cla3p
+#include "cla3p/error/exceptions.hpp"
 
 /*-------------------------------------------------*/
 namespace cla3p {
@@ -43,15 +44,12 @@ ImmutableParams<T_Scalar>::ImmutableParams()
 	m_iparm23 =   0;
 	m_iparm24 =   0;
 	m_iparm27 = i27;
-	m_iparm30 =   0;
 	m_iparm33 =   0;
 	m_iparm34 =   1;
-	m_iparm35 =   0;
 	m_iparm36 =   0;
 	m_iparm38 =   0;
 	m_iparm42 =   0;
 	m_iparm55 =   0;
-	m_iparm59 =   0;
 }
 /*-------------------------------------------------*/
 template <typename T_Scalar>
@@ -66,15 +64,12 @@ void ImmutableParams<T_Scalar>::setToIparm(int_t *iparm) const
 	iparm[23] = m_iparm23;
 	iparm[24] = m_iparm24;
 	iparm[27] = m_iparm27;
-	iparm[30] = m_iparm30;
 	iparm[33] = m_iparm33;
 	iparm[34] = m_iparm34;
-	iparm[35] = m_iparm35;
 	iparm[36] = m_iparm36;
 	iparm[38] = m_iparm38;
 	iparm[42] = m_iparm42;
 	iparm[55] = m_iparm55;
-	iparm[59] = m_iparm59;
 }
 /*-------------------------------------------------*/
 template class ImmutableParams<real_t>;
@@ -132,11 +127,14 @@ void AnalysisParams::defaults()
 	m_iparm04 = perm_t::DefaultPerm;
 	m_iparm10 = pardiso::Undefined();
 	m_iparm12 = pardiso::Undefined();
+	m_iparm30 = 0;
+	m_iparm35 = 0;
 }
 /*-------------------------------------------------*/
 void AnalysisParams::clear()
 {
 	m_permMatrix.clear();
+	m_maskIndices.clear();
 	defaults();
 }
 /*-------------------------------------------------*/
@@ -146,6 +144,8 @@ void AnalysisParams::setToIparm(int_t *iparm) const
 	iparm[ 4] = static_cast<int_t>(m_iparm04);
 	iparm[10] = m_iparm10;
 	iparm[12] = m_iparm12;
+	iparm[30] = m_iparm30;
+	iparm[35] = m_iparm35;
 }
 /*-------------------------------------------------*/
 bool AnalysisParams::userDefinedPermutation() const
@@ -165,6 +165,35 @@ void AnalysisParams::setFillReducer(const prm::PiMatrix& permMatrix)
 
 	m_permMatrix = permMatrix;
 	m_iparm04 = perm_t::UserSuppliedPerm;
+	m_iparm30 = 0;
+	m_iparm35 = 0;
+	m_maskIndices.clear();
+}
+/*-------------------------------------------------*/
+void AnalysisParams::setIndexMask(const std::vector<int_t>& indices, int_t iparm30, int_t iparm35)
+{
+	m_permMatrix.clear();
+	m_maskIndices = indices;
+
+	if(m_maskIndices.empty()) {
+		m_iparm04 = perm_t::DefaultPerm;
+		m_iparm30 = 0;
+		m_iparm35 = 0;
+	} else {
+		m_iparm04 = perm_t::IndexMask;
+		m_iparm30 = iparm30;
+		m_iparm35 = iparm35;
+	} // empty
+}
+/*-------------------------------------------------*/
+void AnalysisParams::setSchurComplement(const std::vector<int_t>& indices)
+{
+	setIndexMask(indices, 0, 2); // Schur complement & partial factorization
+}
+/*-------------------------------------------------*/
+void AnalysisParams::setPartialSolve(const std::vector<int_t>& indices, pardiso::partial_t mode)
+{
+	setIndexMask(indices, static_cast<int_t>(mode), 0);
 }
 /*-------------------------------------------------*/
 void AnalysisParams::setScaling(bool flg)
@@ -182,6 +211,21 @@ const prm::PiMatrix& AnalysisParams::userPermMatrix() const
 	return m_permMatrix;
 }
 /*-------------------------------------------------*/
+bool AnalysisParams::schurComplementMode() const
+{
+	return (m_iparm35 != 0);
+}
+/*-------------------------------------------------*/
+bool AnalysisParams::partialSolveMode() const
+{
+	return (m_iparm30 != 0);
+}
+/*-------------------------------------------------*/
+const std::vector<int_t>& AnalysisParams::maskIndices() const
+{
+	return m_maskIndices;
+}
+/*-------------------------------------------------*/
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
 DecompParams::DecompParams()
@@ -223,6 +267,63 @@ void DecompParams::setPivotingPerturbation(int_t p)
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
+OutOfCoreParams::OutOfCoreParams()
+{
+	defaults();
+}
+/*-------------------------------------------------*/
+OutOfCoreParams::~OutOfCoreParams()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+void OutOfCoreParams::defaults()
+{
+	m_iparm59 = pardiso::ooc_t::InCore;
+	m_budget = 0;
+}
+/*-------------------------------------------------*/
+void OutOfCoreParams::clear()
+{
+	m_path.clear();
+	defaults();
+}
+/*-------------------------------------------------*/
+void OutOfCoreParams::setFactorStorage(pardiso::ooc_t mode)
+{
+	m_iparm59 = mode;
+}
+/*-------------------------------------------------*/
+void OutOfCoreParams::setMemoryBudget(int_t megabytes)
+{
+	if(megabytes < 0)
+		throw err::InvalidOp("Memory budget must be non negative");
+
+	m_budget = megabytes;
+}
+/*-------------------------------------------------*/
+void OutOfCoreParams::setScratchPath(const std::string& prefix)
+{
+	m_path = prefix;
+}
+/*-------------------------------------------------*/
+pardiso::ooc_t OutOfCoreParams::factorStorage() const
+{
+	return m_iparm59;
+}
+/*-------------------------------------------------*/
+int_t OutOfCoreParams::memoryBudget() const
+{
+	return m_budget;
+}
+/*-------------------------------------------------*/
+const std::string& OutOfCoreParams::scratchPath() const
+{
+	return m_path;
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
 SolveParams::SolveParams()
 {
 	defaults();
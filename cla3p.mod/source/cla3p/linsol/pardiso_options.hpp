@@ -21,6 +21,9 @@
  * @file
  */
 
+#include <string>
+#include <vector>
+
 #include "cla3p/types.hpp"
 #include "cla3p/perms.hpp"
 
@@ -56,6 +59,28 @@ enum class pivot_t : int_t {
 	BunchKaufmanNoRefinement = 3, /**< 1x1 and 2x2 Bunch-Kaufman pivoting (no auto-refinement) */
 };
 
+/**
+ * @ingroup cla3p_module_index_special_enums
+ * @enum partial_t
+ * @brief The partial solution mode.
+ */
+enum class partial_t : int_t {
+	SparseRhsSelectedSolution = 1, /**< Right hand sides are non zero & solution is computed only at the selected indices */
+	SparseRhs                 = 2, /**< Right hand sides are non zero only at the selected indices, full solution is computed */
+	SelectedSolution          = 3  /**< Dense right hand sides, solution is computed only at the selected indices */
+};
+
+/**
+ * @ingroup cla3p_module_index_special_enums
+ * @enum ooc_t
+ * @brief The factor storage mode.
+ */
+enum class ooc_t : int_t {
+	InCore    = 0, /**< Factors are stored in memory */
+	Auto      = 1, /**< Factors are stored on disk if the in-core memory estimate exceeds the memory budget */
+	OutOfCore = 2  /**< Factors are stored on disk */
+};
+
 /*-------------------------------------------------*/
 
 template <typename T_Scalar>
@@ -77,15 +102,12 @@ class ImmutableParams {
 		int_t m_iparm23; // Parallel factorization control
 		int_t m_iparm24; // Parallel forward/backward solve control
 		int_t m_iparm27; // Single or double precision Intel(R) oneAPI Math Kernel Library
-		int_t m_iparm30; // Partial solve and computing selected components of the solution vectors
 		int_t m_iparm33; // Optimal number of OpenMP threads for conditional numerical reproducibility (CNR) mode
 		int_t m_iparm34; // One- or zero-based indexing of columns and rows
-		int_t m_iparm35; // Schur complement matrix computation control
 		int_t m_iparm36; // Format for matrix storage (CSR)
 		int_t m_iparm38; // Enable low rank update
 		int_t m_iparm42; // Control parameter for the computation of the diagonal of inverse matrix
 		int_t m_iparm55; // Diagonal and pivoting control
-		int_t m_iparm59; // Intel(R) oneAPI Math Kernel Library (oneMKL) PARDISO mode
 };
 
 /*-------------------------------------------------*/
@@ -132,6 +154,7 @@ class AnalysisParams {
 	private:
 
 		enum class perm_t : int_t {
+			IndexMask        =  0,
 			UserSuppliedPerm =  1,
 			DefaultPerm      =  2
 		};
@@ -157,6 +180,37 @@ class AnalysisParams {
 		 */
 		void setFillReducer(const prm::PiMatrix& permMatrix);
 
+		/**
+		 * @brief Sets the Schur complement index set.
+		 * @param[in] indices The row/column indices of the Schur complement block.
+		 *
+		 * Pardiso orders the selected indices last and computes their dense Schur complement
+		 * as part of the decomposition, along with a partial factorization that can be used
+		 * with the forward/backward solve phases.
+		 * Cannot be combined with a user supplied fill-reducing permutation or partial solutions, the most recent setting is used.
+		 * An empty index set disables the Schur complement computation.
+		 *
+		 * Set before analysis.
+		 */
+		void setSchurComplement(const std::vector<int_t>& indices);
+
+		/**
+		 * @brief Sets the index set for partial solutions.
+		 * @param[in] indices The selected row indices.
+		 * @param[in] mode The partial solution mode.
+		 *
+		 * Pardiso exploits the sparsity of the right hand sides and/or computes only the selected solution components, 
+		 * which is much cheaper than a full solution when the index set is small. 
+		 * Right hand side entries outside the index set are assumed zero in sparse right hand side modes 
+		 * and solution entries outside the index set are not computed in selected solution modes.
+		 * Cannot be combined with a user supplied fill-reducing permutation or a Schur complement, the most recent setting is used.
+		 * An empty index set disables partial solutions.
+		 *
+		 * Set before analysis.
+		 */
+		void setPartialSolve(const std::vector<int_t>& indices, 
+				pardiso::partial_t mode = pardiso::partial_t::SparseRhsSelectedSolution);
+
 	protected:
 		AnalysisParams();
 		~AnalysisParams();
@@ -171,15 +225,23 @@ class AnalysisParams {
 		bool userDefinedPermutation() const;
 		const prm::PiMatrix& userPermMatrix() const;
 
+		bool schurComplementMode() const;
+		bool partialSolveMode() const;
+		const std::vector<int_t>& maskIndices() const;
+
 	private:
 		pardiso::reorder_t m_iparm01; // Fill-in reducing ordering for the input matrix
 		perm_t             m_iparm04; // User permutation
 		int_t              m_iparm10; // Scaling vectors
 		int_t              m_iparm12; // Improved accuracy using (non-) symmetric weighted matching
+		int_t              m_iparm30; // Partial solve and computing selected components of the solution vectors
+		int_t              m_iparm35; // Schur complement matrix computation control
 
 		prm::PiMatrix m_permMatrix;
+		std::vector<int_t> m_maskIndices;
 
 		void defaults();
+		void setIndexMask(const std::vector<int_t>& indices, int_t iparm30, int_t iparm35);
 };
 
 /*-------------------------------------------------*/
@@ -210,6 +272,71 @@ class DecompParams {
 
 /*-------------------------------------------------*/
 
+/**
+ * @nosubgrouping
+ * @brief The Pardiso out-of-core parameters.
+ *
+ * Pardiso reads the memory budget & scratch path from the process environment. @n
+ * They are set only while an out-of-core solver calls Pardiso and the previous values are restored afterwards. @n
+ * The process environment is shared and not thread safe, 
+ * concurrent out-of-core solvers (or other threads accessing the environment) are not supported.
+ */
+class OutOfCoreParams {
+
+	public:
+
+		/**
+		 * @brief Sets the factor storage mode.
+		 * @param[in] mode The factor storage mode.
+		 *
+		 * With pardiso::ooc_t::Auto, the in-core memory estimate of the analysis phase is compared
+		 * with the memory budget before each decomposition, and the factors are stored on disk only if the estimate exceeds it.
+		 *
+		 * Set before decomposition. Default value is pardiso::ooc_t::InCore.
+		 */
+		void setFactorStorage(pardiso::ooc_t mode);
+
+		/**
+		 * @brief Sets the memory budget.
+		 * @param[in] megabytes The maximum memory (Mb) Pardiso can use for the factors, 0 for unlimited.
+		 *
+		 * Used for the automatic storage selection and as the in-core memory limit in out-of-core mode.
+		 *
+		 * Set before decomposition. Default value is 0.
+		 */
+		void setMemoryBudget(int_t megabytes);
+
+		/**
+		 * @brief Sets the out-of-core scratch files location.
+		 * @param[in] prefix The path & name prefix of the scratch files (e.g. /local/scratch/pardiso_ooc).
+		 *
+		 * Prefer a fast local disk. Pardiso uses the current directory if not set.
+		 * The setting is passed to Pardiso through the process environment.
+		 *
+		 * Set before decomposition.
+		 */
+		void setScratchPath(const std::string& prefix);
+
+	protected:
+		OutOfCoreParams();
+		~OutOfCoreParams();
+
+		void clear();
+
+		pardiso::ooc_t factorStorage() const;
+		int_t memoryBudget() const;
+		const std::string& scratchPath() const;
+
+	private:
+		pardiso::ooc_t m_iparm59; // Intel(R) oneAPI Math Kernel Library (oneMKL) PARDISO mode
+		int_t          m_budget;  // MKL_PARDISO_OOC_MAX_CORE_SIZE
+		std::string    m_path;    // MKL_PARDISO_OOC_PATH
+
+		void defaults();
+};
+
+/*-------------------------------------------------*/
+
 /**
  * @nosubgrouping
  * @brief The Pardiso solution phase parameters.
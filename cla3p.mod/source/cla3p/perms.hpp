@@ -18,6 +18,7 @@
 #define CLA3P_PERMS_HPP_
 
 #include "cla3p/perms/pxmatrix.hpp"
+#include "cla3p/perms/orderings.hpp"
 
 namespace cla3p {
 namespace prm {
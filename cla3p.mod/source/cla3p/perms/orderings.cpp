@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/perms/orderings.hpp"
+
+// system
+
+// 3rd
+
+// cla3p
+#include "cla3p/sparse/csc_xxmatrix.hpp"
+#include "cla3p/bulk/csc_order.hpp"
+#include "cla3p/checks/basic_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace prm {
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+PxMatrix<T_Int> reverseCuthillMcKee(const csc::XxMatrix<T_Int,T_Scalar>& A)
+{
+	square_check(A.nrows(), A.ncols());
+
+	PxMatrix<T_Int> ret(A.ncols());
+	blk::csc::order_rcm(A.ncols(), A.colptr(), A.rowidx(), ret.values());
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+PxMatrix<T_Int> approximateMinimumDegree(const csc::XxMatrix<T_Int,T_Scalar>& A)
+{
+	square_check(A.nrows(), A.ncols());
+
+	PxMatrix<T_Int> ret(A.ncols());
+	blk::csc::order_amd(A.ncols(), A.colptr(), A.rowidx(), ret.values());
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+PxMatrix<T_Int> nestedDissection(const csc::XxMatrix<T_Int,T_Scalar>& A)
+{
+	square_check(A.nrows(), A.ncols());
+
+	PxMatrix<T_Int> ret(A.ncols());
+	blk::csc::order_nd(A.ncols(), A.colptr(), A.rowidx(), ret.values());
+
+	return ret;
+}
+/*-------------------------------------------------*/
+#define instantiate_orderings(T_Int, T_Scl) \
+template PxMatrix<T_Int> reverseCuthillMcKee(const csc::XxMatrix<T_Int,T_Scl>&); \
+template PxMatrix<T_Int> approximateMinimumDegree(const csc::XxMatrix<T_Int,T_Scl>&); \
+template PxMatrix<T_Int> nestedDissection(const csc::XxMatrix<T_Int,T_Scl>&)
+instantiate_orderings(int_t, real_t);
+instantiate_orderings(int_t, real4_t);
+instantiate_orderings(int_t, complex_t);
+instantiate_orderings(int_t, complex8_t);
+#undef instantiate_orderings
+/*-------------------------------------------------*/
+} // namespace prm
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_PERMS_ORDERINGS_HPP_
+#define CLA3P_PERMS_ORDERINGS_HPP_
+
+/** 
+ * @file
+ */
+
+#include "cla3p/perms/pxmatrix.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+/*-------------------------------------------------*/
+
+namespace csc { template <typename T_Int, typename T_Scalar> class XxMatrix; }
+
+/*-------------------------------------------------*/
+namespace prm {
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup cla3p_module_index_matrices_perm
+ * @brief Creates a Reverse Cuthill-McKee ordering.
+ * @details Reduces the bandwidth of A, which improves the locality of matrix-vector products.@n
+ *          The ordering is computed on the pattern of <b>A + A^T</b>, diagonal entries are ignored.
+ * @param[in] A The input square matrix.
+ * @return The permutation matrix P, suitable for A.permuteMirror(P).
+ */
+template <typename T_Int, typename T_Scalar>
+PxMatrix<T_Int> reverseCuthillMcKee(const csc::XxMatrix<T_Int,T_Scalar>& A);
+
+/**
+ * @ingroup cla3p_module_index_matrices_perm
+ * @brief Creates an approximate minimum degree ordering.
+ * @details Reduces the fill-in of sparse factorizations of A.@n
+ *          The ordering is computed on the pattern of <b>A + A^T</b>, diagonal entries are ignored.
+ * @param[in] A The input square matrix.
+ * @return The permutation matrix P, suitable for A.permuteMirror(P).
+ */
+template <typename T_Int, typename T_Scalar>
+PxMatrix<T_Int> approximateMinimumDegree(const csc::XxMatrix<T_Int,T_Scalar>& A);
+
+/**
+ * @ingroup cla3p_module_index_matrices_perm
+ * @brief Creates a nested dissection ordering.
+ * @details Reduces the fill-in of sparse factorizations of large A.@n
+ *          The graph is recursively split using level structure separators, small subgraphs are ordered with minimum degree.
+ *          Independent subgraphs are ordered in parallel.@n
+ *          The ordering is computed on the pattern of <b>A + A^T</b>, diagonal entries are ignored.
+ * @param[in] A The input square matrix.
+ * @return The permutation matrix P, suitable for A.permuteMirror(P).
+ */
+template <typename T_Int, typename T_Scalar>
+PxMatrix<T_Int> nestedDissection(const csc::XxMatrix<T_Int,T_Scalar>& A);
+
+/*-------------------------------------------------*/
+} // namespace prm
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_PERMS_ORDERINGS_HPP_
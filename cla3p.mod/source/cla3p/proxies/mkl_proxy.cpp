@@ -130,6 +130,32 @@ omatadd_macro(void, complex_t , z)
 omatadd_macro(void, complex8_t, c)
 #undef omatadd_macro
 /*-------------------------------------------------*/
+#define getrf_batch_strided_macro(typeout, typein, prefix) \
+typeout getrf_batch_strided(int_t m, int_t n, typein *a, int_t lda, int_t stridea, \
+		int_t *ipiv, int_t strideipiv, int_t batchSize, int_t *info) \
+{ \
+	prefix##getrf_batch_strided(&m, &n, a, &lda, &stridea, ipiv, &strideipiv, &batchSize, info); \
+}
+getrf_batch_strided_macro(void, real_t    , d)
+getrf_batch_strided_macro(void, real4_t   , s)
+getrf_batch_strided_macro(void, complex_t , z)
+getrf_batch_strided_macro(void, complex8_t, c)
+#undef getrf_batch_strided_macro
+/*-------------------------------------------------*/
+#define getrs_batch_strided_macro(typeout, typein, prefix) \
+typeout getrs_batch_strided(char trans, int_t n, int_t nrhs, \
+		const typein *a, int_t lda, int_t stridea, \
+		const int_t *ipiv, int_t strideipiv, \
+		typein *b, int_t ldb, int_t strideb, int_t batchSize, int_t *info) \
+{ \
+	prefix##getrs_batch_strided(&trans, &n, &nrhs, a, &lda, &stridea, ipiv, &strideipiv, b, &ldb, &strideb, &batchSize, info); \
+}
+getrs_batch_strided_macro(void, real_t    , d)
+getrs_batch_strided_macro(void, real4_t   , s)
+getrs_batch_strided_macro(void, complex_t , z)
+getrs_batch_strided_macro(void, complex8_t, c)
+#undef getrs_batch_strided_macro
+/*-------------------------------------------------*/
 } // namespace mkl
 } // namespace cla3p
 /*-------------------------------------------------*/
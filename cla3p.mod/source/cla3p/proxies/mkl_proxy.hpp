@@ -78,6 +78,26 @@ omatadd_macro(void, complex_t);
 omatadd_macro(void, complex8_t);
 #undef omatadd_macro
 
+#define getrf_batch_strided_macro(typeout, typein) \
+typeout getrf_batch_strided(int_t m, int_t n, typein *a, int_t lda, int_t stridea, \
+		int_t *ipiv, int_t strideipiv, int_t batchSize, int_t *info)
+getrf_batch_strided_macro(void, real_t);
+getrf_batch_strided_macro(void, real4_t);
+getrf_batch_strided_macro(void, complex_t);
+getrf_batch_strided_macro(void, complex8_t);
+#undef getrf_batch_strided_macro
+
+#define getrs_batch_strided_macro(typeout, typein) \
+typeout getrs_batch_strided(char trans, int_t n, int_t nrhs, \
+		const typein *a, int_t lda, int_t stridea, \
+		const int_t *ipiv, int_t strideipiv, \
+		typein *b, int_t ldb, int_t strideb, int_t batchSize, int_t *info)
+getrs_batch_strided_macro(void, real_t);
+getrs_batch_strided_macro(void, real4_t);
+getrs_batch_strided_macro(void, complex_t);
+getrs_batch_strided_macro(void, complex8_t);
+#undef getrs_batch_strided_macro
+
 /*-------------------------------------------------*/
 } // namespace mkl
 } // namespace cla3p
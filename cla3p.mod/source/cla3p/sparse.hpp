@@ -19,6 +19,13 @@
 
 #include "cla3p/sparse/csc_xxmatrix.hpp"
 #include "cla3p/sparse/coo_xxmatrix.hpp"
+#include "cla3p/sparse/csc_level_schedule.hpp"
+#include "cla3p/sparse/csc_compact_view.hpp"
+#include "cla3p/sparse/csc_column_view.hpp"
+#include "cla3p/sparse/csc_dynamic_matrix.hpp"
+#include "cla3p/sparse/csc_random_pattern.hpp"
+#include "cla3p/sparse/csc_reduced_matrix.hpp"
+#include "cla3p/sparse/csc_pattern_matrix.hpp"
 
 namespace cla3p {
 namespace csc {
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/sparse/csc_column_view.hpp"
+
+// system
+
+// 3rd
+
+// cla3p
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace csc {
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+ColumnView<T_Int,T_Scalar>::ColumnView()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+ColumnView<T_Int,T_Scalar>::ColumnView(const XxMatrix<T_Int,T_Scalar>& A, int_t jbgn, int_t nj)
+{
+	if(A.empty()) {
+		throw err::InvalidOp(msg::EmptyObject());
+	}
+
+	if(jbgn < 0 || nj < 0 || jbgn + nj > A.ncols()) {
+		throw err::OutOfBounds("Column range exceeds matrix dimensions");
+	}
+
+	bool full = (jbgn == 0 && nj == A.ncols());
+
+	if(!full && !A.prop().isGeneral() && !A.prop().isTriangular()) {
+		throw err::InvalidOp(msg::InvalidProperty());
+	}
+
+	if(!nj) return;
+
+	Property pr = (full ? A.prop() : Property::General());
+
+	T_Int base = A.colptr()[jbgn];
+	const T_Int *cptr = A.colptr();
+
+	if(jbgn) {
+		m_colptr.resize(nj + 1);
+		for(int_t j = 0; j <= nj; j++) {
+			m_colptr[j] = A.colptr()[jbgn + j] - base;
+		} // j
+		cptr = m_colptr.data();
+	} // rebase
+
+	m_guard = XxMatrix<T_Int,T_Scalar>::view(A.nrows(), nj, cptr, A.rowidx() + base, A.values() + base, pr);
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+ColumnView<T_Int,T_Scalar>::~ColumnView()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void ColumnView<T_Int,T_Scalar>::clear()
+{
+	m_guard.clear();
+	m_colptr.clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+bool ColumnView<T_Int,T_Scalar>::empty() const
+{
+	return m_guard.get().empty();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+const XxMatrix<T_Int,T_Scalar>& ColumnView<T_Int,T_Scalar>::get() const
+{
+	return m_guard.get();
+}
+/*-------------------------------------------------*/
+template class ColumnView<int_t,real_t>;
+template class ColumnView<int_t,real4_t>;
+template class ColumnView<int_t,complex_t>;
+template class ColumnView<int_t,complex8_t>;
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_CSC_COLUMN_VIEW_HPP_
+#define CLA3P_CSC_COLUMN_VIEW_HPP_
+
+/**
+ * @file
+ */
+
+#include <vector>
+
+#include "cla3p/types.hpp"
+#include "cla3p/generic/guard.hpp"
+#include "cla3p/sparse/csc_xxmatrix.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace csc {
+/*-------------------------------------------------*/
+
+/**
+ * @nosubgrouping 
+ * @brief Zero-copy view of a contiguous range of full-height columns of a sparse matrix.
+ *
+ * References the row indices and values of columns [jbgn, jbgn + nj) without copying them. @n
+ * Only the (nj + 1) column pointers are rebased, ranges starting at column 0 are referenced without any copy. @n
+ * The referenced matrix must outlive the view.
+ */
+template <typename T_Int, typename T_Scalar>
+class ColumnView {
+
+	public:
+
+		/**
+		 * @name Constructors
+		 * @{
+		 */
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty view.
+		 */
+		ColumnView();
+
+		/**
+		 * @brief The column range constructor.
+		 *
+		 * Constructs a view of columns [jbgn, jbgn + nj) of A. @n
+		 * The view is General unless it covers all columns of A, in which case it inherits the property of A.
+		 *
+		 * @param[in] A A General or Triangular sparse matrix (any property if the range covers all columns).
+		 * @param[in] jbgn The column index that the range begins.
+		 * @param[in] nj The number of columns in the range.
+		 */
+		explicit ColumnView(const XxMatrix<T_Int,T_Scalar>& A, int_t jbgn, int_t nj);
+
+		ColumnView(const ColumnView&) = delete;
+		ColumnView& operator=(const ColumnView&) = delete;
+
+		/**
+		 * @brief Destroys the view.
+		 */
+		~ColumnView();
+
+		/** @} */
+
+		/** 
+		 * @name Public Member Functions
+		 * @{
+		 */
+
+		/**
+		 * @brief Clears the view.
+		 */
+		void clear();
+
+		/**
+		 * @brief Checks if the view is empty.
+		 */
+		bool empty() const;
+
+		/**
+		 * @brief The viewed columns as an immutable matrix.
+		 * @return A matrix with content reference to `A[:,jbgn:jbgn+nj]`.
+		 */
+		const XxMatrix<T_Int,T_Scalar>& get() const;
+
+		/** @} */
+
+	private:
+		std::vector<T_Int> m_colptr;
+		Guard<XxMatrix<T_Int,T_Scalar>> m_guard;
+};
+
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_CSC_COLUMN_VIEW_HPP_
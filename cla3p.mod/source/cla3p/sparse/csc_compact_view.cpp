@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/sparse/csc_compact_view.hpp"
+
+// system
+#include <limits>
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense/dns_xxvector.hpp"
+#include "cla3p/sparse/csc_xxmatrix.hpp"
+#include "cla3p/bulk/csc.hpp"
+#include "cla3p/bulk/csc_math.hpp"
+#include "cla3p/support/mt.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+#include "cla3p/checks/matrix_math_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace csc {
+/*-------------------------------------------------*/
+//
+// Direct access to indices that are already narrow (LP64 builds)
+//
+#if defined(CLA3P_I64)
+static const nint_t* narrow_alias(const int_t *) { return nullptr; }
+#else
+static const nint_t* narrow_alias(const nint_t *ptr) { return ptr; }
+#endif
+/*-------------------------------------------------*/
+static bool fits_narrow(int_t val)
+{
+	return (val <= static_cast<int_t>(std::numeric_limits<nint_t>::max()));
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+CompactView<T_Int,T_Scalar>::CompactView()
+{
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+CompactView<T_Int,T_Scalar>::CompactView(const XxMatrix<T_Int,T_Scalar>& A)
+{
+	defaults();
+
+	if(!A.prop().isGeneral() && !A.prop().isTriangular()) {
+		throw err::InvalidOp(msg::InvalidProperty());
+	}
+
+	m_nrows = A.nrows();
+	m_ncols = A.ncols();
+	m_colptr = A.colptr();
+	m_rowidx = A.rowidx();
+	m_values = A.values();
+
+	m_colptr32 = narrow_alias(m_colptr);
+	m_rowidx32 = narrow_alias(m_rowidx);
+
+	int_t nz = A.nnz();
+
+	if(!m_rowidx32 && fits_narrow(m_nrows)) {
+		m_rowidxBuffer.assign(m_rowidx, m_rowidx + nz);
+		m_rowidx32 = m_rowidxBuffer.data();
+	}
+
+	if(m_rowidx32 && !m_colptr32 && fits_narrow(nz)) {
+		m_colptrBuffer.assign(m_colptr, m_colptr + m_ncols + 1);
+		m_colptr32 = m_colptrBuffer.data();
+	}
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+CompactView<T_Int,T_Scalar>::~CompactView()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void CompactView<T_Int,T_Scalar>::defaults()
+{
+	m_nrows = 0;
+	m_ncols = 0;
+
+	m_colptr   = nullptr;
+	m_rowidx   = nullptr;
+	m_colptr32 = nullptr;
+	m_rowidx32 = nullptr;
+	m_values   = nullptr;
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void CompactView<T_Int,T_Scalar>::clear()
+{
+	m_colptrBuffer.clear();
+	m_rowidxBuffer.clear();
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+bool CompactView<T_Int,T_Scalar>::empty() const
+{
+	return (m_colptr == nullptr);
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+int_t CompactView<T_Int,T_Scalar>::nrows() const
+{
+	return m_nrows;
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+int_t CompactView<T_Int,T_Scalar>::ncols() const
+{
+	return m_ncols;
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+int_t CompactView<T_Int,T_Scalar>::nnz() const
+{
+	return (empty() ? 0 : m_colptr[m_ncols]);
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+std::size_t CompactView<T_Int,T_Scalar>::rowidxWidth() const
+{
+	return (m_rowidx32 ? sizeof(nint_t) : sizeof(T_Int));
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+std::size_t CompactView<T_Int,T_Scalar>::colptrWidth() const
+{
+	return (m_colptr32 ? sizeof(nint_t) : sizeof(T_Int));
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void CompactView<T_Int,T_Scalar>::mult(T_Scalar alpha, op_t opA, 
+		const dns::XxVector<T_Scalar>& X, T_Scalar beta, dns::XxVector<T_Scalar>& Y) const
+{
+	if(empty()) {
+		throw err::InvalidOp(msg::EmptyObject());
+	}
+
+	opA = (TypeTraits<T_Scalar>::is_real() && opA == op_t::C ? op_t::T : opA);
+
+	Operation _opA(opA);
+	mat_x_vec_mult_check(_opA, Property::General(), m_nrows, m_ncols, X.size(), Y.size());
+
+#if defined(CLA3P_INTEL_MKL) || defined(CLA3P_ARMPL)
+	//
+	// The native op N kernel is serial, threaded products use the library on the original indices
+	//
+	if(opA == op_t::N && nnz() >= blk::csc::MT_NNZ_THRESHOLD && mt::maxThreads() > 1) {
+		blk::csc::gem_x_vec(opA, m_nrows, m_ncols, alpha, m_colptr, m_rowidx, m_values, X.values(), beta, Y.values());
+		return;
+	}
+#endif
+
+	if(m_colptr32 && m_rowidx32) {
+		blk::csc::gem_x_vec_native(opA, m_nrows, m_ncols, alpha, m_colptr32, m_rowidx32, m_values, X.values(), beta, Y.values());
+	} else if(m_rowidx32) {
+		blk::csc::gem_x_vec_native(opA, m_nrows, m_ncols, alpha, m_colptr, m_rowidx32, m_values, X.values(), beta, Y.values());
+	} else {
+		blk::csc::gem_x_vec_native(opA, m_nrows, m_ncols, alpha, m_colptr, m_rowidx, m_values, X.values(), beta, Y.values());
+	}
+}
+/*-------------------------------------------------*/
+template class CompactView<int_t,real_t>;
+template class CompactView<int_t,real4_t>;
+template class CompactView<int_t,complex_t>;
+template class CompactView<int_t,complex8_t>;
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_CSC_COMPACT_VIEW_HPP_
+#define CLA3P_CSC_COMPACT_VIEW_HPP_
+
+/**
+ * @file
+ */
+
+#include <vector>
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+/*-------------------------------------------------*/
+
+namespace dns { template <typename T_Scalar> class XxVector; }
+
+/*-------------------------------------------------*/
+namespace csc {
+/*-------------------------------------------------*/
+
+template <typename T_Int, typename T_Scalar> class XxMatrix;
+
+/**
+ * @nosubgrouping 
+ * @brief Sparse matrix view with narrowed indices for bandwidth bound products.
+ *
+ * References the values of a sparse matrix and keeps its index arrays in the narrowest width the sizes permit. @n
+ * In ILP64 builds, row indices are narrowed to 32-bit when the number of rows allows it
+ * and column pointers are also narrowed when the number of non zeros allows it, 
+ * halving the index traffic of matrix-vector products. @n
+ * In LP64 builds indices are referenced without copies. @n
+ * Multithreaded products with op N are performed by the sparse library on the original indices, when one is available. @n
+ * The referenced matrix must outlive the view and keep its pattern unchanged, values can change.
+ */
+template <typename T_Int, typename T_Scalar>
+class CompactView {
+
+	public:
+
+		/**
+		 * @name Constructors
+		 * @{
+		 */
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty view.
+		 */
+		CompactView();
+
+		/**
+		 * @brief The matrix constructor.
+		 *
+		 * Constructs a view of A, narrowing its indices when the sizes permit.
+		 *
+		 * @param[in] A A General or Triangular sparse matrix.
+		 */
+		explicit CompactView(const XxMatrix<T_Int,T_Scalar>& A);
+
+		CompactView(const CompactView&) = delete;
+		CompactView& operator=(const CompactView&) = delete;
+
+		/**
+		 * @brief Destroys the view.
+		 */
+		~CompactView();
+
+		/** @} */
+
+		/** 
+		 * @name Arguments
+		 * @{
+		 */
+
+		/**
+		 * @brief The number of rows of the referenced matrix.
+		 */
+		int_t nrows() const;
+
+		/**
+		 * @brief The number of columns of the referenced matrix.
+		 */
+		int_t ncols() const;
+
+		/**
+		 * @brief The number of non zeros of the referenced matrix.
+		 */
+		int_t nnz() const;
+
+		/**
+		 * @brief The width in bytes of the stored row indices.
+		 */
+		std::size_t rowidxWidth() const;
+
+		/**
+		 * @brief The width in bytes of the stored column pointers.
+		 */
+		std::size_t colptrWidth() const;
+
+		/** @} */
+
+		/** 
+		 * @name Public Member Functions
+		 * @{
+		 */
+
+		/**
+		 * @brief Clears the view.
+		 */
+		void clear();
+
+		/**
+		 * @brief Checks if the view is empty.
+		 */
+		bool empty() const;
+
+		/**
+		 * @brief Updates a vector with a matrix-vector product.
+		 * @details Performs the operation <b>Y := beta * Y + alpha * opA(A) * X</b>
+		 *
+		 * @param[in] alpha The scaling coefficient.
+		 * @param[in] opA The operation to be performed for matrix A.
+		 * @param[in] X The input vector.
+		 * @param[in] beta The scaling coefficient for Y.
+		 * @param[in,out] Y The vector to be updated.
+		 */
+		void mult(T_Scalar alpha, op_t opA, const dns::XxVector<T_Scalar>& X, T_Scalar beta, dns::XxVector<T_Scalar>& Y) const;
+
+		/** @} */
+
+	private:
+		int_t m_nrows;
+		int_t m_ncols;
+
+		const T_Int    *m_colptr;
+		const T_Int    *m_rowidx;
+		const nint_t   *m_colptr32;
+		const nint_t   *m_rowidx32;
+		const T_Scalar *m_values;
+
+		std::vector<nint_t> m_colptrBuffer;
+		std::vector<nint_t> m_rowidxBuffer;
+
+		void defaults();
+};
+
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_CSC_COMPACT_VIEW_HPP_
@@ -0,0 +1,408 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/sparse/csc_dynamic_matrix.hpp"
+
+// system
+#include <algorithm>
+#include <sstream>
+
+// 3rd
+
+// cla3p
+#include "cla3p/error.hpp"
+#include "cla3p/error/literals.hpp"
+#include "cla3p/bulk/csc.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/support/utils.hpp"
+
+#include "cla3p/checks/coo_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace csc {
+/*-------------------------------------------------*/
+//
+// Packs the segments [colptr[j], colptr[j] + collen[j]) of all columns to the ranges defined by colptr_out
+//
+template <typename T_Int, typename T_Scalar>
+static void pack_columns(int_t n, int_t nz,
+		const T_Int *colptr, const T_Int *collen, const T_Int *rowidx, const T_Scalar *values, 
+		const T_Int *colptr_out, T_Int *rowidx_out, T_Scalar *values_out)
+{
+#pragma omp parallel for schedule(static) if(nz >= blk::csc::MT_NNZ_THRESHOLD)
+	for(int_t j = 0; j < n; j++) {
+		std::copy(rowidx + colptr[j], rowidx + colptr[j] + collen[j], rowidx_out + colptr_out[j]);
+		std::copy(values + colptr[j], values + colptr[j] + collen[j], values_out + colptr_out[j]);
+	} // j
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+DynamicMatrix<T_Int,T_Scalar>::DynamicMatrix()
+{
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+DynamicMatrix<T_Int,T_Scalar>::DynamicMatrix(int_t nr, int_t nc, const Property& pr)
+	: MatrixMeta(nr, nc, sanitizeProperty<T_Scalar>(pr))
+{
+	defaults();
+
+	if(nr > 0 && nc > 0) {
+		coo_consistency_check(prop(), nrows(), ncols());
+		m_colptr.assign(nc + 1, 0);
+		m_collen.assign(nc, 0);
+		m_colcap.assign(nc, 0);
+	} else {
+		clear();
+	} // nr/nc
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+DynamicMatrix<T_Int,T_Scalar>::DynamicMatrix(const XxMatrix<T_Int,T_Scalar>& A)
+	: MatrixMeta(A.nrows(), A.ncols(), A.prop())
+{
+	defaults();
+
+	if(A.empty()) {
+		clear();
+		return;
+	} // empty
+
+	int_t nc = A.ncols();
+	int_t nz = A.nnz();
+
+	m_nnz = nz;
+	m_colptr.assign(A.colptr(), A.colptr() + nc + 1);
+	m_rowidx.assign(A.rowidx(), A.rowidx() + nz);
+	m_values.assign(A.values(), A.values() + nz);
+	m_collen.resize(nc);
+
+	for(int_t j = 0; j < nc; j++) {
+		m_collen[j] = m_colptr[j+1] - m_colptr[j];
+	} // j
+
+	m_colcap = m_collen;
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+DynamicMatrix<T_Int,T_Scalar>::~DynamicMatrix()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void DynamicMatrix<T_Int,T_Scalar>::defaults()
+{
+	m_nnz = 0;
+	m_packed = true;
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void DynamicMatrix<T_Int,T_Scalar>::clear()
+{
+	MatrixMeta::clear();
+
+	m_colptr.clear();
+	m_collen.clear();
+	m_colcap.clear();
+	m_rowidx.clear();
+	m_values.clear();
+
+	releaseView();
+
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+int_t DynamicMatrix<T_Int,T_Scalar>::nnz() const
+{
+	return m_nnz;
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+int_t DynamicMatrix<T_Int,T_Scalar>::slack() const
+{
+	return static_cast<int_t>(m_rowidx.size()) - m_nnz;
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+T_Int DynamicMatrix<T_Int,T_Scalar>::locate(T_Int i, T_Int j) const
+{
+	const T_Int *ridx = m_rowidx.data();
+	const T_Int *rbgn = ridx + m_colptr[j];
+	const T_Int *rend = rbgn + m_collen[j];
+
+	return static_cast<T_Int>(std::lower_bound(rbgn, rend, i) - ridx);
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void DynamicMatrix<T_Int,T_Scalar>::repack(int_t nzc)
+{
+	int_t nc = ncols();
+
+	std::vector<T_Int> cptr(nc + 1);
+
+	cptr[0] = 0;
+	for(int_t j = 0; j < nc; j++) {
+		m_colcap[j] = m_collen[j] + nzc;
+		cptr[j+1] = m_colcap[j];
+	} // j
+
+	blk::csc::roll(nc, cptr.data());
+
+	std::vector<T_Int>    ridx(cptr[nc]);
+	std::vector<T_Scalar> vals(cptr[nc]);
+
+	pack_columns(nc, m_nnz, m_colptr.data(), m_collen.data(), m_rowidx.data(), m_values.data(), cptr.data(), ridx.data(), vals.data());
+
+	m_colptr.swap(cptr);
+	m_rowidx.swap(ridx);
+	m_values.swap(vals);
+
+	m_packed = (nzc == 0);
+
+	releaseView();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+bool DynamicMatrix<T_Int,T_Scalar>::contiguous() const
+{
+	int_t nc = ncols();
+
+	if(m_colptr[0] != 0) 
+		return false;
+
+	for(int_t j = 1; j < nc; j++) {
+		if(m_colptr[j-1] + m_collen[j-1] != m_colptr[j]) 
+			return false;
+	} // j
+
+	return true;
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void DynamicMatrix<T_Int,T_Scalar>::releaseView()
+{
+	std::vector<T_Int>().swap(m_viewColptr);
+	std::vector<T_Int>().swap(m_viewRowidx);
+	std::vector<T_Scalar>().swap(m_viewValues);
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void DynamicMatrix<T_Int,T_Scalar>::relocate(int_t j)
+{
+	//
+	// Reclaim the holes left by relocated columns once they outnumber the non zeros
+	//
+	if(slack() > std::max(m_nnz, ncols())) {
+		repack(0);
+	}
+
+	T_Int pos = static_cast<T_Int>(m_rowidx.size());
+	T_Int cap = std::max(2 * m_colcap[j], T_Int(4));
+
+	m_rowidx.resize(pos + cap);
+	m_values.resize(pos + cap);
+
+	std::copy(m_rowidx.begin() + m_colptr[j], m_rowidx.begin() + m_colptr[j] + m_collen[j], m_rowidx.begin() + pos);
+	std::copy(m_values.begin() + m_colptr[j], m_values.begin() + m_colptr[j] + m_collen[j], m_values.begin() + pos);
+
+	m_colptr[j] = pos;
+	m_colcap[j] = cap;
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void DynamicMatrix<T_Int,T_Scalar>::reserve(int_t nzc)
+{
+	if(empty()) {
+		throw err::InvalidOp(msg::EmptyObject());
+	}
+
+	repack(std::max(nzc, int_t(0)));
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void DynamicMatrix<T_Int,T_Scalar>::insert(T_Int i, T_Int j, T_Scalar v)
+{
+	coo_check_triplet(nrows(), ncols(), prop(), i, j, v);
+
+	T_Int pos = locate(i, j);
+	T_Int end = m_colptr[j] + m_collen[j];
+
+	if(pos < end && m_rowidx[pos] == i) {
+		m_values[pos] = v;
+		return;
+	} // update
+
+	if(m_collen[j] == m_colcap[j]) {
+		T_Int offset = pos - m_colptr[j];
+		relocate(j);
+		pos = m_colptr[j] + offset;
+		end = m_colptr[j] + m_collen[j];
+	} // grow
+
+	std::copy_backward(m_rowidx.begin() + pos, m_rowidx.begin() + end, m_rowidx.begin() + end + 1);
+	std::copy_backward(m_values.begin() + pos, m_values.begin() + end, m_values.begin() + end + 1);
+
+	m_rowidx[pos] = i;
+	m_values[pos] = v;
+
+	m_collen[j]++;
+	m_nnz++;
+	m_packed = false;
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+bool DynamicMatrix<T_Int,T_Scalar>::erase(T_Int i, T_Int j)
+{
+	coo_check_coord(nrows(), ncols(), prop(), i, j);
+
+	T_Int pos = locate(i, j);
+	T_Int end = m_colptr[j] + m_collen[j];
+
+	if(pos == end || m_rowidx[pos] != i) 
+		return false;
+
+	std::copy(m_rowidx.begin() + pos + 1, m_rowidx.begin() + end, m_rowidx.begin() + pos);
+	std::copy(m_values.begin() + pos + 1, m_values.begin() + end, m_values.begin() + pos);
+
+	m_collen[j]--;
+	m_nnz--;
+	m_packed = false;
+
+	return true;
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+bool DynamicMatrix<T_Int,T_Scalar>::contains(T_Int i, T_Int j) const
+{
+	coo_check_coord(nrows(), ncols(), prop(), i, j);
+
+	T_Int pos = locate(i, j);
+
+	return (pos < m_colptr[j] + m_collen[j] && m_rowidx[pos] == i);
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+T_Scalar DynamicMatrix<T_Int,T_Scalar>::value(T_Int i, T_Int j) const
+{
+	coo_check_coord(nrows(), ncols(), prop(), i, j);
+
+	T_Int pos = locate(i, j);
+
+	if(pos < m_colptr[j] + m_collen[j] && m_rowidx[pos] == i)
+		return m_values[pos];
+
+	return T_Scalar(0);
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void DynamicMatrix<T_Int,T_Scalar>::compact()
+{
+	if(!empty() && !m_packed) {
+		repack(0);
+	}
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+Guard<XxMatrix<T_Int,T_Scalar>> DynamicMatrix<T_Int,T_Scalar>::view()
+{
+	if(empty()) 
+		return Guard<XxMatrix<T_Int,T_Scalar>>();
+
+	int_t nc = ncols();
+
+	if(m_packed || contiguous()) {
+		m_colptr[nc] = static_cast<T_Int>(m_nnz);
+		return XxMatrix<T_Int,T_Scalar>::view(nrows(), nc, m_colptr.data(), m_rowidx.data(), m_values.data(), prop());
+	} // in place
+
+	//
+	// Columns with slack are packed to a side buffer, so the reserved capacity survives
+	//
+	m_viewColptr.resize(nc + 1);
+	m_viewRowidx.resize(m_nnz);
+	m_viewValues.resize(m_nnz);
+
+	m_viewColptr[0] = 0;
+	std::copy(m_collen.begin(), m_collen.end(), m_viewColptr.begin() + 1);
+	blk::csc::roll(nc, m_viewColptr.data());
+
+	pack_columns(nc, m_nnz, m_colptr.data(), m_collen.data(), m_rowidx.data(), m_values.data(), 
+			m_viewColptr.data(), m_viewRowidx.data(), m_viewValues.data());
+
+	return XxMatrix<T_Int,T_Scalar>::view(nrows(), nc, m_viewColptr.data(), m_viewRowidx.data(), m_viewValues.data(), prop());
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+XxMatrix<T_Int,T_Scalar> DynamicMatrix<T_Int,T_Scalar>::toCsc() const
+{
+	if(empty()) 
+		return XxMatrix<T_Int,T_Scalar>();
+
+	int_t nc = ncols();
+
+	T_Int *cptr = i_malloc<T_Int>(nc + 1);
+
+	cptr[0] = 0;
+	std::copy(m_collen.begin(), m_collen.end(), cptr + 1);
+	blk::csc::roll(nc, cptr);
+
+	T_Int    *ridx = i_malloc<T_Int>(m_nnz);
+	T_Scalar *vals = i_malloc<T_Scalar>(m_nnz);
+
+	pack_columns(nc, m_nnz, m_colptr.data(), m_collen.data(), m_rowidx.data(), m_values.data(), cptr, ridx, vals);
+
+	XxMatrix<T_Int,T_Scalar> ret(nrows(), nc, cptr, ridx, vals, true, prop());
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+std::string DynamicMatrix<T_Int,T_Scalar>::info(const std::string& header) const
+{ 
+	std::string top;
+	std::string bottom;
+	fill_info_margins(header, top, bottom);
+
+	std::ostringstream ss;
+
+	ss << top << "\n";
+
+	ss << "  Datatype............. " << TypeTraits<T_Scalar>::type_name() << "\n";
+	ss << "  Precision............ " << TypeTraits<T_Scalar>::prec_name() << "\n";
+	ss << "  Number of rows....... " << nrows() << "\n";
+	ss << "  Number of columns.... " << ncols() << "\n";
+	ss << "  Number of non zeros.. " << nnz() << "\n";
+	ss << "  Unused slots......... " << slack() << "\n";
+	ss << "  Property............. " << prop() << "\n";
+
+	ss << bottom << "\n";
+
+	return ss.str();
+}
+/*-------------------------------------------------*/
+template class DynamicMatrix<int_t,real_t>;
+template class DynamicMatrix<int_t,real4_t>;
+template class DynamicMatrix<int_t,complex_t>;
+template class DynamicMatrix<int_t,complex8_t>;
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_CSC_DYNAMIC_MATRIX_HPP_
+#define CLA3P_CSC_DYNAMIC_MATRIX_HPP_
+
+/**
+ * @file
+ */
+
+#include <string>
+#include <vector>
+
+#include "cla3p/types.hpp"
+#include "cla3p/generic/matrix_meta.hpp"
+#include "cla3p/generic/guard.hpp"
+#include "cla3p/sparse/csc_xxmatrix.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace csc {
+/*-------------------------------------------------*/
+
+/**
+ * @nosubgrouping 
+ * @brief The dynamic sparse matrix class (compressed sparse column with per column slack).
+ *
+ * Every column occupies a sorted segment of the storage with some spare capacity,
+ * so entries can be inserted, updated and erased without rebuilding the matrix. @n
+ * A column that runs out of capacity is moved to the end of the storage with doubled capacity,
+ * so insertions cost amortized constant time plus the shift within the column. @n
+ * The storage is compacted only on request (see compact()), so the reserved capacity is kept until then.
+ */
+template <typename T_Int, typename T_Scalar>
+class DynamicMatrix : public MatrixMeta {
+
+	public:
+		using index_type = T_Int;
+		using value_type = T_Scalar;
+
+	public:
+
+		/**
+		 * @name Constructors
+		 * @{
+		 */
+
+		/**
+		 * @copydoc standard_matrix_docs::constructor()
+		 */
+		DynamicMatrix();
+
+		/**
+		 * @brief The dimensional constructor.
+		 * @details Constructs an empty (nr x nc) matrix with no non zeros.
+		 * @param[in] nr The number of matrix rows.
+		 * @param[in] nc The number of matrix columns.
+		 * @param[in] pr The matrix property.
+		 */
+		explicit DynamicMatrix(int_t nr, int_t nc, const Property& pr = Property::General());
+
+		/**
+		 * @brief The conversion constructor.
+		 * @details Constructs a dynamic matrix with a copy of the contents of A.
+		 * @param[in] A The compressed sparse column matrix to be copied.
+		 */
+		explicit DynamicMatrix(const XxMatrix<T_Int,T_Scalar>& A);
+
+		/**
+		 * @copydoc standard_docs::copy_constructor()
+		 */
+		DynamicMatrix(const DynamicMatrix<T_Int,T_Scalar>& other) = default;
+
+		/**
+		 * @copydoc standard_docs::move_constructor()
+		 */
+		DynamicMatrix(DynamicMatrix<T_Int,T_Scalar>&& other) = default;
+
+		/**
+		 * @copydoc standard_matrix_docs::destructor()
+		 */
+		~DynamicMatrix();
+
+		/** @} */
+
+		/** 
+		 * @name Operators
+		 * @{
+		 */
+
+		/**
+		 * @copydoc standard_docs::copy_assignment()
+		 */
+		DynamicMatrix<T_Int,T_Scalar>& operator=(const DynamicMatrix<T_Int,T_Scalar>& other) = default;
+
+		/**
+		 * @copydoc standard_docs::move_assignment()
+		 */
+		DynamicMatrix<T_Int,T_Scalar>& operator=(DynamicMatrix<T_Int,T_Scalar>&& other) = default;
+
+		/** @} */
+
+		/** 
+		 * @name Arguments
+		 * @{
+		 */
+
+		/**
+		 * @copydoc standard_docs::nnz()
+		 */
+		int_t nnz() const;
+
+		/**
+		 * @brief The number of unused storage slots.
+		 */
+		int_t slack() const;
+
+		/** @} */
+
+		/** 
+		 * @name Public Member Functions
+		 * @{
+		 */
+
+		/**
+		 * @copydoc standard_docs::clear()
+		 */
+		void clear();
+
+		/**
+		 * @brief Reserves spare capacity.
+		 * @details Compacts the storage leaving room for at least nzc more non zeros in every column.
+		 * @param[in] nzc The number of non zeros per column to reserve.
+		 */
+		void reserve(int_t nzc);
+
+		/**
+		 * @brief Inserts or updates an entry.
+		 * @details Sets the value of entry (i,j) to v, inserting it in the pattern if needed.
+		 * @param[in] i The row index.
+		 * @param[in] j The column index.
+		 * @param[in] v The value.
+		 */
+		void insert(T_Int i, T_Int j, T_Scalar v);
+
+		/**
+		 * @brief Erases an entry.
+		 * @details Removes entry (i,j) from the pattern.
+		 * @param[in] i The row index.
+		 * @param[in] j The column index.
+		 * @return Whether the entry was found.
+		 */
+		bool erase(T_Int i, T_Int j);
+
+		/**
+		 * @brief Checks if an entry is in the pattern.
+		 * @param[in] i The row index.
+		 * @param[in] j The column index.
+		 */
+		bool contains(T_Int i, T_Int j) const;
+
+		/**
+		 * @brief The value of an entry.
+		 * @param[in] i The row index.
+		 * @param[in] j The column index.
+		 * @return The value of entry (i,j), zero if it is not in the pattern.
+		 */
+		T_Scalar value(T_Int i, T_Int j) const;
+
+		/**
+		 * @brief Removes the slack of the storage.
+		 * @details Packs all columns contiguously, leaving no spare capacity.
+		 */
+		void compact();
+
+		/**
+		 * @brief Gets a (guarded) compressed sparse column matrix with content reference.
+		 * @details If the columns are stored back to back (e.g. after compact()), the storage is referenced as is. @n
+		 *          Otherwise the columns are packed to a separate buffer and the storage keeps its spare capacity.
+		 *          In that case the view holds a snapshot of the values, so changes through the view do not reach `*this`. @n
+		 *          The view is invalidated by subsequent structural changes and calls to view().
+		 * @return A (guarded) matrix with content reference to `*this`.
+		 */
+		Guard<XxMatrix<T_Int,T_Scalar>> view();
+
+		/**
+		 * @brief Converts to a compressed sparse column matrix.
+		 * @return A compressed sparse column copy of `*this`.
+		 */
+		XxMatrix<T_Int,T_Scalar> toCsc() const;
+
+		/**
+		 * @copydoc standard_matrix_docs::info()
+		 */
+		std::string info(const std::string& header = "") const;
+
+		/** @} */
+
+	private:
+		int_t m_nnz;
+		bool  m_packed;
+
+		std::vector<T_Int>    m_colptr;
+		std::vector<T_Int>    m_collen;
+		std::vector<T_Int>    m_colcap;
+		std::vector<T_Int>    m_rowidx;
+		std::vector<T_Scalar> m_values;
+
+		std::vector<T_Int>    m_viewColptr;
+		std::vector<T_Int>    m_viewRowidx;
+		std::vector<T_Scalar> m_viewValues;
+
+		void defaults();
+		void releaseView();
+		void repack(int_t nzc);
+		void relocate(int_t j);
+		bool contiguous() const;
+		T_Int locate(T_Int i, T_Int j) const;
+};
+
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_CSC_DYNAMIC_MATRIX_HPP_
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/sparse/csc_level_schedule.hpp"
+
+// system
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse/csc_xxmatrix.hpp"
+#include "cla3p/bulk/csc.hpp"
+#include "cla3p/bulk/csc_math.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+#include "cla3p/checks/matrix_math_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace csc {
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+static unsigned long long pattern_fingerprint(const T_Matrix& mat)
+{
+	return blk::csc::pattern_hash(mat.prop().type(), mat.prop().uplo(), mat.nrows(), mat.ncols(), mat.colptr(), mat.rowidx());
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+LevelSchedule<T_Int,T_Scalar>::LevelSchedule()
+{
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+LevelSchedule<T_Int,T_Scalar>::LevelSchedule(op_t opA, const XxMatrix<T_Int,T_Scalar>& A)
+{
+	defaults();
+	analysis(opA, A);
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+LevelSchedule<T_Int,T_Scalar>::~LevelSchedule()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void LevelSchedule<T_Int,T_Scalar>::defaults()
+{
+	m_op = op_t::N;
+	m_uplo = uplo_t::Full;
+	m_size = 0;
+	m_nnz = 0;
+	m_nlevels = 0;
+	m_fingerprint = 0;
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+int_t LevelSchedule<T_Int,T_Scalar>::size() const
+{
+	return m_size;
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+int_t LevelSchedule<T_Int,T_Scalar>::nlevels() const
+{
+	return m_nlevels;
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+op_t LevelSchedule<T_Int,T_Scalar>::op() const
+{
+	return m_op;
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void LevelSchedule<T_Int,T_Scalar>::clear()
+{
+	m_rowptr.clear();
+	m_colidx.clear();
+	m_valpos.clear();
+	m_diagpos.clear();
+	m_levptr.clear();
+	m_order.clear();
+
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+bool LevelSchedule<T_Int,T_Scalar>::empty() const
+{
+	return m_rowptr.empty();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void LevelSchedule<T_Int,T_Scalar>::analysis(op_t opA, const XxMatrix<T_Int,T_Scalar>& A)
+{
+	clear();
+
+	opA = (TypeTraits<T_Scalar>::is_real() && opA == op_t::C ? op_t::T : opA);
+
+	Operation _opA(opA);
+	trivec_mult_replace_check(A.prop(), A.nrows(), A.ncols(), _opA, A.ncols());
+
+	int_t n = A.ncols();
+
+	m_rowptr.resize(n + 1);
+	m_colidx.resize(A.nnz());
+	m_valpos.resize(A.nnz());
+	m_diagpos.resize(n);
+	m_levptr.resize(n + 1);
+	m_order.resize(n);
+
+	m_nlevels = blk::csc::tri_levels(A.prop().uplo(), opA, n, A.colptr(), A.rowidx(),
+			m_rowptr.data(), m_colidx.data(), m_valpos.data(), m_diagpos.data(), 
+			m_levptr.data(), m_order.data());
+
+	m_op = opA;
+	m_uplo = A.prop().uplo();
+	m_size = n;
+	m_nnz = A.nnz();
+	m_fingerprint = pattern_fingerprint(A);
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void LevelSchedule<T_Int,T_Scalar>::matchCheck(const XxMatrix<T_Int,T_Scalar>& A) const
+{
+	if(empty()) {
+		throw err::InvalidOp(msg::EmptyObject());
+	}
+
+	if(!A.prop().isTriangular() || A.prop().uplo() != m_uplo || 
+			A.nrows() != m_size || A.ncols() != m_size || A.nnz() != m_nnz || 
+			pattern_fingerprint(A) != m_fingerprint) {
+		throw err::NoConsistency(msg::AnalysisMismatch());
+	}
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void LevelSchedule<T_Int,T_Scalar>::solveInternal(T_Scalar alpha, const XxMatrix<T_Int,T_Scalar>& A, int_t nrhs, T_Scalar *b, int_t ldb) const
+{
+	blk::csc::tri_x_gem_solve(m_op, m_size, nrhs, alpha, A.values(), 
+			m_rowptr.data(), m_colidx.data(), m_valpos.data(), m_diagpos.data(), 
+			m_nlevels, m_levptr.data(), m_order.data(), b, ldb);
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void LevelSchedule<T_Int,T_Scalar>::solve(const XxMatrix<T_Int,T_Scalar>& A, dns::XxVector<T_Scalar>& B) const
+{
+	matchCheck(A);
+
+	if(B.size() != m_size) {
+		throw err::NoConsistency(msg::InvalidDimensions());
+	}
+
+	solveInternal(T_Scalar(1), A, 1, B.values(), B.size());
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void LevelSchedule<T_Int,T_Scalar>::solve(T_Scalar alpha, const XxMatrix<T_Int,T_Scalar>& A, dns::XxMatrix<T_Scalar>& B) const
+{
+	matchCheck(A);
+
+	if(!B.prop().isGeneral()) {
+		throw err::NoConsistency(msg::InvalidProperty());
+	}
+
+	if(B.nrows() != m_size) {
+		throw err::NoConsistency(msg::InvalidDimensions());
+	}
+
+	solveInternal(alpha, A, B.ncols(), B.values(), B.ld());
+}
+/*-------------------------------------------------*/
+template class LevelSchedule<int_t,real_t>;
+template class LevelSchedule<int_t,real4_t>;
+template class LevelSchedule<int_t,complex_t>;
+template class LevelSchedule<int_t,complex8_t>;
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_CSC_LEVEL_SCHEDULE_HPP_
+#define CLA3P_CSC_LEVEL_SCHEDULE_HPP_
+
+/**
+ * @file
+ */
+
+#include <vector>
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+/*-------------------------------------------------*/
+
+namespace dns { template <typename T_Scalar> class XxVector; }
+namespace dns { template <typename T_Scalar> class XxMatrix; }
+
+/*-------------------------------------------------*/
+namespace csc {
+/*-------------------------------------------------*/
+
+template <typename T_Int, typename T_Scalar> class XxMatrix;
+
+/**
+ * @nosubgrouping 
+ * @brief Level set schedule for sparse triangular solves.
+ *
+ * Groups the unknowns of a triangular system <b>opA(A) * X = B</b> in dependency levels. @n
+ * Unknowns of the same level are independent and are solved in parallel. @n
+ * The analysis depends only on the sparsity pattern of A, so it can be reused
+ * for repeated solves as long as the pattern remains unchanged.
+ */
+template <typename T_Int, typename T_Scalar>
+class LevelSchedule {
+
+	public:
+
+		/**
+		 * @name Constructors
+		 * @{
+		 */
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty schedule.
+		 */
+		LevelSchedule();
+
+		/**
+		 * @brief The analysis constructor.
+		 *
+		 * Constructs the schedule for solving with opA(A).
+		 *
+		 * @param[in] opA The operation to be performed for matrix A.
+		 * @param[in] A The triangular matrix.
+		 */
+		explicit LevelSchedule(op_t opA, const XxMatrix<T_Int,T_Scalar>& A);
+
+		/**
+		 * @brief Destroys the schedule.
+		 */
+		~LevelSchedule();
+
+		/** @} */
+
+		/** 
+		 * @name Arguments
+		 * @{
+		 */
+
+		/**
+		 * @brief The size of the triangular system.
+		 */
+		int_t size() const;
+
+		/**
+		 * @brief The number of dependency levels.
+		 */
+		int_t nlevels() const;
+
+		/**
+		 * @brief The operation the schedule was built for.
+		 */
+		op_t op() const;
+
+		/** @} */
+
+		/** 
+		 * @name Public Member Functions
+		 * @{
+		 */
+
+		/**
+		 * @brief Clears the schedule.
+		 */
+		void clear();
+
+		/**
+		 * @brief Checks if the schedule is empty.
+		 */
+		bool empty() const;
+
+		/**
+		 * @brief Performs the level set analysis of opA(A).
+		 *
+		 * @param[in] opA The operation to be performed for matrix A.
+		 * @param[in] A The triangular matrix.
+		 */
+		void analysis(op_t opA, const XxMatrix<T_Int,T_Scalar>& A);
+
+		/**
+		 * @brief Replaces a vector with the solution of a triangular system.
+		 * @details Solves the system <b>opA(A) * X = B</b> using the stored analysis.@n
+		 *          A must have the pattern the schedule was built with, values can differ. @n
+		 *          A pattern mismatch throws NoConsistency.
+		 *
+		 * @param[in] A The triangular matrix.
+		 * @param[in,out] B On entry, the rhs, on exit the system solution X.
+		 */
+		void solve(const XxMatrix<T_Int,T_Scalar>& A, dns::XxVector<T_Scalar>& B) const;
+
+		/**
+		 * @brief Replaces a matrix with the scaled solution of a triangular system.
+		 * @details Solves the system <b>opA(A) * X = alpha * B</b> using the stored analysis.@n
+		 *          A must have the pattern the schedule was built with, values can differ. @n
+		 *          A pattern mismatch throws NoConsistency.
+		 *
+		 * @param[in] alpha The scaling coefficient.
+		 * @param[in] A The triangular matrix.
+		 * @param[in,out] B On entry, the rhs, on exit the system solution X.
+		 */
+		void solve(T_Scalar alpha, const XxMatrix<T_Int,T_Scalar>& A, dns::XxMatrix<T_Scalar>& B) const;
+
+		/** @} */
+
+	private:
+		op_t   m_op;
+		uplo_t m_uplo;
+		int_t  m_size;
+		int_t  m_nnz;
+		int_t  m_nlevels;
+
+		unsigned long long m_fingerprint;
+
+		std::vector<int_t> m_rowptr;
+		std::vector<int_t> m_colidx;
+		std::vector<int_t> m_valpos;
+		std::vector<int_t> m_diagpos;
+		std::vector<int_t> m_levptr;
+		std::vector<int_t> m_order;
+
+		void defaults();
+		void matchCheck(const XxMatrix<T_Int,T_Scalar>& A) const;
+		void solveInternal(T_Scalar alpha, const XxMatrix<T_Int,T_Scalar>& A, int_t nrhs, T_Scalar *b, int_t ldb) const;
+};
+
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_CSC_LEVEL_SCHEDULE_HPP_
@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/sparse/csc_pattern_matrix.hpp"
+
+// system
+#include <algorithm>
+#include <sstream>
+#include <utility>
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense/dns_xxvector.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+#include "cla3p/bulk/csc.hpp"
+#include "cla3p/bulk/csc_math.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/support/utils.hpp"
+#include "cla3p/checks/basic_checks.hpp"
+#include "cla3p/checks/matrix_math_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace csc {
+/*-------------------------------------------------*/
+static Property pattern_property(const Property& pr)
+{
+	if(pr.isSkew()) {
+		throw err::InvalidOp(msg::InvalidProperty());
+	}
+
+	if(pr.isHermitian()) {
+		return Property(prop_t::Symmetric, pr.uplo());
+	} // values are implicitly 1
+
+	return pr;
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+PatternMatrix<T_Int>::PatternMatrix()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+PatternMatrix<T_Int>::PatternMatrix(int_t nr, int_t nc, const T_Int *cptr, const T_Int *ridx, const Property& pr)
+	: MatrixMeta(nr, nc, pattern_property(pr))
+{
+	if(empty()) {
+		clear();
+		return;
+	}
+
+	if(!cptr || !ridx) {
+		throw err::InvalidOp("Invalid structure arrays");
+	}
+
+	m_colptr.assign(cptr, cptr + nc + 1);
+	m_rowidx.assign(ridx, ridx + cptr[nc]);
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+PatternMatrix<T_Int>::PatternMatrix(int_t nr, int_t nc, std::vector<T_Int>&& cptr, std::vector<T_Int>&& ridx, const Property& pr)
+	: MatrixMeta(nr, nc, pr), m_colptr(std::move(cptr)), m_rowidx(std::move(ridx))
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+template <typename T_Scalar>
+PatternMatrix<T_Int>::PatternMatrix(const XxMatrix<T_Int,T_Scalar>& A)
+	: PatternMatrix(A.nrows(), A.ncols(), A.colptr(), A.rowidx(), A.prop())
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+PatternMatrix<T_Int>::~PatternMatrix()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+void PatternMatrix<T_Int>::clear()
+{
+	MatrixMeta::clear();
+	m_colptr.clear();
+	m_rowidx.clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+int_t PatternMatrix<T_Int>::nnz() const
+{
+	return (empty() ? 0 : m_colptr[ncols()]);
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+const T_Int* PatternMatrix<T_Int>::colptr() const
+{
+	return m_colptr.data();
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+const T_Int* PatternMatrix<T_Int>::rowidx() const
+{
+	return m_rowidx.data();
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+void PatternMatrix<T_Int>::validate() const
+{
+	if(!empty()) {
+		blk::csc::check(prop().type(), prop().uplo(), nrows(), ncols(), colptr(), rowidx());
+	}
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+PatternMatrix<T_Int> PatternMatrix<T_Int>::transpose() const
+{
+	if(empty() || prop().isSymmetric()) 
+		return *this;
+
+	Property pr = prop();
+	if(pr.isTriangular()) {
+		pr.switchUplo();
+	}
+
+	std::vector<T_Int> cptr(nrows() + 1);
+	std::vector<T_Int> ridx(nnz());
+
+	blk::csc::transpose(nrows(), ncols(), colptr(), rowidx(), cptr.data(), ridx.data());
+
+	return PatternMatrix<T_Int>(ncols(), nrows(), std::move(cptr), std::move(ridx), pr);
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+PatternMatrix<T_Int> PatternMatrix<T_Int>::general() const
+{
+	if(empty()) 
+		return PatternMatrix<T_Int>();
+
+	if(!prop().isSymmetric()) {
+		std::vector<T_Int> cptr(m_colptr);
+		std::vector<T_Int> ridx(m_rowidx);
+		return PatternMatrix<T_Int>(nrows(), ncols(), std::move(cptr), std::move(ridx), Property::General());
+	}
+
+	int_t n = ncols();
+
+	std::vector<T_Int> cptr(n + 1);
+	blk::csc::uplo2ge_colptr(prop().uplo(), n, colptr(), rowidx(), cptr.data());
+
+	std::vector<T_Int> ridx(cptr[n]);
+	blk::csc::uplo2ge(prop().uplo(), n, colptr(), rowidx(), cptr.data(), ridx.data());
+
+	return PatternMatrix<T_Int>(n, n, std::move(cptr), std::move(ridx), Property::General());
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+PatternMatrix<T_Int> PatternMatrix<T_Int>::unite(const PatternMatrix<T_Int>& other) const
+{
+	if(empty() || other.empty()) {
+		throw err::InvalidOp(msg::EmptyObject());
+	}
+
+	similarity_dim_check(nrows(), other.nrows());
+	similarity_dim_check(ncols(), other.ncols());
+
+	std::vector<T_Int> cptr;
+	std::vector<T_Int> ridx;
+
+	if(prop() == other.prop()) {
+		blk::csc::add_symbolic(ncols(), colptr(), rowidx(), other.colptr(), other.rowidx(), cptr, ridx);
+		return PatternMatrix<T_Int>(nrows(), ncols(), std::move(cptr), std::move(ridx), prop());
+	}
+
+	PatternMatrix<T_Int> A = general();
+	PatternMatrix<T_Int> B = other.general();
+
+	blk::csc::add_symbolic(ncols(), A.colptr(), A.rowidx(), B.colptr(), B.rowidx(), cptr, ridx);
+
+	return PatternMatrix<T_Int>(nrows(), ncols(), std::move(cptr), std::move(ridx), Property::General());
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+PatternMatrix<T_Int> PatternMatrix<T_Int>::product(const PatternMatrix<T_Int>& other) const
+{
+	if(empty() || other.empty()) {
+		throw err::InvalidOp(msg::EmptyObject());
+	}
+
+	similarity_dim_check(ncols(), other.nrows());
+
+	PatternMatrix<T_Int> A = (prop().isSymmetric() ? general() : PatternMatrix<T_Int>());
+	PatternMatrix<T_Int> B = (other.prop().isSymmetric() ? other.general() : PatternMatrix<T_Int>());
+
+	const PatternMatrix<T_Int>& opA = (A.empty() ? *this : A);
+	const PatternMatrix<T_Int>& opB = (B.empty() ? other : B);
+
+	std::vector<T_Int> cptr;
+	std::vector<T_Int> ridx;
+
+	blk::csc::gem_x_gem_symbolic(nrows(), other.ncols(), ncols(),
+			op_t::N, opA.colptr(), opA.rowidx(), 
+			op_t::N, opB.colptr(), opB.rowidx(), 
+			cptr, ridx);
+
+	return PatternMatrix<T_Int>(nrows(), other.ncols(), std::move(cptr), std::move(ridx), Property::General());
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+template <typename T_Scalar>
+void PatternMatrix<T_Int>::mult(T_Scalar alpha, op_t opA, 
+		const dns::XxVector<T_Scalar>& X, T_Scalar beta, dns::XxVector<T_Scalar>& Y) const
+{
+	if(empty()) {
+		throw err::InvalidOp(msg::EmptyObject());
+	}
+
+	if(prop().isSymmetric()) opA = op_t::N;
+
+	opA = (opA == op_t::C ? op_t::T : opA);
+
+	Operation _opA(opA);
+	mat_x_vec_mult_check(_opA, prop(), nrows(), ncols(), X.size(), Y.size());
+
+	if(prop().isGeneral() || prop().isTriangular()) {
+
+		blk::csc::gem_x_vec_pattern(opA, nrows(), ncols(), alpha, 
+				colptr(), rowidx(), 
+				X.values(), beta, Y.values());
+
+	} else if(prop().isSymmetric()) {
+
+		blk::csc::sym_x_vec_pattern(prop().uplo(), ncols(), alpha, 
+				colptr(), rowidx(), 
+				X.values(), beta, Y.values());
+
+	} else {
+
+		throw err::Exception();
+
+	} // property 
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+template <typename T_Scalar>
+XxMatrix<T_Int,T_Scalar> PatternMatrix<T_Int>::toCsc(T_Scalar val) const
+{
+	if(empty()) 
+		return XxMatrix<T_Int,T_Scalar>();
+
+	int_t nc = ncols();
+	int_t nz = nnz();
+
+	T_Int    *cptr = i_malloc<T_Int>(nc + 1);
+	T_Int    *ridx = i_malloc<T_Int>(nz);
+	T_Scalar *vals = i_malloc<T_Scalar>(nz);
+
+	std::copy(m_colptr.begin(), m_colptr.end(), cptr);
+	std::copy(m_rowidx.begin(), m_rowidx.end(), ridx);
+	std::fill(vals, vals + nz, val);
+
+	XxMatrix<T_Int,T_Scalar> ret(nrows(), nc, cptr, ridx, vals, true, prop());
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+std::string PatternMatrix<T_Int>::info(const std::string& header) const
+{ 
+	std::string top;
+	std::string bottom;
+	fill_info_margins(header, top, bottom);
+
+	std::ostringstream ss;
+
+	ss << top << "\n";
+
+	ss << "  Number of rows....... " << nrows() << "\n";
+	ss << "  Number of columns.... " << ncols() << "\n";
+	ss << "  Number of non zeros.. " << nnz() << "\n";
+	ss << "  Property............. " << prop() << "\n";
+
+	ss << bottom << "\n";
+
+	return ss.str();
+}
+/*-------------------------------------------------*/
+template class PatternMatrix<int_t>;
+/*-------------------------------------------------*/
+#define instantiate_pattern_members(T_Scl) \
+template PatternMatrix<int_t>::PatternMatrix(const XxMatrix<int_t,T_Scl>&); \
+template void PatternMatrix<int_t>::mult(T_Scl, op_t, const dns::XxVector<T_Scl>&, T_Scl, dns::XxVector<T_Scl>&) const; \
+template XxMatrix<int_t,T_Scl> PatternMatrix<int_t>::toCsc(T_Scl) const
+instantiate_pattern_members(real_t);
+instantiate_pattern_members(real4_t);
+instantiate_pattern_members(complex_t);
+instantiate_pattern_members(complex8_t);
+#undef instantiate_pattern_members
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace cla3p
+/*-------------------------------------------------*/
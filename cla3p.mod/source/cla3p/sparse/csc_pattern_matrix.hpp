@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_CSC_PATTERN_MATRIX_HPP_
+#define CLA3P_CSC_PATTERN_MATRIX_HPP_
+
+/**
+ * @file
+ */
+
+#include <string>
+#include <vector>
+
+#include "cla3p/types.hpp"
+#include "cla3p/generic/matrix_meta.hpp"
+#include "cla3p/sparse/csc_xxmatrix.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+/*-------------------------------------------------*/
+
+namespace dns { template <typename T_Scalar> class XxVector; }
+
+/*-------------------------------------------------*/
+namespace csc {
+/*-------------------------------------------------*/
+
+/**
+ * @nosubgrouping 
+ * @brief The sparse pattern class (compressed sparse column structure without values).
+ *
+ * Stores only the column pointers and row indices of a sparse matrix, all stored entries are implicitly 1. @n
+ * Suited for graph operations (adjacency products, Laplacian structure) and as the output of symbolic phases. @n
+ * Supported properties are General, Triangular and Symmetric (Hermitian patterns are treated as Symmetric).
+ */
+template <typename T_Int>
+class PatternMatrix : public MatrixMeta {
+
+	public:
+		using index_type = T_Int;
+
+	public:
+
+		/**
+		 * @name Constructors
+		 * @{
+		 */
+
+		/**
+		 * @copydoc standard_matrix_docs::constructor()
+		 */
+		PatternMatrix();
+
+		/**
+		 * @brief Creates a pattern from aux data.
+		 * @details Creates a (nr x nc) pattern with a copy of the given structure.
+		 * @param[in] nr The number of rows.
+		 * @param[in] nc The number of columns.
+		 * @param[in] cptr The array containing the column pointers.
+		 * @param[in] ridx The array containing the row indexes (sorted within each column).
+		 * @param[in] pr The pattern property.
+		 */
+		explicit PatternMatrix(int_t nr, int_t nc, const T_Int *cptr, const T_Int *ridx, const Property& pr = Property::General());
+
+		/**
+		 * @brief The conversion constructor.
+		 * @details Constructs the pattern of A, values are discarded.
+		 * @param[in] A The compressed sparse column matrix.
+		 */
+		template <typename T_Scalar>
+		explicit PatternMatrix(const XxMatrix<T_Int,T_Scalar>& A);
+
+		/**
+		 * @copydoc standard_docs::copy_constructor()
+		 */
+		PatternMatrix(const PatternMatrix<T_Int>& other) = default;
+
+		/**
+		 * @copydoc standard_docs::move_constructor()
+		 */
+		PatternMatrix(PatternMatrix<T_Int>&& other) = default;
+
+		/**
+		 * @copydoc standard_matrix_docs::destructor()
+		 */
+		~PatternMatrix();
+
+		/** @} */
+
+		/** 
+		 * @name Operators
+		 * @{
+		 */
+
+		/**
+		 * @copydoc standard_docs::copy_assignment()
+		 */
+		PatternMatrix<T_Int>& operator=(const PatternMatrix<T_Int>& other) = default;
+
+		/**
+		 * @copydoc standard_docs::move_assignment()
+		 */
+		PatternMatrix<T_Int>& operator=(PatternMatrix<T_Int>&& other) = default;
+
+		/** @} */
+
+		/** 
+		 * @name Arguments
+		 * @{
+		 */
+
+		/**
+		 * @copydoc standard_docs::nnz()
+		 */
+		int_t nnz() const;
+
+		/**
+		 * @brief The column pointer array.
+		 */
+		const T_Int* colptr() const;
+
+		/**
+		 * @brief The row index array.
+		 */
+		const T_Int* rowidx() const;
+
+		/** @} */
+
+		/** 
+		 * @name Public Member Functions
+		 * @{
+		 */
+
+		/**
+		 * @copydoc standard_docs::clear()
+		 */
+		void clear();
+
+		/**
+		 * @copydoc standard_matrix_docs::info()
+		 */
+		std::string info(const std::string& header = "") const;
+
+		/**
+		 * @brief Validates the pattern structure.
+		 * @details Performs the full O(nnz) structural check of XxMatrix::validate().
+		 */
+		void validate() const;
+
+		/**
+		 * @brief The transposed pattern.
+		 * @return The pattern of A<sup>T</sup>.
+		 */
+		PatternMatrix<T_Int> transpose() const;
+
+		/**
+		 * @brief The expanded pattern.
+		 * @return A General pattern, Symmetric patterns are mirrored to both triangles.
+		 */
+		PatternMatrix<T_Int> general() const;
+
+		/**
+		 * @brief The pattern union.
+		 * @details Non General operands with different properties are expanded first.
+		 * @param[in] other The pattern to be united with `*this`, of the same dimensions.
+		 * @return The pattern of A + B.
+		 */
+		PatternMatrix<T_Int> unite(const PatternMatrix<T_Int>& other) const;
+
+		/**
+		 * @brief The pattern product (symbolic multiplication).
+		 * @details Non General operands are expanded first.
+		 * @param[in] other The right hand side pattern.
+		 * @return The General pattern of A * B.
+		 */
+		PatternMatrix<T_Int> product(const PatternMatrix<T_Int>& other) const;
+
+		/**
+		 * @brief Updates a vector with a matrix-vector product.
+		 * @details Performs the operation <b>Y := beta * Y + alpha * opA(A) * X</b> where A has unit entries on the pattern. @n
+		 *          For Symmetric patterns opA is ignored.
+		 *
+		 * @param[in] alpha The scaling coefficient.
+		 * @param[in] opA The operation to be performed for matrix A.
+		 * @param[in] X The input vector.
+		 * @param[in] beta The scaling coefficient for Y.
+		 * @param[in,out] Y The vector to be updated.
+		 */
+		template <typename T_Scalar>
+		void mult(T_Scalar alpha, op_t opA, const dns::XxVector<T_Scalar>& X, T_Scalar beta, dns::XxVector<T_Scalar>& Y) const;
+
+		/**
+		 * @brief Converts to a compressed sparse column matrix.
+		 * @param[in] val The value assigned to all stored entries.
+		 * @return A compressed sparse column matrix with the structure of `*this`.
+		 */
+		template <typename T_Scalar>
+		XxMatrix<T_Int,T_Scalar> toCsc(T_Scalar val = T_Scalar(1)) const;
+
+		/** @} */
+
+	private:
+		std::vector<T_Int> m_colptr;
+		std::vector<T_Int> m_rowidx;
+
+		PatternMatrix(int_t nr, int_t nc, std::vector<T_Int>&& cptr, std::vector<T_Int>&& ridx, const Property& pr);
+};
+
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_CSC_PATTERN_MATRIX_HPP_
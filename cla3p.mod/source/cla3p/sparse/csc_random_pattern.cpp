@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/sparse/csc_random_pattern.hpp"
+
+// system
+
+// 3rd
+
+// cla3p
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace csc {
+/*-------------------------------------------------*/
+RandomPattern::RandomPattern()
+	: RandomPattern(0)
+{
+}
+/*-------------------------------------------------*/
+RandomPattern::RandomPattern(int_t nz, nzdist_t dist, unsigned long long seed)
+	: m_nnz(nz), m_dist(dist), m_seed(seed), m_bandwidth(-1), m_exponent(2.5), m_exact(true)
+{
+	if(nz < 0) {
+		throw err::InvalidOp(msg::InvalidDimensions());
+	}
+}
+/*-------------------------------------------------*/
+RandomPattern::~RandomPattern()
+{
+}
+/*-------------------------------------------------*/
+int_t RandomPattern::nnz() const
+{
+	return m_nnz;
+}
+/*-------------------------------------------------*/
+nzdist_t RandomPattern::distribution() const
+{
+	return m_dist;
+}
+/*-------------------------------------------------*/
+unsigned long long RandomPattern::seed() const
+{
+	return m_seed;
+}
+/*-------------------------------------------------*/
+int_t RandomPattern::bandwidth() const
+{
+	return m_bandwidth;
+}
+/*-------------------------------------------------*/
+real_t RandomPattern::exponent() const
+{
+	return m_exponent;
+}
+/*-------------------------------------------------*/
+bool RandomPattern::exact() const
+{
+	return m_exact;
+}
+/*-------------------------------------------------*/
+void RandomPattern::setSeed(unsigned long long seed)
+{
+	m_seed = seed;
+}
+/*-------------------------------------------------*/
+void RandomPattern::setBandwidth(int_t bw)
+{
+	m_bandwidth = (bw < 0 ? -1 : bw);
+}
+/*-------------------------------------------------*/
+void RandomPattern::setExponent(real_t gamma)
+{
+	if(!(gamma > 1)) {
+		throw err::InvalidOp("Power-law exponent must be greater than 1");
+	}
+
+	m_exponent = gamma;
+}
+/*-------------------------------------------------*/
+void RandomPattern::setExact(bool flg)
+{
+	m_exact = flg;
+}
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_CSC_RANDOM_PATTERN_HPP_
+#define CLA3P_CSC_RANDOM_PATTERN_HPP_
+
+/**
+ * @file
+ */
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace csc {
+/*-------------------------------------------------*/
+
+/**
+ * @nosubgrouping 
+ * @brief The random sparsity pattern settings.
+ *
+ * Describes the non zero structure generated by XxMatrix::random(). @n
+ * Columns are sampled independently in parallel and each column draws from its own stream,
+ * so the same seed reproduces the same matrix regardless of the number of threads.
+ */
+class RandomPattern {
+
+	public:
+
+		/**
+		 * @name Constructors
+		 * @{
+		 */
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty pattern (no off-diagonal entries).
+		 */
+		RandomPattern();
+
+		/**
+		 * @brief The parameterized constructor.
+		 *
+		 * @param[in] nz The requested number of non zeros.
+		 * @param[in] dist The column degree distribution.
+		 * @param[in] seed The seed of the generator.
+		 */
+		explicit RandomPattern(int_t nz, nzdist_t dist = nzdist_t::Uniform, unsigned long long seed = 0);
+
+		/**
+		 * @brief Destroys the pattern settings.
+		 */
+		~RandomPattern();
+
+		/** @} */
+
+		/** 
+		 * @name Arguments
+		 * @{
+		 */
+
+		/**
+		 * @brief The requested number of non zeros.
+		 * @details The generated matrix holds min(nnz(), admissible positions) non zeros,
+		 *          exactly or on average depending on exact().
+		 */
+		int_t nnz() const;
+
+		/**
+		 * @brief The column degree distribution.
+		 */
+		nzdist_t distribution() const;
+
+		/**
+		 * @brief The generator seed.
+		 */
+		unsigned long long seed() const;
+
+		/**
+		 * @brief The half bandwidth.
+		 * @details Entries satisfy |i - j| <= bandwidth(), a negative value means no band restriction.
+		 */
+		int_t bandwidth() const;
+
+		/**
+		 * @brief The power-law exponent.
+		 * @details Column degrees d follow P(d) ~ d<sup>-exponent()</sup> when distribution() is nzdist_t::PowerLaw.
+		 */
+		real_t exponent() const;
+
+		/**
+		 * @brief The non zero count policy.
+		 * @details If true the generated matrix has exactly the requested non zeros,
+		 *          otherwise columns are rounded independently and the requested count is met on average.
+		 */
+		bool exact() const;
+
+		/** @} */
+
+		/** 
+		 * @name Public Member Functions
+		 * @{
+		 */
+
+		/**
+		 * @brief Sets the generator seed.
+		 */
+		void setSeed(unsigned long long seed);
+
+		/**
+		 * @brief Sets the half bandwidth, a negative value removes the band restriction.
+		 */
+		void setBandwidth(int_t bw);
+
+		/**
+		 * @brief Sets the power-law exponent, must be greater than 1.
+		 */
+		void setExponent(real_t gamma);
+
+		/**
+		 * @brief Sets the non zero count policy.
+		 */
+		void setExact(bool flg);
+
+		/** @} */
+
+	private:
+		int_t m_nnz;
+		nzdist_t m_dist;
+		unsigned long long m_seed;
+		int_t m_bandwidth;
+		real_t m_exponent;
+		bool m_exact;
+};
+
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_CSC_RANDOM_PATTERN_HPP_
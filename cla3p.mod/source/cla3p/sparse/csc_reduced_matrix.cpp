@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/sparse/csc_reduced_matrix.hpp"
+
+// system
+#include <algorithm>
+#include <sstream>
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense/dns_xxvector.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+#include "cla3p/bulk/csc.hpp"
+#include "cla3p/bulk/csc_math.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/support/utils.hpp"
+#include "cla3p/support/mt.hpp"
+#include "cla3p/checks/basic_checks.hpp"
+#include "cla3p/checks/matrix_math_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace csc {
+/*-------------------------------------------------*/
+template <typename T_Dst, typename T_Src>
+static void convert_values(int_t nz, const T_Src *src, T_Dst *dst)
+{
+#pragma omp parallel for schedule(static) if(nz >= blk::csc::MT_NNZ_THRESHOLD)
+	for(int_t k = 0; k < nz; k++) {
+		dst[k] = static_cast<T_Dst>(src[k]);
+	} // k
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+ReducedMatrix<T_Int,T_Scalar>::ReducedMatrix()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+ReducedMatrix<T_Int,T_Scalar>::ReducedMatrix(const XxMatrix<T_Int,T_Scalar>& A)
+	: MatrixMeta(A.nrows(), A.ncols(), A.prop())
+{
+	if(A.empty()) {
+		clear();
+		return;
+	}
+
+	if(A.prop().isSkew()) {
+		throw err::InvalidOp(msg::InvalidProperty());
+	}
+
+	int_t nz = A.nnz();
+
+	m_colptr.assign(A.colptr(), A.colptr() + A.ncols() + 1);
+	m_rowidx.assign(A.rowidx(), A.rowidx() + nz);
+	m_values.resize(nz);
+
+	convert_values(nz, A.values(), m_values.data());
+
+	updateTransposed();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+ReducedMatrix<T_Int,T_Scalar>::~ReducedMatrix()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void ReducedMatrix<T_Int,T_Scalar>::clear()
+{
+	MatrixMeta::clear();
+	m_colptr.clear();
+	m_rowidx.clear();
+	m_values.clear();
+	m_colptrT.clear();
+	m_rowidxT.clear();
+	m_valuesT.clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void ReducedMatrix<T_Int,T_Scalar>::updateTransposed()
+{
+	int_t nz = nnz();
+
+	if(nz < blk::csc::MT_NNZ_THRESHOLD) 
+		return;
+
+	m_colptrT.resize(nrows() + 1);
+	m_rowidxT.resize(nz);
+	m_valuesT.resize(nz);
+
+	blk::csc::transpose(nrows(), ncols(), colptr(), rowidx(), values(), m_colptrT.data(), m_rowidxT.data(), m_valuesT.data());
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+bool ReducedMatrix<T_Int,T_Scalar>::gather() const
+{
+	return (!m_colptrT.empty() && mt::maxThreads() > 1);
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+int_t ReducedMatrix<T_Int,T_Scalar>::nnz() const
+{
+	return (empty() ? 0 : m_colptr[ncols()]);
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+const T_Int* ReducedMatrix<T_Int,T_Scalar>::colptr() const
+{
+	return m_colptr.data();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+const T_Int* ReducedMatrix<T_Int,T_Scalar>::rowidx() const
+{
+	return m_rowidx.data();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+const typename ReducedMatrix<T_Int,T_Scalar>::storage_type* ReducedMatrix<T_Int,T_Scalar>::values() const
+{
+	return m_values.data();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void ReducedMatrix<T_Int,T_Scalar>::assignValues(const XxMatrix<T_Int,T_Scalar>& A)
+{
+	similarity_check(prop(), nrows(), ncols(), A.prop(), A.nrows(), A.ncols());
+	similarity_dim_check(nnz(), A.nnz());
+
+	if(!blk::csc::same_pattern(ncols(), colptr(), rowidx(), A.colptr(), A.rowidx())) {
+		throw err::NoConsistency(msg::PatternMismatch());
+	}
+
+	convert_values(nnz(), A.values(), m_values.data());
+
+	updateTransposed();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void ReducedMatrix<T_Int,T_Scalar>::mult(T_Scalar alpha, op_t opA, 
+		const dns::XxVector<T_Scalar>& X, T_Scalar beta, dns::XxVector<T_Scalar>& Y) const
+{
+	if(empty()) {
+		throw err::InvalidOp(msg::EmptyObject());
+	}
+
+	if(prop().isSymmetric() || prop().isHermitian()) opA = op_t::N;
+
+	opA = (TypeTraits<T_Scalar>::is_real() && opA == op_t::C ? op_t::T : opA);
+
+	Operation _opA(opA);
+	mat_x_vec_mult_check(_opA, prop(), nrows(), ncols(), X.size(), Y.size());
+
+	if((prop().isGeneral() || prop().isTriangular()) && opA == op_t::N && gather()) {
+
+		blk::csc::gem_x_vec_mixed(op_t::T, ncols(), nrows(), alpha, 
+				m_colptrT.data(), m_rowidxT.data(), m_valuesT.data(), 
+				X.values(), beta, Y.values());
+
+	} else if(prop().isGeneral() || prop().isTriangular()) {
+
+		blk::csc::gem_x_vec_mixed(opA, nrows(), ncols(), alpha, 
+				colptr(), rowidx(), values(), 
+				X.values(), beta, Y.values());
+
+	} else if(prop().isSymmetric() && gather()) {
+
+		blk::csc::sym_x_vec_mixed(ncols(), alpha, 
+				colptr(), rowidx(), values(), 
+				m_colptrT.data(), m_rowidxT.data(), m_valuesT.data(), 
+				X.values(), beta, Y.values());
+
+	} else if(prop().isSymmetric()) {
+
+		blk::csc::sym_x_vec_mixed(prop().uplo(), ncols(), alpha, 
+				colptr(), rowidx(), values(), 
+				X.values(), beta, Y.values());
+
+	} else if(prop().isHermitian() && gather()) {
+
+		blk::csc::hem_x_vec_mixed(ncols(), alpha, 
+				colptr(), rowidx(), values(), 
+				m_colptrT.data(), m_rowidxT.data(), m_valuesT.data(), 
+				X.values(), beta, Y.values());
+
+	} else if(prop().isHermitian()) {
+
+		blk::csc::hem_x_vec_mixed(prop().uplo(), ncols(), alpha, 
+				colptr(), rowidx(), values(), 
+				X.values(), beta, Y.values());
+
+	} else {
+
+		throw err::InvalidOp("Matrices with property " + prop().name() + " not supported for reduced precision products");
+
+	} // property 
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+XxMatrix<T_Int,T_Scalar> ReducedMatrix<T_Int,T_Scalar>::toCsc() const
+{
+	if(empty()) 
+		return XxMatrix<T_Int,T_Scalar>();
+
+	int_t nc = ncols();
+	int_t nz = nnz();
+
+	T_Int    *cptr = i_malloc<T_Int>(nc + 1);
+	T_Int    *ridx = i_malloc<T_Int>(nz);
+	T_Scalar *vals = i_malloc<T_Scalar>(nz);
+
+	std::copy(m_colptr.begin(), m_colptr.end(), cptr);
+	std::copy(m_rowidx.begin(), m_rowidx.end(), ridx);
+	convert_values(nz, m_values.data(), vals);
+
+	XxMatrix<T_Int,T_Scalar> ret(nrows(), nc, cptr, ridx, vals, true, prop());
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+std::string ReducedMatrix<T_Int,T_Scalar>::info(const std::string& header) const
+{ 
+	std::string top;
+	std::string bottom;
+	fill_info_margins(header, top, bottom);
+
+	std::ostringstream ss;
+
+	ss << top << "\n";
+
+	ss << "  Datatype............. " << TypeTraits<T_Scalar>::type_name() << "\n";
+	ss << "  Precision............ " << TypeTraits<T_Scalar>::prec_name() << "\n";
+	ss << "  Storage precision.... " << TypeTraits<storage_type>::prec_name() << "\n";
+	ss << "  Number of rows....... " << nrows() << "\n";
+	ss << "  Number of columns.... " << ncols() << "\n";
+	ss << "  Number of non zeros.. " << nnz() << "\n";
+	ss << "  Property............. " << prop() << "\n";
+
+	ss << bottom << "\n";
+
+	return ss.str();
+}
+/*-------------------------------------------------*/
+template class ReducedMatrix<int_t,real_t>;
+template class ReducedMatrix<int_t,complex_t>;
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace cla3p
+/*-------------------------------------------------*/
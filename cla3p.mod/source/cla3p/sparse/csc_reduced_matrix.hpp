@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2025-2026 Simulisoft
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_CSC_REDUCED_MATRIX_HPP_
+#define CLA3P_CSC_REDUCED_MATRIX_HPP_
+
+/**
+ * @file
+ */
+
+#include <string>
+#include <vector>
+
+#include "cla3p/types.hpp"
+#include "cla3p/generic/matrix_meta.hpp"
+#include "cla3p/sparse/csc_xxmatrix.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+/*-------------------------------------------------*/
+
+namespace dns { template <typename T_Scalar> class XxVector; }
+
+/*-------------------------------------------------*/
+namespace csc {
+/*-------------------------------------------------*/
+
+/**
+ * @nosubgrouping 
+ * @brief The reduced precision sparse matrix class (compressed sparse column format).
+ *
+ * Stores the values of a double precision sparse matrix in single precision,
+ * while products are performed on double precision vectors and accumulated in double precision. @n
+ * Matrix-vector products are bandwidth bound, so halving the value traffic speeds up
+ * operators that do not need full accuracy, such as smoothers and preconditioners. @n
+ * Values are rounded to the nearest single precision number on conversion. @n
+ * Large matrices also keep a transposed copy, so that multithreaded products compute
+ * each output entry by a row gather, with no write conflicts.
+ */
+template <typename T_Int, typename T_Scalar>
+class ReducedMatrix : public MatrixMeta {
+
+	public:
+		using index_type = T_Int;
+		using value_type = T_Scalar;
+		using storage_type = typename TypeTraits<T_Scalar>::single_type;
+
+	public:
+
+		/**
+		 * @name Constructors
+		 * @{
+		 */
+
+		/**
+		 * @copydoc standard_matrix_docs::constructor()
+		 */
+		ReducedMatrix();
+
+		/**
+		 * @brief The conversion constructor.
+		 * @details Constructs a reduced precision copy of A.
+		 * @param[in] A The compressed sparse column matrix to be converted (any property except Skew).
+		 */
+		explicit ReducedMatrix(const XxMatrix<T_Int,T_Scalar>& A);
+
+		/**
+		 * @copydoc standard_docs::copy_constructor()
+		 */
+		ReducedMatrix(const ReducedMatrix<T_Int,T_Scalar>& other) = default;
+
+		/**
+		 * @copydoc standard_docs::move_constructor()
+		 */
+		ReducedMatrix(ReducedMatrix<T_Int,T_Scalar>&& other) = default;
+
+		/**
+		 * @copydoc standard_matrix_docs::destructor()
+		 */
+		~ReducedMatrix();
+
+		/** @} */
+
+		/** 
+		 * @name Operators
+		 * @{
+		 */
+
+		/**
+		 * @copydoc standard_docs::copy_assignment()
+		 */
+		ReducedMatrix<T_Int,T_Scalar>& operator=(const ReducedMatrix<T_Int,T_Scalar>& other) = default;
+
+		/**
+		 * @copydoc standard_docs::move_assignment()
+		 */
+		ReducedMatrix<T_Int,T_Scalar>& operator=(ReducedMatrix<T_Int,T_Scalar>&& other) = default;
+
+		/** @} */
+
+		/** 
+		 * @name Arguments
+		 * @{
+		 */
+
+		/**
+		 * @copydoc standard_docs::nnz()
+		 */
+		int_t nnz() const;
+
+		/**
+		 * @brief The column pointer array.
+		 */
+		const T_Int* colptr() const;
+
+		/**
+		 * @brief The row index array.
+		 */
+		const T_Int* rowidx() const;
+
+		/**
+		 * @brief The reduced precision value array.
+		 */
+		const storage_type* values() const;
+
+		/** @} */
+
+		/** 
+		 * @name Public Member Functions
+		 * @{
+		 */
+
+		/**
+		 * @copydoc standard_docs::clear()
+		 */
+		void clear();
+
+		/**
+		 * @copydoc standard_matrix_docs::info()
+		 */
+		std::string info(const std::string& header = "") const;
+
+		/**
+		 * @brief Refreshes the values.
+		 * @details Converts the values of A, which must have the same pattern as `*this`.
+		 * @param[in] A The compressed sparse column matrix whose values are converted.
+		 */
+		void assignValues(const XxMatrix<T_Int,T_Scalar>& A);
+
+		/**
+		 * @brief Updates a vector with a matrix-vector product.
+		 * @details Performs the operation <b>Y := beta * Y + alpha * opA(A) * X</b> with double precision accumulation. @n
+		 *          For Symmetric and Hermitian matrices opA is ignored.
+		 *
+		 * @param[in] alpha The scaling coefficient.
+		 * @param[in] opA The operation to be performed for matrix A.
+		 * @param[in] X The input vector.
+		 * @param[in] beta The scaling coefficient for Y.
+		 * @param[in,out] Y The vector to be updated.
+		 */
+		void mult(T_Scalar alpha, op_t opA, const dns::XxVector<T_Scalar>& X, T_Scalar beta, dns::XxVector<T_Scalar>& Y) const;
+
+		/**
+		 * @brief Converts to a full precision compressed sparse column matrix.
+		 * @return A compressed sparse column copy of `*this` with widened values.
+		 */
+		XxMatrix<T_Int,T_Scalar> toCsc() const;
+
+		/** @} */
+
+	private:
+		std::vector<T_Int> m_colptr;
+		std::vector<T_Int> m_rowidx;
+		std::vector<storage_type> m_values;
+
+		std::vector<T_Int> m_colptrT;
+		std::vector<T_Int> m_rowidxT;
+		std::vector<storage_type> m_valuesT;
+
+		void updateTransposed();
+		bool gather() const;
+};
+
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_CSC_REDUCED_MATRIX_HPP_
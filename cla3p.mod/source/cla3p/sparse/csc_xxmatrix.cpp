@@ -18,6 +18,8 @@
 #include "cla3p/sparse/csc_xxmatrix.hpp"
 
 // system
+#include <limits>
+#include <vector>
 
 // 3rd
 
@@ -31,6 +33,8 @@
 #include "cla3p/support/imalloc.hpp"
 #include "cla3p/support/rand.hpp"
 #include "cla3p/support/utils.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
 
 #include "cla3p/checks/basic_checks.hpp"
 #include "cla3p/checks/csc_checks.hpp"
@@ -115,6 +119,14 @@ void XxMatrix<T_Int,T_Scalar>::clear()
 }
 /*-------------------------------------------------*/
 template <typename T_Int, typename T_Scalar>
+void XxMatrix<T_Int,T_Scalar>::validate() const
+{
+	if(empty()) return;
+
+	blk::csc::check(prop().type(), prop().uplo(), nrows(), ncols(), this->colptr(), this->rowidx());
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
 VirtualScale<XxMatrix<T_Int,T_Scalar>,VirtualObject<XxMatrix<T_Int,T_Scalar>>> XxMatrix<T_Int,T_Scalar>::operator-() const
 {
 	return (T_Scalar(-1) * (*this));
@@ -430,127 +442,143 @@ XxMatrix<T_Int,T_Scalar> XxMatrix<T_Int,T_Scalar>::block(int_t ibgn, int_t jbgn,
 
 	if(!ni || !nj) return XxMatrix<T_Int,T_Scalar>();
 
-	T_Int *cptr = i_calloc<T_Int>(nj + 1);
-
-	int_t iend = ibgn + ni;
-	int_t jend = jbgn + nj;
-
-	for(int_t j = jbgn; j < jend; j++) {
-		int_t jlocal = j - jbgn;
-		for(T_Int irow = (this->colptr())[j]; irow < (this->colptr())[j+1]; irow++) {
-			T_Int i = (this->rowidx())[irow];
-			if(static_cast<T_Int>(ibgn) <= i && i < static_cast<T_Int>(iend)) {
-				cptr[jlocal+1]++;
-			} // i in range
-		} // irow
-	} // j
-
-	blk::csc::roll(nj, cptr);
-
-	T_Int     nnz  = cptr[nj];
-	T_Int    *ridx = nullptr;
-	T_Scalar *vals = nullptr;
+	T_Int *cptr = i_malloc<T_Int>(nj + 1);
 
-	if(nnz) {
+	blk::csc::block_colptr(ibgn, jbgn, ni, nj, this->colptr(), this->rowidx(), cptr);
 
-		ridx = i_malloc<T_Int>(nnz);
-		vals = i_malloc<T_Scalar>(nnz);
+	T_Int     nz   = cptr[nj];
+	T_Int    *ridx = i_malloc<T_Int>(nz);
+	T_Scalar *vals = i_malloc<T_Scalar>(nz);
 
-		for(int_t j = jbgn; j < jend; j++) {
-			int_t jlocal = j - jbgn;
-			for(T_Int irow = (this->colptr())[j]; irow < (this->colptr())[j+1]; irow++) {
-				T_Int i = (this->rowidx())[irow];
-				T_Int ilocal = i - ibgn;
-				T_Scalar v = (this->values())[irow];
-				if(static_cast<T_Int>(ibgn) <= i && i < static_cast<T_Int>(iend)) {
-					ridx[cptr[jlocal]] = ilocal;
-					vals[cptr[jlocal]] = v;
-					cptr[jlocal]++;
-				} // i in range
-			} // irow
-		} // j
-
-		blk::csc::unroll(nj, cptr);
-
-	} // nnz
+	blk::csc::block(ibgn, jbgn, ni, nj, this->colptr(), this->rowidx(), this->values(), cptr, ridx, vals);
 
 	XxMatrix<T_Int,T_Scalar> ret(ni, nj, cptr, ridx, vals, true, pr);
 
 	return ret;
 }
 /*-------------------------------------------------*/
-template <typename T_Int, typename T_Scalar>
-void XxMatrix<T_Int,T_Scalar>::checker() const
+static void partition_bounds_check(int_t dim, const std::vector<int_t>& bounds)
 {
-	csc_consistency_check(prop(), nrows(), ncols(), nnz(), this->colptr(), this->rowidx(), this->values());
+	if(bounds.size() < 2 || bounds.front() != 0 || bounds.back() != dim) {
+		throw err::InvalidOp(msg::InvalidPartition());
+	}
+
+	for(std::size_t p = 1; p < bounds.size(); p++) {
+		if(bounds[p] <= bounds[p-1]) {
+			throw err::InvalidOp(msg::InvalidPartition());
+		}
+	} // p
 }
 /*-------------------------------------------------*/
-/*-------------------------------------------------*/
-/*-------------------------------------------------*/
 template <typename T_Int, typename T_Scalar>
-XxMatrix<T_Int,T_Scalar> XxMatrix<T_Int,T_Scalar>::random(int_t nr, int_t nc, int_t nz, const Property& pr, T_RScalar lo, T_RScalar hi)
+std::vector<XxMatrix<T_Int,T_Scalar>> XxMatrix<T_Int,T_Scalar>::partition(
+		const std::vector<int_t>& rowBounds, const std::vector<int_t>& colBounds) const
 {
-	if(!nr || !nc)
-		return XxMatrix<T_Int,T_Scalar>();
+	partition_bounds_check(nrows(), rowBounds);
+	partition_bounds_check(ncols(), colBounds);
 
-	coo::XxMatrix<T_Int,T_Scalar> Acoo(nr, nc, pr);
+	if(!prop().isGeneral() && rowBounds != colBounds) {
+		throw err::NoConsistency("Row and column partitions of " + prop().name() + " matrices should coincide");
+	}
 
-	int_t offDiagNnz = nz;
+	int_t nrp = static_cast<int_t>(rowBounds.size()) - 1;
+	int_t ncp = static_cast<int_t>(colBounds.size()) - 1;
+	int_t nblocks = nrp * ncp;
 
-	/*
-	 * Fill diagonal if needed
-	 */
-	if(pr.isSymmetric() || pr.isHermitian() || pr.isTriangular() || (pr.isGeneral() && nr == nc)) {
+	std::vector<T_Int*> cptr(nblocks);
+	std::vector<T_Int*> ridx(nblocks);
+	std::vector<T_Scalar*> vals(nblocks);
 
-		int_t diagNnz = std::min(std::min(nr,nc),nz);
-		offDiagNnz = nz - diagNnz;
+	for(int_t q = 0; q < ncp; q++) {
+		for(int_t p = 0; p < nrp; p++) {
+			cptr[p + q * nrp] = i_malloc<T_Int>(colBounds[q+1] - colBounds[q] + 1);
+		} // p
+	} // q
 
-		for(int_t j = 0; j < diagNnz; j++) {
+	blk::csc::partition_colptr(nrows(), ncols(), this->colptr(), this->rowidx(), 
+			nrp, rowBounds.data(), ncp, colBounds.data(), cptr.data());
 
-			T_Scalar Ajj = rand<T_Scalar>(lo,hi);
+	for(int_t q = 0; q < ncp; q++) {
+		for(int_t p = 0; p < nrp; p++) {
+			int_t b = p + q * nrp;
+			T_Int nz = cptr[b][colBounds[q+1] - colBounds[q]];
+			ridx[b] = i_malloc<T_Int>(nz);
+			vals[b] = i_malloc<T_Scalar>(nz);
+		} // p
+	} // q
 
-			if(pr.isHermitian())
-				arith::setIm(Ajj,0);
+	blk::csc::partition(nrows(), ncols(), this->colptr(), this->rowidx(), this->values(), 
+			nrp, rowBounds.data(), ncp, colBounds.data(), cptr.data(), ridx.data(), vals.data());
 
-			Acoo.insert(j,j,Ajj);
+	std::vector<XxMatrix<T_Int,T_Scalar>> ret;
+	ret.reserve(nblocks);
 
-		} // j
+	for(int_t q = 0; q < ncp; q++) {
+		for(int_t p = 0; p < nrp; p++) {
 
-	} // sy/he
+			int_t b = p + q * nrp;
+			int_t ni = rowBounds[p+1] - rowBounds[p];
+			int_t nj = colBounds[q+1] - colBounds[q];
 
-	/*
-	 * Fill off-diagonal
-	 * Do not use while loops
-	 * Do not treat cases where i == j
-	 * Trivial cases like 1x1 Skew are insignificant
-	 */
-	for(int_t k = 0; k < offDiagNnz; k++) {
+			bool stored = ((p == q) || prop().isGeneral() || (prop().isLower() && p > q) || (prop().isUpper() && p < q));
 
-		int_t iend = nr - 1;
-		int_t jend = nc - 1;
+			if(stored) {
+				Property pr = (p == q ? prop() : Property::General());
+				ret.push_back(XxMatrix<T_Int,T_Scalar>(ni, nj, cptr[b], ridx[b], vals[b], true, pr));
+			} else {
+				i_free(cptr[b]);
+				i_free(ridx[b]);
+				i_free(vals[b]);
+				ret.push_back(XxMatrix<T_Int,T_Scalar>());
+			} // stored
 
-		if(pr.isTriangular() && pr.isUpper() && nr > nc) iend = jend; 
-		if(pr.isTriangular() && pr.isLower() && nr < nc) jend = iend; 
+		} // p
+	} // q
 
-		T_Int i = rand<T_Int>(0,iend);
-		T_Int j = rand<T_Int>(0,jend);
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void XxMatrix<T_Int,T_Scalar>::checker() const
+{
+	csc_consistency_check(prop(), nrows(), ncols(), nnz(), this->colptr(), this->rowidx(), this->values());
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+XxMatrix<T_Int,T_Scalar> XxMatrix<T_Int,T_Scalar>::random(int_t nr, int_t nc, int_t nz, const Property& pr, T_RScalar lo, T_RScalar hi)
+{
+	RandomPattern rp(nz);
+	rp.setSeed(static_cast<unsigned long long>(rand<uint_t>(0, std::numeric_limits<uint_t>::max())));
 
-		if((pr.isUpper() && i > j) || (pr.isLower() && i < j))
-			std::swap(i,j);
+	return random(nr, nc, rp, pr, lo, hi);
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+XxMatrix<T_Int,T_Scalar> XxMatrix<T_Int,T_Scalar>::random(int_t nr, int_t nc, const RandomPattern& rp, const Property& pr, T_RScalar lo, T_RScalar hi)
+{
+	if(!nr || !nc)
+		return XxMatrix<T_Int,T_Scalar>();
+
+	if(nr < 0 || nc < 0) {
+		throw err::NoConsistency(msg::InvalidDimensions());
+	}
 
-		T_Scalar Aij = rand<T_Scalar>(lo,hi);
+	Property prs = sanitizeProperty<T_Scalar>(pr);
+	property_compatibility_check(prs, nr, nc);
 
-		if(i == j && pr.isHermitian())
-			arith::setIm(Aij,0);
+	T_Int *cptr = i_malloc<T_Int>(nc + 1);
 
-		if(i == j && pr.isSkew())
-			continue;
+	int_t nz = blk::csc::random_colptr(prs.type(), prs.uplo(), nr, nc, rp.nnz(),
+			rp.distribution(), rp.bandwidth(), rp.exponent(), rp.exact(), rp.seed(), cptr);
 
-		Acoo.insert(i,j,Aij);
+	T_Int    *ridx = i_malloc<T_Int>(nz);
+	T_Scalar *vals = i_malloc<T_Scalar>(nz);
 
-	} // off diag
+	blk::csc::random(prs.type(), prs.uplo(), nr, nc, rp.nnz(), rp.bandwidth(), rp.seed(), lo, hi, cptr, ridx, vals);
 
-	return Acoo.toCsc();
+	return XxMatrix<T_Int,T_Scalar>(nr, nc, cptr, ridx, vals, true, prs);
 }
 /*-------------------------------------------------*/
 template <typename T_Int, typename T_Scalar>
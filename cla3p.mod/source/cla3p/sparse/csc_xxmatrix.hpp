@@ -23,10 +23,12 @@
 
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "cla3p/generic/matrix_meta.hpp"
 #include "cla3p/dense/dns_xxmatrix.hpp"
 #include "cla3p/sparse/csc_xxcontainer.hpp"
+#include "cla3p/sparse/csc_random_pattern.hpp"
 #include "cla3p/generic/guard.hpp"
 
 /*-------------------------------------------------*/
@@ -148,6 +150,15 @@ class XxMatrix : public MatrixMeta, public XxContainer<T_Int,T_Scalar> {
 		 */
 		void clear();
 
+		/**
+		 * @brief Validates the matrix structure.
+		 * @details Construction and views only check dimensions and pointers, so trusted buffers are bound in constant time.@n
+		 *          This performs the full O(nnz) check: column pointers in ascending order, row indexes in range,
+		 *          strictly increasing (sorted, no duplicates) within each column and consistent with the matrix property.@n
+		 *          Columns are checked in parallel for large matrices.
+		 */
+		void validate() const;
+
 		/**
 		 * @copydoc standard_matrix_docs::info()
 		 */
@@ -258,6 +269,19 @@ class XxMatrix : public MatrixMeta, public XxContainer<T_Int,T_Scalar> {
 		 */
 		XxMatrix<T_Int,T_Scalar> block(int_t ibgn, int_t jbgn, int_t ni, int_t nj) const;
 
+		/**
+		 * @brief Splits the matrix into blocks with content copy.
+		 * @details Extracts all blocks defined by a row and a column partition in a single sweep of `*this`. @n
+		 *          Block (p,q) is `(*this)[rowBounds[p]:rowBounds[p+1],colBounds[q]:colBounds[q+1]]` and is stored
+		 *          at position `p + q * (rowBounds.size() - 1)` of the returned vector. @n
+		 *          For symmetric, hermitian, skew and triangular matrices the two partitions must coincide,
+		 *          diagonal blocks inherit the matrix property and blocks outside the stored part are returned empty.
+		 * @param[in] rowBounds The row partition boundaries, starting at 0 and ending at nrows() in strictly increasing order.
+		 * @param[in] colBounds The column partition boundaries, starting at 0 and ending at ncols() in strictly increasing order.
+		 * @return The blocks of `*this` in column-major block order.
+		 */
+		std::vector<XxMatrix<T_Int,T_Scalar>> partition(const std::vector<int_t>& rowBounds, const std::vector<int_t>& colBounds) const;
+
 		/** @} */
 
 		/** 
@@ -271,6 +295,21 @@ class XxMatrix : public MatrixMeta, public XxContainer<T_Int,T_Scalar> {
 		static XxMatrix<T_Int,T_Scalar> random(int_t nr, int_t nc, int_t nz, const Property& pr = Property::General(),
 				T_RScalar lo = T_RScalar(0), T_RScalar hi = T_RScalar(1));
 
+		/**
+		 * @brief Creates a matrix with a prescribed random structure and random values in (lo,hi).
+		 * @details Creates a (nr x nc) matrix directly in compressed column format, columns are generated in parallel. @n
+		 *          The structure follows the settings of rp and is reproducible for a given seed.
+		 * @param[in] nr The number of matrix rows.
+		 * @param[in] nc The number of matrix columns.
+		 * @param[in] rp The random pattern settings.
+		 * @param[in] pr The matrix property.
+		 * @param[in] lo The smallest value of each generated element.
+		 * @param[in] hi The largest value of each generated element.
+		 * @return The newly created matrix.
+		 */
+		static XxMatrix<T_Int,T_Scalar> random(int_t nr, int_t nc, const RandomPattern& rp, const Property& pr = Property::General(),
+				T_RScalar lo = T_RScalar(0), T_RScalar hi = T_RScalar(1));
+
 		/**
 		 * @copydoc standard_csc_docs::view()
 		 */
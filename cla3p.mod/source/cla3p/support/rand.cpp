@@ -95,5 +95,35 @@ template real4_t    rand(real4_t, real4_t);
 template complex_t  rand(real_t , real_t );
 template complex8_t rand(real4_t, real4_t);
 /*-------------------------------------------------*/
+template <typename T_Scalar>
+static T_Scalar streamCaseReal(RandomStream& rs, T_Scalar lo, T_Scalar hi)
+{
+	return lo + (hi - lo) * static_cast<T_Scalar>(rs.uniform());
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static T_Scalar streamCase(RandomStream& rs,
+		typename TypeTraits<T_Scalar>::real_type lo,
+		typename TypeTraits<T_Scalar>::real_type hi);
+/*-------------------------------------------------*/
+template<> real_t  streamCase<real_t >(RandomStream& rs, real_t  lo, real_t  hi) { return streamCaseReal<real_t >(rs,lo,hi); }
+template<> real4_t streamCase<real4_t>(RandomStream& rs, real4_t lo, real4_t hi) { return streamCaseReal<real4_t>(rs,lo,hi); }
+/*-------------------------------------------------*/
+template<> complex_t  streamCase<complex_t >(RandomStream& rs, real_t  lo, real_t  hi) { real_t  re = streamCaseReal(rs,lo,hi); return complex_t (re, streamCaseReal(rs,lo,hi)); }
+template<> complex8_t streamCase<complex8_t>(RandomStream& rs, real4_t lo, real4_t hi) { real4_t re = streamCaseReal(rs,lo,hi); return complex8_t(re, streamCaseReal(rs,lo,hi)); }
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+T_Scalar rand(RandomStream& rs,
+		typename TypeTraits<T_Scalar>::real_type lo,
+		typename TypeTraits<T_Scalar>::real_type hi)
+{
+	return streamCase<T_Scalar>(rs,lo,hi);
+}
+/*-------------------------------------------------*/
+template real_t     rand(RandomStream&, real_t , real_t );
+template real4_t    rand(RandomStream&, real4_t, real4_t);
+template complex_t  rand(RandomStream&, real_t , real_t );
+template complex8_t rand(RandomStream&, real4_t, real4_t);
+/*-------------------------------------------------*/
 } // namespace cla3p
 /*-------------------------------------------------*/
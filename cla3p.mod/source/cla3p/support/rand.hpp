@@ -36,6 +36,60 @@ T_Scalar rand(
 		typename TypeTraits<T_Scalar>::real_type lo, 
 		typename TypeTraits<T_Scalar>::real_type hi);
 
+/*
+ * Counter based generator (splitmix64)
+ * Each (seed, stream) pair yields an independent reproducible sequence,
+ * so parallel generators can assign streams to work items and produce
+ * the same output regardless of the number of threads
+ */
+class RandomStream {
+
+	public:
+		RandomStream(unsigned long long seed, unsigned long long stream)
+			: m_state(mix(seed ^ mix(stream + 0x632be59bd9b4e019ULL))) {}
+
+		unsigned long long next()
+		{
+			m_state += 0x9e3779b97f4a7c15ULL;
+			return mix(m_state);
+		}
+
+		/*
+		 * Integer in [0,n), n > 0
+		 */
+		int_t index(int_t n)
+		{
+			return static_cast<int_t>(next() % static_cast<unsigned long long>(n));
+		}
+
+		/*
+		 * Real in [0,1)
+		 */
+		real_t uniform()
+		{
+			return static_cast<real_t>(next() >> 11) * (1. / 9007199254740992.);
+		}
+
+	private:
+		unsigned long long m_state;
+
+		static unsigned long long mix(unsigned long long z)
+		{
+			z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+			z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+			return z ^ (z >> 31);
+		}
+};
+
+/*
+ * Random number in [lo,hi) drawn from rs
+ * In complex cases real/complex part in [lo,hi)
+ */
+template <typename T_Scalar>
+T_Scalar rand(RandomStream& rs,
+		typename TypeTraits<T_Scalar>::real_type lo, 
+		typename TypeTraits<T_Scalar>::real_type hi);
+
 /*-------------------------------------------------*/
 } // namespace cla3p
 /*-------------------------------------------------*/
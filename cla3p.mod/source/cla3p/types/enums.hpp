@@ -104,6 +104,30 @@ enum class dup_t {
 	Amin      /**< Keeps absolute minimum entry */
 };
 
+/**
+ * @ingroup cla3p_module_index_datatypes
+ * @enum nzdist_t
+ * @brief The column degree distribution.
+ *
+ * Sets how non zeros are distributed among columns in random sparse matrices.
+ */
+enum class nzdist_t {
+	Uniform  = 0, /**< Non zeros are spread with uniform density over the admissible positions */
+	PowerLaw      /**< Column degrees follow a power-law (heavy-tailed) distribution */
+};
+
+/**
+ * @ingroup cla3p_module_index_datatypes
+ * @enum droptol_t
+ * @brief The drop tolerance policy.
+ *
+ * Sets how the drop tolerance is interpreted in dense to sparse conversions.
+ */
+enum class droptol_t {
+	Absolute = 0, /**< Entries with magnitude not exceeding tol are dropped */
+	Relative      /**< Entries with magnitude not exceeding tol times the largest entry magnitude are dropped */
+};
+
 enum class decomp_t {
 	Auto        = 0,
 	LLT         = 1,
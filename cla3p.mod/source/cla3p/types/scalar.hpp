@@ -61,6 +61,7 @@ template<> class TypeTraits<real_t> {
 	public:
 		using real_type = real_t;
 		using complex_type = complex_t;
+		using single_type = real4_t;
 		static std::string type_name();
 		static std::string prec_name();
 		constexpr static char netlibChar() { return 'd'; }
@@ -75,6 +76,7 @@ template<> class TypeTraits<real4_t> {
 	public:
 		using real_type = real4_t;
 		using complex_type = complex8_t;
+		using single_type = real4_t;
 		static std::string type_name();
 		static std::string prec_name();
 		constexpr static char netlibChar() { return 's'; }
@@ -89,6 +91,7 @@ template<> class TypeTraits<complex_t> {
 	public:
 		using real_type = complex_t::value_type;
 		using complex_type = complex_t;
+		using single_type = complex8_t;
 		static std::string type_name();
 		static std::string prec_name();
 		constexpr static char netlibChar() { return 'z'; }
@@ -103,6 +106,7 @@ template<> class TypeTraits<complex8_t> {
 	public:
 		using real_type = complex8_t::value_type;
 		using complex_type = complex8_t;
+		using single_type = complex8_t;
 		static std::string type_name();
 		static std::string prec_name();
 		constexpr static char netlibChar() { return 'c'; }
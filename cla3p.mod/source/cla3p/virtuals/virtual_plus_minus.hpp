@@ -22,11 +22,70 @@
  */
 
 #include "cla3p/virtuals/virtual_expression.hpp"
+#include "cla3p/virtuals/virtual_object.hpp"
+#include "cla3p/virtuals/virtual_scale.hpp"
+#include "cla3p/algebra/functional_add.hpp"
 
 /*-------------------------------------------------*/
 namespace cla3p { 
 /*-------------------------------------------------*/
 
+//
+// Sparse operands of additions (objects and scaled objects) are used directly, without evaluation
+//
+template <typename T_Result, typename T_Virtual>
+const T_Result* VirtualSparseOperand(const VirtualExpression<T_Result,T_Virtual>&, typename T_Result::value_type&)
+{
+	return nullptr;
+}
+/*-------------------------------------------------*/
+template <typename T_Result>
+const T_Result* VirtualSparseOperand(const VirtualObject<T_Result>& v, typename T_Result::value_type& coeff)
+{
+	coeff = typename T_Result::value_type(1);
+	return &v.get();
+}
+/*-------------------------------------------------*/
+template <typename T_Result>
+const T_Result* VirtualSparseOperand(const VirtualScale<T_Result,VirtualObject<T_Result>>& v, typename T_Result::value_type& coeff)
+{
+	coeff = v.coeff();
+	return &v.get().get();
+}
+/*-------------------------------------------------*/
+//
+// Evaluates left + sign * right on a sparse matrix with a single merge if possible
+// dest is replaced by the result, so it gets exactly the union pattern of the operands 
+// (reuse of an existing pattern is left to ops::add() and ops::update())
+//
+template <typename T_Int, typename T_Scalar, typename T_Left, typename T_Right>
+void VirtualSparseAdd(
+	const VirtualExpression<csc::XxMatrix<T_Int,T_Scalar>,T_Left>& left, 
+	const VirtualExpression<csc::XxMatrix<T_Int,T_Scalar>,T_Right>& right, 
+	T_Scalar sign, csc::XxMatrix<T_Int,T_Scalar>& dest)
+{ 
+	T_Scalar alpha = T_Scalar(1);
+	T_Scalar beta  = T_Scalar(1);
+
+	const csc::XxMatrix<T_Int,T_Scalar> *A = VirtualSparseOperand(left.self(), alpha);
+	const csc::XxMatrix<T_Int,T_Scalar> *B = VirtualSparseOperand(right.self(), beta);
+
+	if(A && B) {
+		csc::XxMatrix<T_Int,T_Scalar> tmp = ops::add(alpha, *A, sign * beta, *B);
+		dest.clear();
+		dest = tmp.move();
+		return;
+	} // direct
+
+	if(dest.empty()) {
+		left.evaluateOnNew(dest);
+	} else {
+		left.evaluateOnExisting(dest);
+	} // dest
+	right.accumulateOnExisting(dest, sign);
+}
+/*-------------------------------------------------*/
+
 /**
  * @nosubgrouping
  * @brief The virtual addition expression class.
@@ -43,12 +102,7 @@ class VirtualPlus : public VirtualExpression<T_Result, VirtualPlus<T_Result, T_L
 		: m_left(left.self()), m_right(right.self()) {}
 		~VirtualPlus() {}
 
-		void evaluateOnNew(T_Result& dest) const override
-		{
-			dest.clear();
-			m_left.evaluateOnNew(dest);
-			m_right.accumulateOnExisting(dest, T_Scalar(1));
-		}
+		void evaluateOnNew(T_Result& dest) const override;
 
 		void evaluateOnExisting(T_Result& dest) const override;
 
@@ -65,30 +119,54 @@ class VirtualPlus : public VirtualExpression<T_Result, VirtualPlus<T_Result, T_L
 
 /*-------------------------------------------------*/
 template <typename T_Result, typename T_Left, typename T_Right>
-void VirtualPlusEvaluateOnExistingSpec(
+void VirtualPlusEvaluateOnNewSpec(
 	const VirtualExpression<typename T_Left::result_type,T_Left>& left, 
 	const VirtualExpression<typename T_Right::result_type,T_Right>& right, 
 	T_Result& dest)
 { 
-	left.evaluateOnExisting(dest);
+	left.evaluateOnNew(dest);
 	right.accumulateOnExisting(dest, typename T_Result::value_type(1));
 }
 /*-------------------------------------------------*/
-template <typename T_Int, typename T_Left, typename T_Right>
+template <typename T_Int, typename T_Scalar, typename T_Left, typename T_Right>
+void VirtualPlusEvaluateOnNewSpec(
+	const VirtualExpression<csc::XxMatrix<T_Int,T_Scalar>,T_Left>& left, 
+	const VirtualExpression<csc::XxMatrix<T_Int,T_Scalar>,T_Right>& right, 
+	csc::XxMatrix<T_Int,T_Scalar>& dest)
+{ 
+	VirtualSparseAdd(left, right, T_Scalar(1), dest);
+}
+/*-------------------------------------------------*/
+template <typename T_Result, typename T_Left, typename T_Right>
 void VirtualPlusEvaluateOnExistingSpec(
 	const VirtualExpression<typename T_Left::result_type,T_Left>& left, 
 	const VirtualExpression<typename T_Right::result_type,T_Right>& right, 
-	csc::XxMatrix<T_Int,typename T_Right::return_type::value_type>& dest)
+	T_Result& dest)
+{ 
+	left.evaluateOnExisting(dest);
+	right.accumulateOnExisting(dest, typename T_Result::value_type(1));
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar, typename T_Left, typename T_Right>
+void VirtualPlusEvaluateOnExistingSpec(
+	const VirtualExpression<csc::XxMatrix<T_Int,T_Scalar>,T_Left>& left, 
+	const VirtualExpression<csc::XxMatrix<T_Int,T_Scalar>,T_Right>& right, 
+	csc::XxMatrix<T_Int,T_Scalar>& dest)
 { 
-	csc::XxMatrix<T_Int,typename T_Right::return_type::value_type> tmp;
-	evaluateOnNew(tmp);
-	dest = tmp;
+	VirtualSparseAdd(left, right, T_Scalar(1), dest);
+}
+/*-------------------------------------------------*/
+template <typename T_Result, typename T_Left, typename T_Right>
+void VirtualPlus<T_Result, T_Left, T_Right>::evaluateOnNew(T_Result& dest) const
+{
+	dest.clear();
+	VirtualPlusEvaluateOnNewSpec(m_left, m_right, dest); 
 }
 /*-------------------------------------------------*/
 template <typename T_Result, typename T_Left, typename T_Right>
 void VirtualPlus<T_Result, T_Left, T_Right>::evaluateOnExisting(T_Result& dest) const
 {
-	VirtualPlusEvaluateOnExistingSpec<T_Result, T_Left, T_Right>(m_left, m_right, dest); 
+	VirtualPlusEvaluateOnExistingSpec(m_left, m_right, dest); 
 }
 /*-------------------------------------------------*/
 
@@ -108,12 +186,7 @@ class VirtualMinus : public VirtualExpression<T_Result, VirtualMinus<T_Result, T
 		: m_left(left.self()), m_right(right.self()) {}
 		~VirtualMinus() {}
 
-		void evaluateOnNew(T_Result& dest) const override
-		{
-			dest.clear();
-			m_left.evaluateOnNew(dest);
-			m_right.accumulateOnExisting(dest, T_Scalar(-1));
-		}
+		void evaluateOnNew(T_Result& dest) const override;
 
 		void evaluateOnExisting(T_Result& dest) const override;
 
@@ -130,30 +203,54 @@ class VirtualMinus : public VirtualExpression<T_Result, VirtualMinus<T_Result, T
 
 /*-------------------------------------------------*/
 template <typename T_Result, typename T_Left, typename T_Right>
-void VirtualMinusEvaluateOnExistingSpec(
+void VirtualMinusEvaluateOnNewSpec(
 	const VirtualExpression<typename T_Left::result_type,T_Left>& left, 
 	const VirtualExpression<typename T_Right::result_type,T_Right>& right, 
 	T_Result& dest)
 { 
-	left.evaluateOnExisting(dest);
+	left.evaluateOnNew(dest);
 	right.accumulateOnExisting(dest, typename T_Result::value_type(-1));
 }
 /*-------------------------------------------------*/
-template <typename T_Int, typename T_Left, typename T_Right>
+template <typename T_Int, typename T_Scalar, typename T_Left, typename T_Right>
+void VirtualMinusEvaluateOnNewSpec(
+	const VirtualExpression<csc::XxMatrix<T_Int,T_Scalar>,T_Left>& left, 
+	const VirtualExpression<csc::XxMatrix<T_Int,T_Scalar>,T_Right>& right, 
+	csc::XxMatrix<T_Int,T_Scalar>& dest)
+{ 
+	VirtualSparseAdd(left, right, T_Scalar(-1), dest);
+}
+/*-------------------------------------------------*/
+template <typename T_Result, typename T_Left, typename T_Right>
 void VirtualMinusEvaluateOnExistingSpec(
 	const VirtualExpression<typename T_Left::result_type,T_Left>& left, 
 	const VirtualExpression<typename T_Right::result_type,T_Right>& right, 
-	csc::XxMatrix<T_Int,typename T_Right::return_type::value_type>& dest)
+	T_Result& dest)
 { 
-	csc::XxMatrix<T_Int,typename T_Right::return_type::value_type> tmp;
-	evaluateOnNew(tmp);
-	dest = tmp;
+	left.evaluateOnExisting(dest);
+	right.accumulateOnExisting(dest, typename T_Result::value_type(-1));
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar, typename T_Left, typename T_Right>
+void VirtualMinusEvaluateOnExistingSpec(
+	const VirtualExpression<csc::XxMatrix<T_Int,T_Scalar>,T_Left>& left, 
+	const VirtualExpression<csc::XxMatrix<T_Int,T_Scalar>,T_Right>& right, 
+	csc::XxMatrix<T_Int,T_Scalar>& dest)
+{ 
+	VirtualSparseAdd(left, right, T_Scalar(-1), dest);
+}
+/*-------------------------------------------------*/
+template <typename T_Result, typename T_Left, typename T_Right>
+void VirtualMinus<T_Result, T_Left, T_Right>::evaluateOnNew(T_Result& dest) const
+{
+	dest.clear();
+	VirtualMinusEvaluateOnNewSpec(m_left, m_right, dest); 
 }
 /*-------------------------------------------------*/
 template <typename T_Result, typename T_Left, typename T_Right>
 void VirtualMinus<T_Result, T_Left, T_Right>::evaluateOnExisting(T_Result& dest) const
 {
-	VirtualMinusEvaluateOnExistingSpec<T_Result, T_Left, T_Right>(m_left, m_right, dest); 
+	VirtualMinusEvaluateOnExistingSpec(m_left, m_right, dest); 
 }
 /*-------------------------------------------------*/
 } // namespace cla3p